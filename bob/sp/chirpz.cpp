@@ -0,0 +1,619 @@
+/**
+ * @date Sat Oct 17 18:02:37 CEST 2026
+ *
+ * @brief Python bindings to the chirp-z transform of 1D signals
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/ChirpZ.h>
+
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
+PyDoc_STRVAR(s_chirpz_str, BOB_EXT_MODULE_PREFIX ".ChirpZ");
+
+PyDoc_STRVAR(s_chirpz_doc,
+"ChirpZ(length, points, [w, [a]]) -> new ChirpZ operator\n\
+\n\
+Evaluates the z-transform of signals of the given ``length`` at\n\
+``points`` points ``z_k = a * w**(-k)`` of a spiral arc of the\n\
+z-plane:\n\
+\n\
+  ``X[k] = sum(x[n] * a**(-n) * w**(n*k))``\n\
+\n\
+The transform is computed as a convolution with two FFTs of a\n\
+length of at least ``length + points - 1``, that is in\n\
+``O((length+points)*log(length+points))``, whatever the arc. By\n\
+default (``w`` not given), the points are equally spaced on the\n\
+unit circle, which gives the DFT when ``points`` is ``length``,\n\
+and ``a`` is 1. A narrow band of frequencies is resolved finely,\n\
+without zero padding the signals to a huge length, by setting the\n\
+arc with :py:meth:`set_frequency_range`.\n\
+\n\
+The operator accepts 1D NumPy arrays of type ``complex128`` or\n\
+``complex64`` (of the given ``length``), and 2D arrays of such\n\
+signals (a batch, one signal per row). It returns arrays of the\n\
+same type, with ``points`` values per signal.\n\
+"
+);
+
+/**
+ * Represents a ChirpZ
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::ChirpZ* cxx;
+} PyBobSpChirpZObject;
+
+extern PyTypeObject PyBobSpChirpZ_Type; //forward declaration
+
+int PyBobSpChirpZ_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpChirpZ_Type));
+}
+
+static void PyBobSpChirpZ_Delete (PyBobSpChirpZObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpChirpZ_InitCopy
+(PyBobSpChirpZObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpChirpZ_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpChirpZObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::ChirpZ(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpChirpZ_InitLength(PyBobSpChirpZObject* self,
+    PyObject *args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"length", "points", "w", "a", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t length = 0;
+  Py_ssize_t points = 0;
+  Py_complex w = {0., 0.};
+  Py_complex a = {1., 0.};
+  PyObject* w_obj = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "nn|OD", kwlist, &length,
+        &points, &w_obj, &a)) return -1;
+
+  if (length < 0 || points < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length and points cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  if (w_obj && w_obj != Py_None) {
+    w = PyComplex_AsCComplex(w_obj);
+    if (PyErr_Occurred()) return -1;
+  }
+
+  try {
+    if (w_obj && w_obj != Py_None)
+      self->cxx = new bob::sp::ChirpZ(length, points,
+          std::complex<double>(w.real, w.imag),
+          std::complex<double>(a.real, a.imag));
+    else {
+      self->cxx = new bob::sp::ChirpZ(length, points);
+      if (self->cxx && (a.real != 1. || a.imag != 0.))
+        self->cxx->setA(std::complex<double>(a.real, a.imag));
+    }
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpChirpZ_Init(PyBobSpChirpZObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+
+      return PyBobSpChirpZ_InitCopy(self, args, kwds);
+
+    case 2:
+    case 3:
+    case 4:
+
+      return PyBobSpChirpZ_InitLength(self, args, kwds);
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 to 4 arguments, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpChirpZ_Repr(PyBobSpChirpZObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(length=%zu, points=%zu)", Py_TYPE(self)->tp_name,
+   self->cxx->getLength(), self->cxx->getPoints());
+}
+
+static PyObject* PyBobSpChirpZ_RichCompare (PyBobSpChirpZObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpChirpZ_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpChirpZObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_length_str, "length");
+PyDoc_STRVAR(s_length_doc,
+"The length of the signals\n\
+");
+
+static PyObject* PyBobSpChirpZ_GetLength
+(PyBobSpChirpZObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getLength());
+}
+
+static int PyBobSpChirpZ_SetLength
+(PyBobSpChirpZObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' length can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (len < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  try {
+    self->cxx->setLength(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `length' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_points_str, "points");
+PyDoc_STRVAR(s_points_doc,
+"The number of points of the arc, that is of values of the\n\
+transform of each signal\n\
+");
+
+static PyObject* PyBobSpChirpZ_GetPoints
+(PyBobSpChirpZObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getPoints());
+}
+
+static int PyBobSpChirpZ_SetPoints
+(PyBobSpChirpZObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' points can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t points = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (points < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' points cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  try {
+    self->cxx->setPoints(points);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `points' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_w_str, "w");
+PyDoc_STRVAR(s_w_doc,
+"The (complex, non-zero) ratio between two points of the arc\n\
+");
+
+static PyObject* PyBobSpChirpZ_GetW
+(PyBobSpChirpZObject* self, void* /*closure*/) {
+  const std::complex<double>& w = self->cxx->getW();
+  return PyComplex_FromDoubles(w.real(), w.imag());
+}
+
+static int PyBobSpChirpZ_SetW
+(PyBobSpChirpZObject* self, PyObject* o, void* /*closure*/) {
+
+  Py_complex w = PyComplex_AsCComplex(o);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setW(std::complex<double>(w.real, w.imag));
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `w' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_a_str, "a");
+PyDoc_STRVAR(s_a_doc,
+"The (complex, non-zero) starting point of the arc\n\
+");
+
+static PyObject* PyBobSpChirpZ_GetA
+(PyBobSpChirpZObject* self, void* /*closure*/) {
+  const std::complex<double>& a = self->cxx->getA();
+  return PyComplex_FromDoubles(a.real(), a.imag());
+}
+
+static int PyBobSpChirpZ_SetA
+(PyBobSpChirpZObject* self, PyObject* o, void* /*closure*/) {
+
+  Py_complex a = PyComplex_AsCComplex(o);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setA(std::complex<double>(a.real, a.imag));
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `a' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the FFTs of the convolution:\n\
+``'fftpack'`` (default), ``'stockham'``, ``'tuned'`` or\n\
+``'fftw'``, if the library was compiled with FFTW3 (see\n\
+:py:func:`available_engines`).\n\
+");
+
+static PyObject* PyBobSpChirpZ_GetEngine
+(PyBobSpChirpZObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpChirpZ_SetEngine
+(PyBobSpChirpZObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static PyGetSetDef PyBobSpChirpZ_getseters[] = {
+    {
+      s_length_str,
+      (getter)PyBobSpChirpZ_GetLength,
+      (setter)PyBobSpChirpZ_SetLength,
+      s_length_doc,
+      0
+    },
+    {
+      s_points_str,
+      (getter)PyBobSpChirpZ_GetPoints,
+      (setter)PyBobSpChirpZ_SetPoints,
+      s_points_doc,
+      0
+    },
+    {
+      s_w_str,
+      (getter)PyBobSpChirpZ_GetW,
+      (setter)PyBobSpChirpZ_SetW,
+      s_w_doc,
+      0
+    },
+    {
+      s_a_str,
+      (getter)PyBobSpChirpZ_GetA,
+      (setter)PyBobSpChirpZ_SetA,
+      s_a_doc,
+      0
+    },
+    {
+      s_engine_str,
+      (getter)PyBobSpChirpZ_GetEngine,
+      (setter)PyBobSpChirpZ_SetEngine,
+      s_engine_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+PyDoc_STRVAR(s_set_frequency_range_str, "set_frequency_range");
+PyDoc_STRVAR(s_set_frequency_range_doc,
+"set_frequency_range(start, stop) -> None\n\
+\n\
+Sets the arc to the frequencies ``start + k*(stop-start)/points``\n\
+of the unit circle, in bins of the current :py:attr:`length`\n\
+(``f/length`` cycles per sample), ``stop`` being excluded. The\n\
+points do not follow a later change of the length.\n\
+");
+
+static PyObject* PyBobSpChirpZ_SetFrequencyRange
+(PyBobSpChirpZObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"start", "stop", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  double start = 0., stop = 0.;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "dd", kwlist, &start, &stop))
+    return 0;
+
+  try {
+    self->cxx->setFrequencyRange(start, stop);
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot set the frequency range: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  Py_RETURN_NONE;
+
+}
+
+static PyMethodDef PyBobSpChirpZ_methods[] = {
+  {
+    s_set_frequency_range_str,
+    (PyCFunction)PyBobSpChirpZ_SetFrequencyRange,
+    METH_VARARGS|METH_KEYWORDS,
+    s_set_frequency_range_doc,
+  },
+  {0} /* Sentinel */
+};
+
+static PyObject* PyBobSpChirpZ_Call
+(PyBobSpChirpZObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit or 64-bit complex arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  if (output && output->type_num != input->type_num) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports arrays of type `%s' for output array `output' (matching the input)", Py_TYPE(self)->tp_name, PyBlitzArray_TypenumAsString(input->type_num));
+    return 0;
+  }
+
+  if (input->ndim != 1 && input->ndim != 2) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1 or 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && output->ndim != input->ndim) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts %" PY_FORMAT_SIZE_T "d-dimensional output arrays (matching the input), not %" PY_FORMAT_SIZE_T "dD arrays", Py_TYPE(self)->tp_name, input->ndim, output->ndim);
+    return 0;
+  }
+
+  Py_ssize_t length = self->cxx->getLength();
+  if (input->shape[input->ndim-1] != length) {
+    PyErr_Format(PyExc_RuntimeError, "`input' signals should have %" PY_FORMAT_SIZE_T "d elements matching `%s' length, not %" PY_FORMAT_SIZE_T "d elements", length, Py_TYPE(self)->tp_name, input->shape[input->ndim-1]);
+    return 0;
+  }
+
+  Py_ssize_t shape[2];
+  if (input->ndim == 1) shape[0] = self->cxx->getPoints();
+  else {
+    shape[0] = input->shape[0];
+    shape[1] = self->cxx->getPoints();
+  }
+
+  if (output && (output->shape[0] != shape[0] ||
+        (input->ndim == 2 && output->shape[1] != shape[1]))) {
+    PyErr_Format(PyExc_RuntimeError, "`output' array should have one row per signal and %" PY_FORMAT_SIZE_T "d columns matching `%s' number of points", shape[input->ndim-1], Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(input->type_num, input->ndim, shape);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (input->type_num == NPY_COMPLEX128 && input->ndim == 1)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+    else if (input->type_num == NPY_COMPLEX128)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+    else if (input->ndim == 1)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpChirpZ_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_chirpz_str,                             /*tp_name*/
+    sizeof(PyBobSpChirpZObject),              /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpChirpZ_Delete,         /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpChirpZ_Repr,             /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpChirpZ_Call,          /* tp_call */
+    (reprfunc)PyBobSpChirpZ_Repr,             /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_chirpz_doc,                             /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpChirpZ_RichCompare,   /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    PyBobSpChirpZ_methods,                    /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpChirpZ_getseters,                  /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpChirpZ_Init,             /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
@@ -0,0 +1,285 @@
+/**
+ * @date Sat Oct 17 17:26:03 CEST 2026
+ *
+ * @brief Implement a blitz-based chirp-z transform, which evaluates the
+ * z-transform of a signal at points of a spiral arc of the z-plane (such as
+ * a narrow band of frequencies)
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/ChirpZ.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * exp(2*i*pi*t), the ratio of the arc of M equally spaced points of the
+   * unit circle being exp(-2*i*pi/M)
+   */
+  std::complex<double> turn(const double t) {
+    const double PI = boost::math::constants::pi<double>();
+    return std::complex<double>(cos(2. * PI * t), sin(2. * PI * t));
+  }
+
+  /**
+   * exp(p*log(a) + q*log(w)), the phases being accumulated before the
+   * trigonometric functions are evaluated
+   */
+  std::complex<double> arcPower(const std::complex<double>& a, const double p,
+      const std::complex<double>& w, const double q) {
+    const double magnitude = p * log(std::abs(a)) + q * log(std::abs(w));
+    const double phase = p * std::arg(a) + q * std::arg(w);
+    return std::polar(exp(magnitude), phase);
+  }
+
+  void checkLength(const size_t length, const size_t points) {
+    if (length < 1)
+      throw std::runtime_error("chirp-z transform length should be at least 1.");
+    if (points < 1)
+      throw std::runtime_error("chirp-z transform should have at least 1 point.");
+  }
+
+  void checkArc(const std::complex<double>& w, const std::complex<double>& a) {
+    if (w == 0. || a == 0. || !std::isfinite(std::abs(w)) ||
+        !std::isfinite(std::abs(a)))
+      throw std::runtime_error("chirp-z transform arc should have finite and non-zero w and a.");
+  }
+
+}
+
+bob::sp::ChirpZ::ChirpZ():
+  m_length(1), m_points(1), m_w(1.), m_a(1.),
+  m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  initWorkingArray();
+}
+
+bob::sp::ChirpZ::ChirpZ(const size_t length, const size_t points):
+  m_length(length), m_points(points), m_w(turn(-1. / (double)points)),
+  m_a(1.), m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  checkLength(length, points);
+  initWorkingArray();
+}
+
+bob::sp::ChirpZ::ChirpZ(const size_t length, const size_t points,
+    const std::complex<double>& w, const std::complex<double>& a):
+  m_length(length), m_points(points), m_w(w), m_a(a),
+  m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  checkLength(length, points);
+  checkArc(w, a);
+  initWorkingArray();
+}
+
+bob::sp::ChirpZ::ChirpZ(const bob::sp::ChirpZ& other):
+  m_length(other.m_length), m_points(other.m_points), m_w(other.m_w),
+  m_a(other.m_a), m_engine(other.m_engine),
+  m_input_chirp(other.m_input_chirp), m_output_chirp(other.m_output_chirp),
+  m_kernel(other.m_kernel), m_plans(other.m_plans)
+{
+}
+
+bob::sp::ChirpZ::~ChirpZ()
+{
+}
+
+bob::sp::ChirpZ& bob::sp::ChirpZ::operator=(const ChirpZ& other)
+{
+  if (this != &other) {
+    m_length = other.m_length;
+    m_points = other.m_points;
+    m_w = other.m_w;
+    m_a = other.m_a;
+    m_engine = other.m_engine;
+    m_input_chirp = other.m_input_chirp;
+    m_output_chirp = other.m_output_chirp;
+    m_kernel = other.m_kernel;
+    m_plans = other.m_plans;
+  }
+  return *this;
+}
+
+bool bob::sp::ChirpZ::operator==(const bob::sp::ChirpZ& b) const
+{
+  return (this->m_length == b.m_length && this->m_points == b.m_points &&
+      this->m_w == b.m_w && this->m_a == b.m_a &&
+      this->m_engine == b.m_engine);
+}
+
+bool bob::sp::ChirpZ::operator!=(const bob::sp::ChirpZ& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::ChirpZ::operator()(
+  const blitz::Array<std::complex<double>,1>& src,
+  blitz::Array<std::complex<double>,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst, blitz::TinyVector<int,1>((int)m_points));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::ChirpZ::operator()(
+  const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst, blitz::TinyVector<int,1>((int)m_points));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::ChirpZ::operator()(
+  const blitz::Array<std::complex<double>,2>& src,
+  blitz::Array<std::complex<double>,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_points));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::ChirpZ::operator()(
+  const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_points));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::ChirpZ::setLength(const size_t length)
+{
+  checkLength(length, m_points);
+  m_length = length;
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::setPoints(const size_t points)
+{
+  checkLength(m_length, points);
+  m_points = points;
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::setW(const std::complex<double>& w)
+{
+  checkArc(w, m_a);
+  m_w = w;
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::setA(const std::complex<double>& a)
+{
+  checkArc(m_w, a);
+  m_a = a;
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::setFrequencyRange(const double start, const double stop)
+{
+  if (!std::isfinite(start) || !std::isfinite(stop))
+    throw std::runtime_error("chirp-z transform frequencies should be finite.");
+  // z_k = exp(2*i*pi*f_k/N), with f_k = start + k*(stop-start)/M
+  const double N = (double)m_length;
+  m_a = turn(fmod(start, N) / N);
+  m_w = turn(-(stop - start) / ((double)m_points * N));
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  if (!bob::sp::FFTPlanBase::isAvailable(engine))
+    throw std::runtime_error("bob.sp was compiled without FFTW3 support (BOB_SP_HAVE_FFTW3)");
+  // The length of the convolution depends on the engine
+  m_engine = engine;
+  initWorkingArray();
+}
+
+void bob::sp::ChirpZ::initWorkingArray()
+{
+  const size_t N = m_length, M = m_points;
+  const size_t L = bob::sp::FFTPlanBase::nextFastLength(N + M - 1, m_engine);
+
+  m_input_chirp.resize(N);
+  for (size_t n=0; n<N; ++n)
+    m_input_chirp[n] = arcPower(m_a, -(double)n, m_w, 0.5 * n * n);
+  m_output_chirp.resize(M);
+  for (size_t k=0; k<M; ++k)
+    m_output_chirp[k] = arcPower(m_a, 0., m_w, 0.5 * k * k);
+
+  // Chirp W^(-j^2/2), for -N < j < M, at the index j modulo L, and its
+  // transform. It is always computed in double precision.
+  m_kernel.assign(L, std::complex<double>(0.));
+  for (size_t j=0; j<M; ++j)
+    m_kernel[j] = arcPower(m_a, 0., m_w, -0.5 * j * j) / (double)L;
+  for (size_t j=1; j<N; ++j)
+    m_kernel[L-j] = arcPower(m_a, 0., m_w, -0.5 * j * j) / (double)L;
+  boost::shared_ptr<const bob::sp::FFTPlan> plan = bob::sp::FFTPlan::get(L);
+  bob::sp::detail::Workspace<double> ws(plan->getWorkSize());
+  plan->forward(reinterpret_cast<double*>(m_kernel.data()), ws.data());
+
+  m_plans.reset(L, bob::sp::FFTPlanBase::Complex, m_engine);
+}
+
+template <typename T>
+void bob::sp::ChirpZ::process(const std::complex<T>* src, const size_t rows,
+  std::complex<T>* dst) const
+{
+  const size_t N = m_length, M = m_points, L = m_kernel.size();
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  bob::sp::detail::Workspace<T> ws(2*L + plan.getWorkSize());
+  T* z = ws.data();
+  T* work = z + 2*L;
+  const std::complex<double>* c = m_input_chirp.data();
+  const std::complex<double>* b = m_kernel.data();
+  const std::complex<double>* d = m_output_chirp.data();
+
+  for (size_t r=0; r<rows; ++r) {
+    const T* x = reinterpret_cast<const T*>(src + r*N);
+    T* y = reinterpret_cast<T*>(dst + r*M);
+
+    // z = [x*c 0]
+    for (size_t n=0; n<N; ++n) {
+      const T re = x[2*n], im = x[2*n+1];
+      const T cr = (T)c[n].real(), ci = (T)c[n].imag();
+      z[2*n] = re*cr - im*ci;
+      z[2*n+1] = re*ci + im*cr;
+    }
+    std::fill(z + 2*N, z + 2*L, (T)0);
+
+    // z = ifft(fft(z) * b)
+    plan.forward(z, work);
+    for (size_t j=0; j<L; ++j) {
+      const T re = z[2*j], im = z[2*j+1];
+      const T br = (T)b[j].real(), bi = (T)b[j].imag();
+      z[2*j] = re*br - im*bi;
+      z[2*j+1] = re*bi + im*br;
+    }
+    plan.backward(z, work);
+
+    // y = z*d
+    for (size_t k=0; k<M; ++k) {
+      const T re = z[2*k], im = z[2*k+1];
+      const T dr = (T)d[k].real(), di = (T)d[k].imag();
+      y[2*k] = re*dr - im*di;
+      y[2*k+1] = re*di + im*dr;
+    }
+  }
+}
@@ -8,6 +8,7 @@
  */
 
 #include <bob.sp/DCT1D.h>
+#include <bob.sp/Workspace.h>
 #include <cmath>
 #include <boost/math/constants/constants.hpp>
 
@@ -16,13 +17,14 @@
 #include <bob.core/cast.h>
 
 bob::sp::DCT1DAbstract::DCT1DAbstract():
-  m_length(1), m_working_array(1)
+  m_length(1), m_engine(bob::sp::FFTPlanBase::Fftpack), m_working_array(1)
 {
   initNormFactors();
 }
 
 bob::sp::DCT1DAbstract::DCT1DAbstract(const size_t length):
   m_length(length),
+  m_engine(bob::sp::FFTPlanBase::Fftpack),
   m_working_array(length)
 {
   if (m_length < 1)
@@ -33,6 +35,7 @@ bob::sp::DCT1DAbstract::DCT1DAbstract(const size_t length):
 bob::sp::DCT1DAbstract::DCT1DAbstract(
     const bob::sp::DCT1DAbstract& other):
   m_length(other.m_length),
+  m_engine(other.m_engine),
   m_working_array(other.m_length)
 {
   initNormFactors();
@@ -47,6 +50,7 @@ bob::sp::DCT1DAbstract::operator=(const DCT1DAbstract& other)
 {
   if (this != &other) {
     m_length = other.m_length;
+    m_engine = other.m_engine;
     m_working_array.resize(m_length);
     initWorkingArray();
     initNormFactors();
@@ -56,7 +60,7 @@ bob::sp::DCT1DAbstract::operator=(const DCT1DAbstract& other)
 
 bool bob::sp::DCT1DAbstract::operator==(const bob::sp::DCT1DAbstract& b) const
 {
-  return (this->m_length == b.m_length);
+  return (this->m_length == b.m_length && this->m_engine == b.m_engine);
 }
 
 bool bob::sp::DCT1DAbstract::operator!=(const bob::sp::DCT1DAbstract& b) const
@@ -80,6 +84,44 @@ void bob::sp::DCT1DAbstract::operator()(const blitz::Array<double,1>& src,
   processNoCheck(src, dst);
 }
 
+void bob::sp::DCT1DAbstract::operator()(blitz::Array<double,1>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
+void bob::sp::DCT1DAbstract::operator()(const blitz::Array<float,1>& src,
+  blitz::Array<float,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape( dst, src);
+
+  // Process
+  processNoCheck(src, dst);
+}
+
+void bob::sp::DCT1DAbstract::operator()(blitz::Array<float,1>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
 void bob::sp::DCT1DAbstract::setLength(const size_t length)
 {
   if (length < 1)
@@ -90,6 +132,11 @@ void bob::sp::DCT1DAbstract::setLength(const size_t length)
   initNormFactors();
 }
 
+void bob::sp::DCT1DAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_engine = engine;
+}
+
 void bob::sp::DCT1DAbstract::initNormFactors()
 {
   // Precompute multiplicative factors
@@ -100,25 +147,21 @@ void bob::sp::DCT1DAbstract::initNormFactors()
 
 bob::sp::DCT1D::DCT1D():
   bob::sp::DCT1DAbstract(1),
-  m_fft(2), m_buffer_1(2), m_buffer_2(2)
+  m_fft(2, 1, 1)
 {
   initWorkingArray();
 }
 
 bob::sp::DCT1D::DCT1D(const size_t length):
   bob::sp::DCT1DAbstract(length),
-  m_fft(2*length),
-  m_buffer_1(2*length),
-  m_buffer_2(2*length)
+  m_fft(2*length, length, length)
 {
   initWorkingArray();
 }
 
 bob::sp::DCT1D::DCT1D(const bob::sp::DCT1D& other):
   bob::sp::DCT1DAbstract(other),
-  m_fft(other.m_length),
-  m_buffer_1(2*other.m_length),
-  m_buffer_2(2*other.m_length)
+  m_fft(other.m_fft)
 {
   initWorkingArray();
 }
@@ -132,9 +175,7 @@ bob::sp::DCT1D::operator=(const DCT1D& other)
 {
   if (this != &other) {
     bob::sp::DCT1DAbstract::operator=(other);
-    m_fft.setLength(other.m_length);
-    m_buffer_1.resize(2*other.m_length);
-    m_buffer_2.resize(2*other.m_length);
+    m_fft = other.m_fft;
   }
   return *this;
 }
@@ -142,37 +183,54 @@ bob::sp::DCT1D::operator=(const DCT1D& other)
 void bob::sp::DCT1D::setLength(const size_t length)
 {
   bob::sp::DCT1DAbstract::setLength(length);
-  m_fft.setLength(2*m_length);
-  m_buffer_1.resize(2*length);
-  m_buffer_2.resize(2*length);
+  m_fft.setLength(2*m_length, m_length, m_length);
 }
 
-void bob::sp::DCT1D::processNoCheck(const blitz::Array<double,1>& src,
-  blitz::Array<double,1>& dst) const
+void bob::sp::DCT1D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
 {
-  blitz::Range r1 = blitz::Range(0,m_length-1);
-  blitz::Array<std::complex<double>,1> m_b1 = m_buffer_1(r1);
-  blitz::Array<std::complex<double>,1> m_b2 = m_buffer_2(r1);
+  m_fft.setEngine(engine);
+  bob::sp::DCT1DAbstract::setEngine(engine);
+}
+
+template <typename T>
+void bob::sp::DCT1D::process(const blitz::Array<T,1>& src,
+  blitz::Array<T,1>& dst) const
+{
+  bob::sp::detail::Workspace<std::complex<T> > ws(2*m_length);
+  std::complex<T>* b0 = ws.data();
+  std::complex<T>* b1 = b0 + m_length;
   // Compute the DCT
-  // 1. Make m_buffer_1 = [src 0]
-  m_buffer_1 = 0.;
-  m_b1 = src;
-  // 2. Compute m_buffer_2 = fft(m_buffer_1)
-  m_fft(m_buffer_1, m_buffer_2);
-  // 3. Multiply: m_buffer_2(0:L-1) * exp(-J*PI*k/(2*L))
-  m_b2 *= m_working_array;
-  // 4. Take Real part of m_buffer_2(0:L-1)
-  dst = blitz::real(m_b2(r1));
+  // 1. Make b0 = src (the zero padding to 2*L is implicit)
+  for (int i=0; i<(int)m_length; ++i) b0[i] = src(i);
+  // 2. Compute b1 = fft([b0 0])(0:L-1), with the pruned FFT
+  m_fft(b0, b1);
+  // 3. Multiply: b1 * exp(-J*PI*k/(2*L)), and
+  // 4. Take Real part of it
+  for (int i=0; i<(int)m_length; ++i)
+    dst(i) = (T)(b1[i].real() * m_working_array(i).real() -
+        b1[i].imag() * m_working_array(i).imag());
   // 5. Customized normalization factors:
   //      sqrt(1/L) for index 0
-  dst(0) *= m_sqrt_1byl;
+  dst(0) *= (T)m_sqrt_1byl;
   //      sqrt(2/L) for index >0
   if (dst.extent(0) > 1) {
     blitz::Range r_dst(1,m_length-1);
-    dst(r_dst) *= m_sqrt_2byl;
+    dst(r_dst) *= (T)m_sqrt_2byl;
   }
 }
 
+void bob::sp::DCT1D::processNoCheck(const blitz::Array<double,1>& src,
+  blitz::Array<double,1>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::DCT1D::processNoCheck(const blitz::Array<float,1>& src,
+  blitz::Array<float,1>& dst) const
+{
+  process(src, dst);
+}
+
 void bob::sp::DCT1D::initWorkingArray()
 {
   std::complex<double> J(0., 1.);
@@ -185,25 +243,21 @@ void bob::sp::DCT1D::initWorkingArray()
 
 bob::sp::IDCT1D::IDCT1D():
   bob::sp::DCT1DAbstract(1),
-  m_ifft(1), m_buffer_1(1), m_buffer_2(1)
+  m_ifft(1)
 {
   initWorkingArray();
 }
 
 bob::sp::IDCT1D::IDCT1D(const size_t length):
   bob::sp::DCT1DAbstract(length),
-  m_ifft(length),
-  m_buffer_1(length),
-  m_buffer_2(length)
+  m_ifft(length)
 {
   initWorkingArray();
 }
 
 bob::sp::IDCT1D::IDCT1D(const bob::sp::IDCT1D& other):
   bob::sp::DCT1DAbstract(other),
-  m_ifft(other.m_length),
-  m_buffer_1(other.m_length),
-  m_buffer_2(other.m_length)
+  m_ifft(other.m_ifft)
 {
   initWorkingArray();
 }
@@ -217,9 +271,7 @@ bob::sp::IDCT1D::operator=(const IDCT1D& other)
 {
   if (this != &other) {
     bob::sp::DCT1DAbstract::operator=(other);
-    m_ifft.setLength(other.m_length);
-    m_buffer_1.resize(other.m_length);
-    m_buffer_2.resize(other.m_length);
+    m_ifft = other.m_ifft;
   }
   return *this;
 }
@@ -229,27 +281,47 @@ void bob::sp::IDCT1D::setLength(const size_t length)
 {
   bob::sp::DCT1DAbstract::setLength(length);
   m_ifft.setLength(length);
-  m_buffer_1.resize(length);
-  m_buffer_2.resize(length);
 }
 
-void bob::sp::IDCT1D::processNoCheck(const blitz::Array<double,1>& src,
-  blitz::Array<double,1>& dst) const
+void bob::sp::IDCT1D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
 {
+  m_ifft.setEngine(engine);
+  bob::sp::DCT1DAbstract::setEngine(engine);
+}
+
+template <typename T>
+void bob::sp::IDCT1D::process(const blitz::Array<T,1>& src,
+  blitz::Array<T,1>& dst) const
+{
+  bob::sp::detail::Workspace<std::complex<T> > ws(m_length);
+  blitz::Array<std::complex<T>,1> buffer = ws(0, m_length);
   // Compute the DCT
-  // 1. Make m_buffer_1 = src*m_working_array
-  m_buffer_1 = src * m_working_array;
-  // 2. Compute m_buffer_2 = ifft(m_buffer_1)
-  m_ifft(m_buffer_1, m_buffer_2);
-  // 3. Take Real part of m_buffer_2
-  m_buffer_2 = 2*blitz::real(m_buffer_2);
+  // 1. Make buffer = src*m_working_array
+  for (int i=0; i<(int)m_length; ++i)
+    buffer(i) = std::complex<T>((double)src(i) * m_working_array(i));
+  // 2. Compute buffer = ifft(buffer), in-place
+  m_ifft(buffer);
+  // 3. Take Real part of buffer
+  buffer = 2*blitz::real(buffer);
   // 4. Take the output:
   for(int i=0; i<(int)(m_length/2); ++i) {
-    dst(2*i) = bob::core::array::scalar_cast<double>(m_buffer_2(i));
-    dst(2*i+1) = bob::core::array::scalar_cast<double>(m_buffer_2(m_length-1-i));
+    dst(2*i) = bob::core::array::scalar_cast<T>(buffer(i));
+    dst(2*i+1) = bob::core::array::scalar_cast<T>(buffer(m_length-1-i));
   }
   if ((m_length % 2) == 1)
-    dst(m_length-1) = bob::core::array::scalar_cast<double>(m_buffer_2(m_length/2));
+    dst(m_length-1) = bob::core::array::scalar_cast<T>(buffer(m_length/2));
+}
+
+void bob::sp::IDCT1D::processNoCheck(const blitz::Array<double,1>& src,
+  blitz::Array<double,1>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::IDCT1D::processNoCheck(const blitz::Array<float,1>& src,
+  blitz::Array<float,1>& dst) const
+{
+  process(src, dst);
 }
 
 void bob::sp::IDCT1D::initWorkingArray()
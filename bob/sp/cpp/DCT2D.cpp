@@ -9,19 +9,19 @@
  */
 
 #include <bob.sp/DCT2D.h>
+#include <bob.sp/ColumnTiles.h>
+#include <bob.sp/ThreadPool.h>
 #include <bob.core/assert.h>
 
 bob::sp::DCT2DAbstract::DCT2DAbstract():
-  m_height(1), m_width(1),
-  m_buffer_hw(1,1), m_buffer_h(1), m_buffer_h2(1)
+  m_height(1), m_width(1), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack)
 {
 }
 
 bob::sp::DCT2DAbstract::DCT2DAbstract(
     const size_t height, const size_t width):
-  m_height(height), m_width(width),
-  m_buffer_hw(height, width), m_buffer_h(height),
-  m_buffer_h2(height)
+  m_height(height), m_width(width), m_threads(1),
+  m_engine(bob::sp::FFTPlanBase::Fftpack)
 {
   if (m_height < 1)
     throw std::runtime_error("DCT height should be at least 1.");
@@ -32,8 +32,7 @@ bob::sp::DCT2DAbstract::DCT2DAbstract(
 bob::sp::DCT2DAbstract::DCT2DAbstract(
     const bob::sp::DCT2DAbstract& other):
   m_height(other.m_height), m_width(other.m_width),
-  m_buffer_hw(other.m_height, other.m_width), m_buffer_h(other.m_height),
-  m_buffer_h2(other.m_height)
+  m_threads(other.m_threads), m_engine(other.m_engine)
 {
 }
 
@@ -47,16 +46,16 @@ bob::sp::DCT2DAbstract::operator=(const DCT2DAbstract& other)
   if (this != &other) {
     setHeight(other.m_height);
     setWidth(other.m_width);
-    m_buffer_hw.resize(other.m_height, other.m_width);
-    m_buffer_h.resize(other.m_height);
-    m_buffer_h2.resize(other.m_height);
+    m_threads = other.m_threads;
+    setEngine(other.m_engine);
   }
   return *this;
 }
 
 bool bob::sp::DCT2DAbstract::operator==(const bob::sp::DCT2DAbstract& b) const
 {
-  return (this->m_height == b.m_height && this->m_width == b.m_width);
+  return (this->m_height == b.m_height && this->m_width == b.m_width &&
+      this->m_engine == b.m_engine && this->m_threads == b.m_threads);
 }
 
 bool bob::sp::DCT2DAbstract::operator!=(const bob::sp::DCT2DAbstract& b) const
@@ -80,14 +79,49 @@ void bob::sp::DCT2DAbstract::operator()(const blitz::Array<double,2>& src,
   processNoCheck(src, dst);
 }
 
+void bob::sp::DCT2DAbstract::operator()(blitz::Array<double,2>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
+void bob::sp::DCT2DAbstract::operator()(const blitz::Array<float,2>& src,
+  blitz::Array<float,2>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertZeroBase(src);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst, src);
+
+  // Process
+  processNoCheck(src, dst);
+}
+
+void bob::sp::DCT2DAbstract::operator()(blitz::Array<float,2>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
 void bob::sp::DCT2DAbstract::setHeight(const size_t height)
 {
   if (height < 1)
     throw std::runtime_error("DCT height should be at least 1.");
   m_height = height;
-  m_buffer_hw.resize(m_height, m_width);
-  m_buffer_h.resize(m_height);
-  m_buffer_h2.resize(m_height);
 }
 
 void bob::sp::DCT2DAbstract::setWidth(const size_t width)
@@ -95,7 +129,6 @@ void bob::sp::DCT2DAbstract::setWidth(const size_t width)
   if (width < 1)
     throw std::runtime_error("DCT width should be at least 1.");
   m_width = width;
-  m_buffer_hw.resize(m_height, m_width);
 }
 
 void bob::sp::DCT2DAbstract::setShape(const size_t height, const size_t width)
@@ -106,9 +139,11 @@ void bob::sp::DCT2DAbstract::setShape(const size_t height, const size_t width)
     throw std::runtime_error("DCT width should be at least 1.");
   m_height = height;
   m_width = width;
-  m_buffer_hw.resize(m_height, m_width);
-  m_buffer_h.resize(m_height);
-  m_buffer_h2.resize(m_height);
+}
+
+void bob::sp::DCT2DAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_engine = engine;
 }
 
 
@@ -131,6 +166,8 @@ bob::sp::DCT2D::DCT2D(const bob::sp::DCT2D& other):
   m_dct_h(other.m_height),
   m_dct_w(other.m_width)
 {
+  m_dct_h.setEngine(m_engine);
+  m_dct_w.setEngine(m_engine);
 }
 
 bob::sp::DCT2D::~DCT2D()
@@ -167,22 +204,42 @@ void bob::sp::DCT2D::setShape(const size_t height, const size_t width)
   m_dct_w.setLength(width);
 }
 
+void bob::sp::DCT2D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_dct_h.setEngine(engine);
+  m_dct_w.setEngine(engine);
+  bob::sp::DCT2DAbstract::setEngine(engine);
+}
+
+template <typename T>
+void bob::sp::DCT2D::process(const blitz::Array<T,2>& src,
+  blitz::Array<T,2>& dst) const
+{
+  blitz::Range rall = blitz::Range::all();
+  // Compute the DCT of the rows, directly into dst (the 1D transforms
+  // support src and dst referring to the same data). Both passes are spread
+  // over m_threads threads: the 1D transforms are reentrant, their scratch
+  // memory being per thread.
+  bob::sp::detail::parallelFor(m_height, m_threads, [&](size_t i) {
+    const blitz::Array<T,1> srci = src((int)i, rall);
+    blitz::Array<T,1> dsti = dst((int)i, rall);
+    m_dct_w(srci, dsti);
+  });
+  // Compute the DCT of the columns, in place, by tiles of columns
+  bob::sp::detail::transformColumns(m_dct_h, dst.data(), m_height, m_width,
+      m_threads);
+}
+
 void bob::sp::DCT2D::processNoCheck(const blitz::Array<double,2>& src,
   blitz::Array<double,2>& dst) const
 {
-  blitz::Range rall = blitz::Range::all();
-  // Compute the DCT
-  for (int i=0; i<(int)m_height; ++i) {
-    const blitz::Array<double,1> srci = src(i, rall);
-    blitz::Array<double,1> bufi = m_buffer_hw(i, rall);
-    m_dct_w(srci, bufi);
-  }
-  for (int j=0; j<(int)m_width; ++j) {
-    m_buffer_h = m_buffer_hw(rall, j);
-    m_dct_h(m_buffer_h, m_buffer_h2);
-    blitz::Array<double,1> dstj = dst(rall, j);
-    dstj = m_buffer_h2;
-  }
+  process(src, dst);
+}
+
+void bob::sp::DCT2D::processNoCheck(const blitz::Array<float,2>& src,
+  blitz::Array<float,2>& dst) const
+{
+  process(src, dst);
 }
 
 
@@ -205,6 +262,8 @@ bob::sp::IDCT2D::IDCT2D(const bob::sp::IDCT2D& other):
   m_idct_h(other.m_height),
   m_idct_w(other.m_width)
 {
+  m_idct_h.setEngine(m_engine);
+  m_idct_w.setEngine(m_engine);
 }
 
 bob::sp::IDCT2D::~IDCT2D()
@@ -241,20 +300,40 @@ void bob::sp::IDCT2D::setShape(const size_t height, const size_t width)
   m_idct_w.setLength(width);
 }
 
+void bob::sp::IDCT2D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_idct_h.setEngine(engine);
+  m_idct_w.setEngine(engine);
+  bob::sp::DCT2DAbstract::setEngine(engine);
+}
+
+template <typename T>
+void bob::sp::IDCT2D::process(const blitz::Array<T,2>& src,
+  blitz::Array<T,2>& dst) const
+{
+  blitz::Range rall = blitz::Range::all();
+  // Compute the DCT of the rows, directly into dst (the 1D transforms
+  // support src and dst referring to the same data). Both passes are spread
+  // over m_threads threads: the 1D transforms are reentrant, their scratch
+  // memory being per thread.
+  bob::sp::detail::parallelFor(m_height, m_threads, [&](size_t i) {
+    const blitz::Array<T,1> srci = src((int)i, rall);
+    blitz::Array<T,1> dsti = dst((int)i, rall);
+    m_idct_w(srci, dsti);
+  });
+  // Compute the DCT of the columns, in place, by tiles of columns
+  bob::sp::detail::transformColumns(m_idct_h, dst.data(), m_height, m_width,
+      m_threads);
+}
+
 void bob::sp::IDCT2D::processNoCheck(const blitz::Array<double,2>& src,
   blitz::Array<double,2>& dst) const
 {
-  blitz::Range rall = blitz::Range::all();
-  // Compute the DCT
-  for (int i=0; i<(int)m_height; ++i) {
-    const blitz::Array<double,1> srci = src(i, rall);
-    blitz::Array<double,1> bufi = m_buffer_hw(i, rall);
-    m_idct_w(srci, bufi);
-  }
-  for (int j=0; j<(int)m_width; ++j) {
-    m_buffer_h = m_buffer_hw(rall, j);
-    m_idct_h(m_buffer_h, m_buffer_h2);
-    blitz::Array<double,1> dstj = dst(rall, j);
-    dstj = m_buffer_h2;
-  }
+  process(src, dst);
+}
+
+void bob::sp::IDCT2D::processNoCheck(const blitz::Array<float,2>& src,
+  blitz::Array<float,2>& dst) const
+{
+  process(src, dst);
 }
@@ -0,0 +1,273 @@
+/**
+ * @date Fri Oct 16 21:52:08 CEST 2026
+ *
+ * @brief N-dimensional Discrete Cosine Transforms, computed as a sequence of
+ * 1D transforms, one per dimension
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/DCTND.h>
+#include <bob.sp/ColumnTiles.h>
+#include <bob.sp/ThreadPool.h>
+
+#include <boost/format.hpp>
+
+namespace {
+
+  void checkShapeValues(const std::vector<size_t>& shape)
+  {
+    if (shape.empty())
+      throw std::runtime_error("DCT shape should have at least one dimension.");
+    for (size_t i=0; i<shape.size(); ++i)
+      if (shape[i] < 1) {
+        boost::format m("DCT size along dimension %d should be at least 1.");
+        m % i;
+        throw std::runtime_error(m.str());
+      }
+  }
+
+}
+
+bob::sp::DCTNDAbstract::DCTNDAbstract():
+  m_shape(1, 1), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+}
+
+bob::sp::DCTNDAbstract::DCTNDAbstract(const std::vector<size_t>& shape):
+  m_shape(shape), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  checkShapeValues(shape);
+}
+
+bob::sp::DCTNDAbstract::DCTNDAbstract(
+    const bob::sp::DCTNDAbstract& other):
+  m_shape(other.m_shape), m_threads(other.m_threads),
+  m_engine(other.m_engine)
+{
+}
+
+bob::sp::DCTNDAbstract::~DCTNDAbstract()
+{
+}
+
+bob::sp::DCTNDAbstract&
+bob::sp::DCTNDAbstract::operator=(const DCTNDAbstract& other)
+{
+  if (this != &other) {
+    setShape(other.m_shape);
+    m_threads = other.m_threads;
+    setEngine(other.m_engine);
+  }
+  return *this;
+}
+
+bool bob::sp::DCTNDAbstract::operator==(const bob::sp::DCTNDAbstract& b) const
+{
+  return (this->m_shape == b.m_shape && this->m_engine == b.m_engine &&
+      this->m_threads == b.m_threads);
+}
+
+bool bob::sp::DCTNDAbstract::operator!=(const bob::sp::DCTNDAbstract& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::DCTNDAbstract::setShape(const std::vector<size_t>& shape)
+{
+  checkShapeValues(shape);
+  m_shape = shape;
+}
+
+void bob::sp::DCTNDAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_engine = engine;
+}
+
+void bob::sp::DCTNDAbstract::checkShape(const int* extents,
+  const int rank) const
+{
+  if ((size_t)rank != m_shape.size()) {
+    boost::format m("Cannot perform a %dD DCT on a %dD array.");
+    m % m_shape.size() % rank;
+    throw std::runtime_error(m.str());
+  }
+  for (int i=0; i<rank; ++i)
+    if ((size_t)extents[i] != m_shape[i]) {
+      boost::format m("Cannot perform a DCT of size %d along dimension %d of an array of size %d along it.");
+      m % m_shape[i] % i % extents[i];
+      throw std::runtime_error(m.str());
+    }
+}
+
+template <typename T, typename F>
+void bob::sp::DCTNDAbstract::process(const std::vector<F>& dcts,
+  const T* src, T* dst) const
+{
+  const size_t rank = m_shape.size();
+  size_t total = 1;
+  for (size_t i=0; i<rank; ++i) total *= m_shape[i];
+
+  // Compute the DCT along the last dimension, from src into dst, one
+  // contiguous row at a time
+  const size_t last = m_shape[rank-1];
+  const blitz::TinyVector<int,1> row(last);
+  bob::sp::detail::parallelFor(total / last, m_threads, [&](size_t i) {
+    const blitz::Array<T,1> s(const_cast<T*>(src) + i*last, row,
+        blitz::neverDeleteData);
+    blitz::Array<T,1> d(dst + i*last, row, blitz::neverDeleteData);
+    dcts[rank-1](s, d);
+  });
+
+  // Compute the DCT along the other dimensions, in place, from the last to
+  // the first one: at each index along the preceding dimensions, the values
+  // form the columns of a C-ordered (length, inner) array. These arrays are
+  // spread over the threads if there are enough of them, their columns
+  // otherwise.
+  const size_t threads = bob::sp::detail::resolveThreads(m_threads);
+  size_t inner = last;
+  for (size_t a=rank-1; a-- > 0; ) {
+    const size_t length = m_shape[a];
+    const size_t outer = total / (length*inner);
+    auto slab = [&](size_t o) {
+      bob::sp::detail::transformColumns(dcts[a], dst + o*length*inner,
+          length, inner, m_threads);
+    };
+    if (length > 1) {
+      if (outer >= threads)
+        bob::sp::detail::parallelFor(outer, m_threads, slab);
+      else
+        for (size_t o=0; o<outer; ++o) slab(o);
+    }
+    inner *= length;
+  }
+}
+
+bob::sp::DCTND::DCTND():
+  bob::sp::DCTNDAbstract()
+{
+  initDCTs();
+}
+
+bob::sp::DCTND::DCTND(const std::vector<size_t>& shape):
+  bob::sp::DCTNDAbstract(shape)
+{
+  initDCTs();
+}
+
+bob::sp::DCTND::DCTND(const bob::sp::DCTND& other):
+  bob::sp::DCTNDAbstract(other)
+{
+  initDCTs();
+}
+
+bob::sp::DCTND::~DCTND()
+{
+}
+
+bob::sp::DCTND&
+bob::sp::DCTND::operator=(const DCTND& other)
+{
+  if (this != &other) {
+    bob::sp::DCTNDAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::DCTND::setShape(const std::vector<size_t>& shape)
+{
+  bob::sp::DCTNDAbstract::setShape(shape);
+  initDCTs();
+}
+
+void bob::sp::DCTND::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  for (size_t i=0; i<m_dct.size(); ++i) m_dct[i].setEngine(engine);
+  bob::sp::DCTNDAbstract::setEngine(engine);
+}
+
+void bob::sp::DCTND::initDCTs()
+{
+  m_dct.clear();
+  for (size_t i=0; i<m_shape.size(); ++i) {
+    m_dct.push_back(bob::sp::DCT1D(m_shape[i]));
+    m_dct.back().setEngine(m_engine);
+  }
+}
+
+void bob::sp::DCTND::processNoCheck(const double* src,
+  double* dst) const
+{
+  process(m_dct, src, dst);
+}
+
+void bob::sp::DCTND::processNoCheck(const float* src,
+  float* dst) const
+{
+  process(m_dct, src, dst);
+}
+
+
+bob::sp::IDCTND::IDCTND():
+  bob::sp::DCTNDAbstract()
+{
+  initDCTs();
+}
+
+bob::sp::IDCTND::IDCTND(const std::vector<size_t>& shape):
+  bob::sp::DCTNDAbstract(shape)
+{
+  initDCTs();
+}
+
+bob::sp::IDCTND::IDCTND(const bob::sp::IDCTND& other):
+  bob::sp::DCTNDAbstract(other)
+{
+  initDCTs();
+}
+
+bob::sp::IDCTND::~IDCTND()
+{
+}
+
+bob::sp::IDCTND&
+bob::sp::IDCTND::operator=(const IDCTND& other)
+{
+  if (this != &other) {
+    bob::sp::DCTNDAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::IDCTND::setShape(const std::vector<size_t>& shape)
+{
+  bob::sp::DCTNDAbstract::setShape(shape);
+  initDCTs();
+}
+
+void bob::sp::IDCTND::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  for (size_t i=0; i<m_idct.size(); ++i) m_idct[i].setEngine(engine);
+  bob::sp::DCTNDAbstract::setEngine(engine);
+}
+
+void bob::sp::IDCTND::initDCTs()
+{
+  m_idct.clear();
+  for (size_t i=0; i<m_shape.size(); ++i) {
+    m_idct.push_back(bob::sp::IDCT1D(m_shape[i]));
+    m_idct.back().setEngine(m_engine);
+  }
+}
+
+void bob::sp::IDCTND::processNoCheck(const double* src,
+  double* dst) const
+{
+  process(m_idct, src, dst);
+}
+
+void bob::sp::IDCTND::processNoCheck(const float* src,
+  float* dst) const
+{
+  process(m_idct, src, dst);
+}
@@ -8,17 +8,114 @@
  */
 
 #include <bob.sp/FFT1D.h>
+#include <bob.sp/FFTBatchPlan.h>
+#include <bob.sp/Workspace.h>
+#include <bob.sp/ThreadPool.h>
+#include <bob.sp/ColumnTiles.h>
 #include <bob.core/assert.h>
-#include <bob.core/array_copy.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/format.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * x * f * scale, f being conjugated if asked. The product is written out,
+   * as the one of std::complex checks for infinities.
+   */
+  template <typename T>
+  inline std::complex<T> product(const std::complex<T>& x,
+    const std::complex<double>& f, const bool conjugate, const T scale)
+  {
+    const T fr = (T)f.real() * scale;
+    const T fi = (conjugate ? -(T)f.imag() : (T)f.imag()) * scale;
+    return std::complex<T>(x.real()*fr - x.imag()*fi,
+        x.real()*fi + x.imag()*fr);
+  }
+
+  /**
+   * Multiplies the n values of x by the factors f (see product()) into y,
+   * which may be x
+   */
+  template <typename T>
+  void modulate(const std::complex<T>* x, const std::complex<double>* f,
+    const bool conjugate, const T scale, const size_t n, std::complex<T>* y)
+  {
+    for (size_t k=0; k<n; ++k) y[k] = product(x[k], f[k], conjugate, scale);
+  }
+
+  /**
+   * Checks the arrays of a batched transform of the given length, along
+   * the given axis
+   */
+  template <typename T>
+  void checkBatch(const blitz::Array<std::complex<T>,2>& src,
+    const blitz::Array<std::complex<T>,2>& dst, const int axis,
+    const size_t length)
+  {
+    if (axis != 0 && axis != 1) {
+      boost::format m("Cannot perform a batched FFT along dimension %d of a 2D array (dimensions are 0 and 1).");
+      m % axis;
+      throw std::runtime_error(m.str());
+    }
+    bob::core::array::assertCZeroBaseContiguous(src);
+    if ((size_t)src.extent(axis) != length) {
+      boost::format m("Cannot perform a batched FFT of length %d along dimension %d of a 2D array of size %d along it.");
+      m % length % axis % src.extent(axis);
+      throw std::runtime_error(m.str());
+    }
+    bob::core::array::assertCZeroBaseContiguous(dst);
+    bob::core::array::assertSameShape(dst, src);
+  }
+
+  /**
+   * The four-step decomposition of the given length, or nothing if it is
+   * not used for it (or for the engine)
+   */
+  boost::shared_ptr<const bob::sp::detail::FourStepFFT> fourStep(
+    const size_t length, const bob::sp::FFTPlanBase::Engine engine)
+  {
+    boost::shared_ptr<const bob::sp::detail::FourStepFFT> r;
+    if (engine != bob::sp::FFTPlanBase::Fftw &&
+        bob::sp::detail::FourStepFFT::split(length))
+      r.reset(new bob::sp::detail::FourStepFFT(length, engine));
+    return r;
+  }
+
+  /**
+   * Single-threaded, the four-step algorithm takes from 0.65 to 1.7 times
+   * as long as a plan of the whole length (measured from 2^20 to 2^24
+   * values, in double and single precision): it is only used when spread
+   * over this number of threads at least
+   */
+  const size_t FOUR_STEP_MIN_THREADS = 3;
+
+  /**
+   * The number of threads over which the four-step algorithm is spread,
+   * given the threads setting of a transform, or 0 if it is not used: the
+   * threads which may run in parallel, bounded by the hardware threads
+   */
+  size_t fourStepThreads(const size_t threads)
+  {
+    const size_t n = std::min(bob::sp::detail::resolveThreads(threads),
+        bob::sp::detail::resolveThreads(0));
+    return n >= FOUR_STEP_MIN_THREADS ? n : 0;
+  }
+
+}
 
 bob::sp::FFT1DAbstract::FFT1DAbstract():
-  m_length(1), m_wsave(4*1+15), m_buffer(2)
+  m_length(1), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack),
+  m_centered(false)
 {
   initWorkingArray();
 }
 
 bob::sp::FFT1DAbstract::FFT1DAbstract(const size_t length):
-  m_length(length), m_wsave(4*length+15), m_buffer(2*length)
+  m_length(length), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack),
+  m_centered(false)
 {
   if (length < 1)
     throw std::runtime_error("FFT length should be at least 1.");
@@ -27,10 +124,11 @@ bob::sp::FFT1DAbstract::FFT1DAbstract(const size_t length):
 
 bob::sp::FFT1DAbstract::FFT1DAbstract(
     const bob::sp::FFT1DAbstract& other):
-  m_length(other.m_length), m_wsave(other.m_wsave.shape()),
-  m_buffer(2*other.m_length)
+  m_length(other.m_length), m_threads(other.m_threads),
+  m_engine(other.m_engine), m_centered(other.m_centered),
+  m_modulation(other.m_modulation), m_plans(other.m_plans),
+  m_four_step(other.m_four_step)
 {
-  m_wsave = bob::core::array::ccopy(other.m_wsave);
 }
 
 bob::sp::FFT1DAbstract::~FFT1DAbstract()
@@ -42,16 +140,20 @@ bob::sp::FFT1DAbstract::operator=(const FFT1DAbstract& other)
 {
   if (this != &other) {
     m_length = other.m_length;
-    m_wsave.resize(other.m_wsave.shape());
-    m_wsave = bob::core::array::ccopy(other.m_wsave);
-    m_buffer.resize(2*other.m_length);
+    m_threads = other.m_threads;
+    m_engine = other.m_engine;
+    m_centered = other.m_centered;
+    m_modulation = other.m_modulation;
+    m_plans = other.m_plans;
+    m_four_step = other.m_four_step;
   }
   return *this;
 }
 
 bool bob::sp::FFT1DAbstract::operator==(const bob::sp::FFT1DAbstract& b) const
 {
-  return (this->m_length == b.m_length);
+  return (this->m_length == b.m_length && this->m_centered == b.m_centered &&
+      this->m_engine == b.m_engine && this->m_threads == b.m_threads);
 }
 
 bool bob::sp::FFT1DAbstract::operator!=(const bob::sp::FFT1DAbstract& b) const
@@ -75,20 +177,260 @@ void bob::sp::FFT1DAbstract::operator()(const blitz::Array<std::complex<double>,
   processNoCheck(src, dst);
 }
 
+void bob::sp::FFT1DAbstract::operator()(blitz::Array<std::complex<double>,1>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
+void bob::sp::FFT1DAbstract::operator()(const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape( dst, src);
+
+  // Process
+  processNoCheck(src, dst);
+}
+
+void bob::sp::FFT1DAbstract::operator()(blitz::Array<std::complex<float>,1>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
+void bob::sp::FFT1DAbstract::operator()(const blitz::Array<std::complex<double>,2>& src,
+  blitz::Array<std::complex<double>,2>& dst, const int axis) const
+{
+  checkBatch(src, dst, axis, m_length);
+  processNoCheck(src, dst, axis);
+}
+
+void bob::sp::FFT1DAbstract::operator()(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst, const int axis) const
+{
+  checkBatch(src, dst, axis, m_length);
+  processNoCheck(src, dst, axis);
+}
+
+template <typename T>
+void bob::sp::FFT1DAbstract::processBatch(const blitz::Array<std::complex<T>,2>& src,
+  blitz::Array<std::complex<T>,2>& dst, const int axis, const bool inverse) const
+{
+  // The k-th value of the signal j is at j*sstride + k*estride
+  const size_t n = m_length;
+  const size_t count = src.extent(1-axis);
+  if (count == 0) return;
+  const size_t sstride = (axis == 1 ? n : 1);
+  const size_t estride = (axis == 1 ? 1 : count);
+  const std::complex<T>* s = src.data();
+  std::complex<T>* d = dst.data();
+  const T scale = (inverse ? (T)1 / (T)n : (T)1);
+  // Factors of the centered mode, applied to the input of the direct
+  // transforms, and to the output of the inverse ones
+  const std::complex<double>* u = (m_centered ? m_modulation.data() : 0);
+
+  // The batch plans are made of fftpack passes: they are not used by the
+  // other engines
+  boost::shared_ptr<const bob::sp::BasicFFTBatchPlan<T> > batch;
+  if (m_engine == bob::sp::FFTPlanBase::Fftpack &&
+      bob::sp::BasicFFTBatchPlan<T>::isSupported(n))
+    batch = bob::sp::BasicFFTBatchPlan<T>::get(n);
+  const size_t L = bob::sp::BasicFFTBatchPlan<T>::getLanes();
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+
+  if (estride == 1) {
+    // Rows are processed by blocks of L. Full blocks are transformed at once
+    // if the length is supported by the batch plans, the others one row at a
+    // time, in place in dst.
+    bob::sp::detail::parallelFor((count + L - 1) / L, m_threads, [&](size_t b) {
+      const size_t j0 = b*L;
+      const size_t nl = std::min(L, count - j0);
+      if (batch && nl == L) {
+        bob::sp::detail::Workspace<T> ws(2*L*n + batch->getWorkSize());
+        T* re = ws.data();
+        T* im = re + L*n;
+        for (size_t l=0; l<L; ++l) {
+          const std::complex<T>* x = s + (j0+l)*sstride;
+          if (u && !inverse)
+            for (size_t k=0; k<n; ++k) {
+              const std::complex<T> v = product(x[k], u[k], true, (T)1);
+              re[k*L+l] = v.real();
+              im[k*L+l] = v.imag();
+            }
+          else
+            for (size_t k=0; k<n; ++k) {
+              re[k*L+l] = x[k].real();
+              im[k*L+l] = x[k].imag();
+            }
+        }
+        if (inverse) batch->backward(re, im, im + L*n);
+        else batch->forward(re, im, im + L*n);
+        for (size_t l=0; l<L; ++l) {
+          std::complex<T>* y = d + (j0+l)*sstride;
+          if (u && inverse)
+            for (size_t k=0; k<n; ++k)
+              y[k] = product(std::complex<T>(re[k*L+l], im[k*L+l]), u[k],
+                  false, scale);
+          else
+            for (size_t k=0; k<n; ++k)
+              y[k] = std::complex<T>(re[k*L+l]*scale, im[k*L+l]*scale);
+        }
+      }
+      else {
+        bob::sp::detail::Workspace<T> ws(plan.getWorkSize());
+        for (size_t l=0; l<nl; ++l) {
+          const std::complex<T>* x = s + (j0+l)*sstride;
+          std::complex<T>* y = d + (j0+l)*sstride;
+          if (inverse) {
+            for (size_t k=0; k<n; ++k) y[k] = x[k] * scale;
+            plan.backward(reinterpret_cast<T*>(y), ws.data());
+            if (u) modulate(y, u, false, (T)1, n, y);
+          }
+          else {
+            if (u) modulate(x, u, true, (T)1, n, y);
+            else if (y != x) std::copy(x, x + n, y);
+            plan.forward(reinterpret_cast<T*>(y), ws.data());
+          }
+        }
+      }
+    });
+    return;
+  }
+
+  // Columns are processed by tiles (see processColumnTiles()), spread over
+  // the threads. In the buffer of a tile, each full block of L columns is
+  // in the split format of the batch plans if the length is supported by
+  // them, the other columns are one after the other (with some padding,
+  // against cache set conflicts), and transformed one at a time.
+  const size_t threads = bob::sp::detail::resolveThreads(m_threads);
+  const size_t B = bob::sp::detail::tileWidth(n, sizeof(std::complex<T>),
+      (count + threads - 1) / threads, L);
+  const size_t ld = n + L/2;
+  const size_t work = std::max(batch ? batch->getWorkSize() : 0,
+      plan.getWorkSize());
+  auto full = [&](size_t nb) { return (batch ? nb / L * L : 0); };
+
+  bob::sp::detail::processColumnTiles<T>(s, d, count*sizeof(std::complex<T>),
+      sizeof(std::complex<T>), n, count, B, m_threads, 2*B*ld, work,
+    [&](T* buf, size_t j0, size_t nb, size_t k) {
+      const std::complex<T>* x = s + j0 + k*estride;
+      const size_t f = full(nb);
+      // The values k of all the columns get the same factor
+      const bool twist = (u && !inverse);
+      for (size_t g=0; g<f; g+=L) {
+        T* re = buf + 2*g*n + k*L;
+        T* im = re + L*n;
+        if (twist)
+          for (size_t l=0; l<L; ++l) {
+            const std::complex<T> v = product(x[g+l], u[k], true, scale);
+            re[l] = v.real();
+            im[l] = v.imag();
+          }
+        else
+          for (size_t l=0; l<L; ++l) {
+            re[l] = x[g+l].real() * scale;
+            im[l] = x[g+l].imag() * scale;
+          }
+      }
+      std::complex<T>* z = reinterpret_cast<std::complex<T>*>(buf + 2*f*n);
+      if (twist)
+        for (size_t l=f; l<nb; ++l)
+          z[(l-f)*ld+k] = product(x[l], u[k], true, scale);
+      else
+        for (size_t l=f; l<nb; ++l) z[(l-f)*ld+k] = x[l] * scale;
+    },
+    [&](T* buf, size_t nb, T* w) {
+      const size_t f = full(nb);
+      for (size_t g=0; g<f; g+=L) {
+        T* re = buf + 2*g*n;
+        if (inverse) batch->backward(re, re + L*n, w);
+        else batch->forward(re, re + L*n, w);
+      }
+      T* z = buf + 2*f*n;
+      for (size_t l=0; l<nb-f; ++l) {
+        if (inverse) plan.backward(z + 2*l*ld, w);
+        else plan.forward(z + 2*l*ld, w);
+      }
+    },
+    [&](const T* buf, size_t j0, size_t nb, size_t k) {
+      std::complex<T>* y = d + j0 + k*estride;
+      const size_t f = full(nb);
+      const bool twist = (u && inverse);
+      for (size_t g=0; g<f; g+=L) {
+        const T* re = buf + 2*g*n + k*L;
+        const T* im = re + L*n;
+        if (twist)
+          for (size_t l=0; l<L; ++l)
+            y[g+l] = product(std::complex<T>(re[l], im[l]), u[k], false, (T)1);
+        else
+          for (size_t l=0; l<L; ++l) y[g+l] = std::complex<T>(re[l], im[l]);
+      }
+      const std::complex<T>* z = reinterpret_cast<const std::complex<T>*>(buf + 2*f*n);
+      if (twist)
+        for (size_t l=f; l<nb; ++l) y[l] = product(z[(l-f)*ld+k], u[k], false, (T)1);
+      else
+        for (size_t l=f; l<nb; ++l) y[l] = z[(l-f)*ld+k];
+    });
+}
+
 void bob::sp::FFT1DAbstract::setLength(const size_t length)
 {
   if (length < 1)
     throw std::runtime_error("FFT length should be at least 1.");
   m_length = length;
-  m_wsave.resize(4*length+15);
   initWorkingArray();
-  m_buffer.resize(2*length);
+}
+
+void bob::sp::FFT1DAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  // The plans are fetched first, as they throw if the engine is not
+  // available
+  m_plans.reset(m_length, bob::sp::FFTPlanBase::Complex, engine);
+  m_four_step = fourStep(m_length, engine);
+  m_engine = engine;
+}
+
+void bob::sp::FFT1DAbstract::setCentered(const bool centered)
+{
+  m_centered = centered;
+  initWorkingArray();
 }
 
 void bob::sp::FFT1DAbstract::initWorkingArray()
 {
-  double *wsave_ptr = m_wsave.data();
-  cffti((int)m_length, wsave_ptr);
+  m_plans.reset(m_length, bob::sp::FFTPlanBase::Complex, m_engine);
+  m_four_step = fourStep(m_length, m_engine);
+
+  // u_n = exp(-2*i*pi*n*floor(N/2)/N), the phase being reduced modulo N
+  // beforehand. They are exactly 1 and -1 for even lengths.
+  m_modulation.clear();
+  if (!m_centered) return;
+  const size_t N = m_length;
+  const double PI = boost::math::constants::pi<double>();
+  m_modulation.resize(N);
+  for (size_t n=0; n<N; ++n) {
+    const size_t r = (n * (N/2)) % N;
+    if (2*r == N) m_modulation[n] = -1.;
+    else if (r == 0) m_modulation[n] = 1.;
+    else m_modulation[n] = std::polar(1., -2. * PI * (double)r / (double)N);
+  }
 }
 
 
@@ -125,20 +467,52 @@ void bob::sp::FFT1D::setLength(const size_t length)
   bob::sp::FFT1DAbstract::setLength(length);
 }
 
+template <typename T>
+void bob::sp::FFT1D::process(const blitz::Array<std::complex<T>,1>& src,
+  blitz::Array<std::complex<T>,1>& dst) const
+{
+  // The huge signals are spread over the threads, if enough of them run
+  // in parallel for the four-step algorithm to be faster
+  const size_t threads = m_four_step ? fourStepThreads(m_threads) : 0;
+  if (threads) {
+    m_four_step->transform(src.data(), dst.data(), false,
+        m_centered ? m_modulation.data() : 0, threads);
+    return;
+  }
+  // std::complex arrays are already interleaved as expected by fftpack: the
+  // FFT is computed directly on dst
+  if (m_centered)
+    modulate(src.data(), m_modulation.data(), true, (T)1, m_length, dst.data());
+  else if (dst.data() != src.data())
+    std::copy(src.data(), src.data() + m_length, dst.data());
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  bob::sp::detail::Workspace<T> ws(plan.getWorkSize());
+  plan.forward(reinterpret_cast<T*>(dst.data()), ws.data());
+}
+
 void bob::sp::FFT1D::processNoCheck(const blitz::Array<std::complex<double>,1>& src,
   blitz::Array<std::complex<double>,1>& dst) const
 {
-  // Compute the FFT
-  blitz::Range r1(0, 2*m_length-2, 2);
-  blitz::Range r2(1, 2*m_length-1, 2);
-  m_buffer(r1) = blitz::real(src);
-  m_buffer(r2) = blitz::imag(src);
-  double *buf_ptr = m_buffer.data();
-  double *wsave_ptr = const_cast<double*>(m_wsave.data());
-  cfftf(m_length, buf_ptr, wsave_ptr);
-  dst = m_buffer(r1) + std::complex<double>(0.,1.) * m_buffer(r2);
+  process(src, dst);
+}
+
+void bob::sp::FFT1D::processNoCheck(const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  process(src, dst);
 }
 
+void bob::sp::FFT1D::processNoCheck(const blitz::Array<std::complex<double>,2>& src,
+  blitz::Array<std::complex<double>,2>& dst, const int axis) const
+{
+  processBatch(src, dst, axis, false);
+}
+
+void bob::sp::FFT1D::processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst, const int axis) const
+{
+  processBatch(src, dst, axis, false);
+}
 
 bob::sp::IFFT1D::IFFT1D():
   bob::sp::FFT1DAbstract(1)
@@ -174,17 +548,51 @@ void bob::sp::IFFT1D::setLength(const size_t length)
   bob::sp::FFT1DAbstract::setLength(length);
 }
 
+template <typename T>
+void bob::sp::IFFT1D::process(const blitz::Array<std::complex<T>,1>& src,
+  blitz::Array<std::complex<T>,1>& dst) const
+{
+  // The huge signals are spread over the threads, if enough of them run
+  // in parallel for the four-step algorithm to be faster
+  const size_t threads = m_four_step ? fourStepThreads(m_threads) : 0;
+  if (threads) {
+    m_four_step->transform(src.data(), dst.data(), true,
+        m_centered ? m_modulation.data() : 0, threads);
+    return;
+  }
+  // std::complex arrays are already interleaved as expected by fftpack: the
+  // FFT is computed directly on dst, the 1/N normalization being applied (by
+  // linearity) while copying the input
+  const T scale = (T)1 / (T)m_length;
+  const std::complex<T>* s = src.data();
+  std::complex<T>* d = dst.data();
+  for (size_t i=0; i<m_length; ++i) d[i] = s[i] * scale;
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  bob::sp::detail::Workspace<T> ws(plan.getWorkSize());
+  plan.backward(reinterpret_cast<T*>(d), ws.data());
+  if (m_centered) modulate(d, m_modulation.data(), false, (T)1, m_length, d);
+}
+
 void bob::sp::IFFT1D::processNoCheck(const blitz::Array<std::complex<double>,1>& src,
   blitz::Array<std::complex<double>,1>& dst) const
 {
-  // Compute the FFT
-  blitz::Range r1(0, 2*m_length-2, 2);
-  blitz::Range r2(1, 2*m_length-1, 2);
-  m_buffer(r1) = blitz::real(src);
-  m_buffer(r2) = blitz::imag(src);
-  double *buf_ptr = m_buffer.data();
-  double *wsave_ptr = const_cast<double*>(m_wsave.data());
-  cfftb(m_length, buf_ptr, wsave_ptr);
-  dst = m_buffer(r1) + std::complex<double>(0.,1.) * m_buffer(r2);
-  dst /= (double)m_length;
+  process(src, dst);
+}
+
+void bob::sp::IFFT1D::processNoCheck(const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::IFFT1D::processNoCheck(const blitz::Array<std::complex<double>,2>& src,
+  blitz::Array<std::complex<double>,2>& dst, const int axis) const
+{
+  processBatch(src, dst, axis, true);
+}
+
+void bob::sp::IFFT1D::processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst, const int axis) const
+{
+  processBatch(src, dst, axis, true);
 }
@@ -8,19 +8,20 @@
  */
 
 #include <bob.sp/FFT2D.h>
+#include <bob.sp/ThreadPool.h>
 #include <bob.core/assert.h>
+#include <bob.core/array_check.h>
 
 bob::sp::FFT2DAbstract::FFT2DAbstract():
-  m_height(1), m_width(1),
-  m_buffer_hw(1,1), m_buffer_h(1), m_buffer_h2(1)
+  m_height(1), m_width(1), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack),
+  m_centered(false)
 {
 }
 
 bob::sp::FFT2DAbstract::FFT2DAbstract(
     const size_t height, const size_t width):
-  m_height(height), m_width(width),
-  m_buffer_hw(height, width), m_buffer_h(height),
-  m_buffer_h2(height)
+  m_height(height), m_width(width), m_threads(1),
+  m_engine(bob::sp::FFTPlanBase::Fftpack), m_centered(false)
 {
   if (m_height < 1)
     throw std::runtime_error("DCT height should be at least 1.");
@@ -31,8 +32,8 @@ bob::sp::FFT2DAbstract::FFT2DAbstract(
 bob::sp::FFT2DAbstract::FFT2DAbstract(
     const bob::sp::FFT2DAbstract& other):
   m_height(other.m_height), m_width(other.m_width),
-  m_buffer_hw(other.m_height, other.m_width), m_buffer_h(other.m_height),
-  m_buffer_h2(other.m_height)
+  m_threads(other.m_threads), m_engine(other.m_engine),
+  m_centered(other.m_centered)
 {
 }
 
@@ -46,16 +47,18 @@ bob::sp::FFT2DAbstract::operator=(const FFT2DAbstract& other)
   if (this != &other) {
     setHeight(other.m_height);
     setWidth(other.m_width);
-    m_buffer_hw.resize(other.m_height, other.m_width);
-    m_buffer_h.resize(other.m_height);
-    m_buffer_h2.resize(other.m_height);
+    setThreads(other.m_threads);
+    setEngine(other.m_engine);
+    setCentered(other.m_centered);
   }
   return *this;
 }
 
 bool bob::sp::FFT2DAbstract::operator==(const bob::sp::FFT2DAbstract& b) const
 {
-  return (this->m_height == b.m_height && this->m_width == b.m_width);
+  return (this->m_height == b.m_height && this->m_width == b.m_width &&
+      this->m_centered == b.m_centered && this->m_engine == b.m_engine &&
+      this->m_threads == b.m_threads);
 }
 
 bool bob::sp::FFT2DAbstract::operator!=(const bob::sp::FFT2DAbstract& b) const
@@ -79,14 +82,49 @@ void bob::sp::FFT2DAbstract::operator()(const blitz::Array<std::complex<double>,
   processNoCheck(src, dst);
 }
 
+void bob::sp::FFT2DAbstract::operator()(blitz::Array<std::complex<double>,2>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
+void bob::sp::FFT2DAbstract::operator()(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertZeroBase(src);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst, src);
+
+  // Process
+  processNoCheck(src, dst);
+}
+
+void bob::sp::FFT2DAbstract::operator()(blitz::Array<std::complex<float>,2>& src_dst) const
+{
+  // Check input/output, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src_dst);
+  const blitz::TinyVector<int,2> shape(m_height,m_width);
+  bob::core::array::assertSameShape(src_dst, shape);
+
+  // Process
+  processNoCheck(src_dst, src_dst);
+}
+
 void bob::sp::FFT2DAbstract::setHeight(const size_t height)
 {
   if (height < 1)
     throw std::runtime_error("DCT height should be at least 1.");
   m_height = height;
-  m_buffer_hw.resize(m_height, m_width);
-  m_buffer_h.resize(m_height);
-  m_buffer_h2.resize(m_height);
 }
 
 void bob::sp::FFT2DAbstract::setWidth(const size_t width)
@@ -94,7 +132,6 @@ void bob::sp::FFT2DAbstract::setWidth(const size_t width)
   if (width < 1)
     throw std::runtime_error("DCT width should be at least 1.");
   m_width = width;
-  m_buffer_hw.resize(m_height, m_width);
 }
 
 void bob::sp::FFT2DAbstract::setShape(const size_t height, const size_t width)
@@ -105,9 +142,21 @@ void bob::sp::FFT2DAbstract::setShape(const size_t height, const size_t width)
     throw std::runtime_error("DCT width should be at least 1.");
   m_height = height;
   m_width = width;
-  m_buffer_hw.resize(height, width);
-  m_buffer_h.resize(height);
-  m_buffer_h2.resize(height);
+}
+
+void bob::sp::FFT2DAbstract::setThreads(const size_t threads)
+{
+  m_threads = threads;
+}
+
+void bob::sp::FFT2DAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_engine = engine;
+}
+
+void bob::sp::FFT2DAbstract::setCentered(const bool centered)
+{
+  m_centered = centered;
 }
 
 
@@ -129,6 +178,12 @@ bob::sp::FFT2D::FFT2D(const bob::sp::FFT2D& other):
   m_fft_h(other.m_height),
   m_fft_w(other.m_width)
 {
+  m_fft_h.setEngine(m_engine);
+  m_fft_w.setEngine(m_engine);
+  m_fft_h.setThreads(m_threads);
+  m_fft_w.setThreads(m_threads);
+  m_fft_h.setCentered(m_centered);
+  m_fft_w.setCentered(m_centered);
 }
 
 bob::sp::FFT2D::~FFT2D()
@@ -165,22 +220,61 @@ void bob::sp::FFT2D::setShape(const size_t height, const size_t width)
   m_fft_w.setLength(width);
 }
 
+void bob::sp::FFT2D::setThreads(const size_t threads)
+{
+  bob::sp::FFT2DAbstract::setThreads(threads);
+  m_fft_h.setThreads(threads);
+  m_fft_w.setThreads(threads);
+}
+
+void bob::sp::FFT2D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_fft_h.setEngine(engine);
+  m_fft_w.setEngine(engine);
+  bob::sp::FFT2DAbstract::setEngine(engine);
+}
+
+void bob::sp::FFT2D::setCentered(const bool centered)
+{
+  // The shifts along both dimensions are done by the 1D transforms
+  m_fft_h.setCentered(centered);
+  m_fft_w.setCentered(centered);
+  bob::sp::FFT2DAbstract::setCentered(centered);
+}
+
+template <typename T>
+void bob::sp::FFT2D::process(const blitz::Array<std::complex<T>,2>& src,
+  blitz::Array<std::complex<T>,2>& dst) const
+{
+  // Compute the FFT of the rows, directly into dst (the 1D transforms
+  // support src and dst referring to the same data), as a batch if src is
+  // C-ordered, or one row at a time. Both passes are spread over m_threads
+  // threads: the plans are shared, and the scratch memory is per thread.
+  if (bob::core::array::isCZeroBaseContiguous(src))
+    m_fft_w(src, dst, 1);
+  else {
+    blitz::Range rall = blitz::Range::all();
+    bob::sp::detail::parallelFor(m_height, m_threads, [&](size_t i) {
+      const blitz::Array<std::complex<T>,1> srci = src((int)i, rall);
+      blitz::Array<std::complex<T>,1> dsti = dst((int)i, rall);
+      m_fft_w(srci, dsti);
+    });
+  }
+  // Compute the FFT of the columns, in place, as a batch along the first
+  // dimension, which is processed by tiles of columns
+  m_fft_h(dst, dst, 0);
+}
+
 void bob::sp::FFT2D::processNoCheck(const blitz::Array<std::complex<double>,2>& src,
   blitz::Array<std::complex<double>,2>& dst) const
 {
-  blitz::Range rall = blitz::Range::all();
-  // Compute the FFT
-  for (int i=0; i<(int)m_height; ++i) {
-    const blitz::Array<std::complex<double>,1> srci = src(i, rall);
-    blitz::Array<std::complex<double>,1> bufi = m_buffer_hw(i, rall);
-    m_fft_w(srci, bufi);
-  }
-  for (int j=0; j<(int)m_width; ++j) {
-    m_buffer_h = m_buffer_hw(rall, j);
-    m_fft_h(m_buffer_h, m_buffer_h2);
-    blitz::Array<std::complex<double>,1> dstj = dst(rall, j);
-    dstj = m_buffer_h2;
-  }
+  process(src, dst);
+}
+
+void bob::sp::FFT2D::processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  process(src, dst);
 }
 
 
@@ -202,6 +296,12 @@ bob::sp::IFFT2D::IFFT2D(const bob::sp::IFFT2D& other):
   m_ifft_h(other.m_height),
   m_ifft_w(other.m_width)
 {
+  m_ifft_h.setEngine(m_engine);
+  m_ifft_w.setEngine(m_engine);
+  m_ifft_h.setThreads(m_threads);
+  m_ifft_w.setThreads(m_threads);
+  m_ifft_h.setCentered(m_centered);
+  m_ifft_w.setCentered(m_centered);
 }
 
 bob::sp::IFFT2D::~IFFT2D()
@@ -238,20 +338,59 @@ void bob::sp::IFFT2D::setShape(const size_t height, const size_t width)
   m_ifft_w.setLength(width);
 }
 
+void bob::sp::IFFT2D::setThreads(const size_t threads)
+{
+  bob::sp::FFT2DAbstract::setThreads(threads);
+  m_ifft_h.setThreads(threads);
+  m_ifft_w.setThreads(threads);
+}
+
+void bob::sp::IFFT2D::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_ifft_h.setEngine(engine);
+  m_ifft_w.setEngine(engine);
+  bob::sp::FFT2DAbstract::setEngine(engine);
+}
+
+void bob::sp::IFFT2D::setCentered(const bool centered)
+{
+  // The shifts along both dimensions are done by the 1D transforms
+  m_ifft_h.setCentered(centered);
+  m_ifft_w.setCentered(centered);
+  bob::sp::FFT2DAbstract::setCentered(centered);
+}
+
+template <typename T>
+void bob::sp::IFFT2D::process(const blitz::Array<std::complex<T>,2>& src,
+  blitz::Array<std::complex<T>,2>& dst) const
+{
+  // Compute the FFT of the rows, directly into dst (the 1D transforms
+  // support src and dst referring to the same data), as a batch if src is
+  // C-ordered, or one row at a time. Both passes are spread over m_threads
+  // threads: the plans are shared, and the scratch memory is per thread.
+  if (bob::core::array::isCZeroBaseContiguous(src))
+    m_ifft_w(src, dst, 1);
+  else {
+    blitz::Range rall = blitz::Range::all();
+    bob::sp::detail::parallelFor(m_height, m_threads, [&](size_t i) {
+      const blitz::Array<std::complex<T>,1> srci = src((int)i, rall);
+      blitz::Array<std::complex<T>,1> dsti = dst((int)i, rall);
+      m_ifft_w(srci, dsti);
+    });
+  }
+  // Compute the FFT of the columns, in place, as a batch along the first
+  // dimension, which is processed by tiles of columns
+  m_ifft_h(dst, dst, 0);
+}
+
 void bob::sp::IFFT2D::processNoCheck(const blitz::Array<std::complex<double>,2>& src,
   blitz::Array<std::complex<double>,2>& dst) const
 {
-  blitz::Range rall = blitz::Range::all();
-  // Compute the FFT
-  for (int i=0; i<(int)m_height; ++i) {
-    const blitz::Array<std::complex<double>,1> srci = src(i, rall);
-    blitz::Array<std::complex<double>,1> bufi = m_buffer_hw(i, rall);
-    m_ifft_w(srci, bufi);
-  }
-  for (int j=0; j<(int)m_width; ++j) {
-    m_buffer_h = m_buffer_hw(rall, j);
-    m_ifft_h(m_buffer_h, m_buffer_h2);
-    blitz::Array<std::complex<double>,1> dstj = dst(rall, j);
-    dstj = m_buffer_h2;
-  }
+  process(src, dst);
+}
+
+void bob::sp::IFFT2D::processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  process(src, dst);
 }
@@ -0,0 +1,194 @@
+/**
+ * @date Fri Oct 16 18:12:36 CEST 2026
+ *
+ * @brief Immutable, process-wide shared plans for batched 1D complex Fast
+ * Fourier Transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTBatchPlan.h>
+#include <bob.sp/fftpack.h>
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <boost/weak_ptr.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * Weak references to the plans alive, indexed by length, for each
+   * precision
+   */
+  template <typename T>
+  struct BatchPlanCache {
+    typedef std::unordered_map<size_t,
+      boost::weak_ptr<const bob::sp::BasicFFTBatchPlan<T> > > plan_map_t;
+    std::mutex mutex;
+    plan_map_t plans;
+  };
+
+  template <typename T>
+  BatchPlanCache<T>& cache() {
+    static BatchPlanCache<T> s_cache;
+    return s_cache;
+  }
+
+  /**
+   * Vectorized passes, in double and single precision
+   */
+  template <typename T> struct batch;
+
+  template <> struct batch<double> {
+    static void stage(int p, int m, int sl, const double* xr, const double* xi,
+        double* yr, double* yi, const double* twr, const double* twi,
+        const double* rootr, const double* rooti, int isign)
+    { fftpack_batch_stage(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti, isign); }
+  };
+
+  template <> struct batch<float> {
+    static void stage(int p, int m, int sl, const float* xr, const float* xi,
+        float* yr, float* yi, const float* twr, const float* twi,
+        const float* rootr, const float* rooti, int isign)
+    { fftpack_batch_stage_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti, isign); }
+  };
+
+  /**
+   * Radices of the passes: as many 4 as possible, then 2, 3, 5 and the
+   * remaining prime factors
+   */
+  std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> res;
+    while (n % 4 == 0) { res.push_back(4); n /= 4; }
+    for (size_t p=2; p*p<=n; ++p)
+      while (n % p == 0) { res.push_back(p); n /= p; }
+    if (n > 1) res.push_back(n);
+    return res;
+  }
+
+}
+
+template <typename T>
+boost::shared_ptr<const bob::sp::BasicFFTBatchPlan<T> >
+bob::sp::BasicFFTBatchPlan<T>::get(const size_t length)
+{
+  if (!isSupported(length))
+    throw std::runtime_error("batched FFTs are not supported for this length.");
+
+  typedef typename BatchPlanCache<T>::plan_map_t plan_map_t;
+  BatchPlanCache<T>& c = cache<T>();
+  std::lock_guard<std::mutex> lock(c.mutex);
+  typename plan_map_t::iterator it = c.plans.find(length);
+  if (it != c.plans.end()) {
+    boost::shared_ptr<const BasicFFTBatchPlan> plan = it->second.lock();
+    if (plan) return plan;
+  }
+
+  for (typename plan_map_t::iterator jt = c.plans.begin(); jt != c.plans.end(); ) {
+    if (jt->second.expired()) jt = c.plans.erase(jt);
+    else ++jt;
+  }
+
+  boost::shared_ptr<const BasicFFTBatchPlan> plan(new BasicFFTBatchPlan(length));
+  c.plans[length] = plan;
+  return plan;
+}
+
+template <typename T>
+bool bob::sp::BasicFFTBatchPlan<T>::isSupported(const size_t length)
+{
+  // The batch and the work array of the passes should fit in the L1 cache
+  // (48 kB): beyond that, the passes are limited by the L2 cache bandwidth,
+  // and fftpack transforms (of one signal at a time) are faster
+  return length >= 1 && 4*getLanes()*length*sizeof(T) <= 49152 &&
+    !FFTPlanBase::useBluestein(length);
+}
+
+template <typename T>
+bob::sp::BasicFFTBatchPlan<T>::BasicFFTBatchPlan(const size_t length):
+  m_length(length)
+{
+  // Pass with radix p over sub-transforms of length l = p*m: twiddle
+  // factors exp(-2i*pi*i*t/l) for i < m and 0 < t < p, computed in double
+  // precision (i*t being reduced modulo l beforehand)
+  const double PI = boost::math::constants::pi<double>();
+  const std::vector<size_t> radices = factorize(length);
+  size_t l = length;
+  for (size_t k=0; k<radices.size(); ++k) {
+    Pass pass;
+    pass.radix = radices[k];
+    pass.m = l / pass.radix;
+    pass.twiddles = m_twr.size();
+    pass.roots = m_rootr.size();
+    for (size_t i=0; i<pass.m; ++i)
+      for (size_t t=1; t<pass.radix; ++t) {
+        const double arg = 2. * PI * (double)((i*t) % l) / (double)l;
+        m_twr.push_back((T)cos(arg));
+        m_twi.push_back((T)sin(arg));
+      }
+    if (pass.radix > 5)
+      for (size_t t=0; t<pass.radix; ++t) {
+        const double arg = 2. * PI * (double)t / (double)pass.radix;
+        m_rootr.push_back((T)cos(arg));
+        m_rooti.push_back((T)sin(arg));
+      }
+    m_passes.push_back(pass);
+    l = pass.m;
+  }
+  // Keeps valid pointers for lengths without any pass or root
+  m_twr.push_back(0);
+  m_twi.push_back(0);
+  m_rootr.push_back(0);
+  m_rooti.push_back(0);
+}
+
+template <typename T>
+bob::sp::BasicFFTBatchPlan<T>::~BasicFFTBatchPlan()
+{
+}
+
+template <typename T>
+void bob::sp::BasicFFTBatchPlan<T>::forward(T* re, T* im, T* work) const
+{
+  transform(re, im, work, -1);
+}
+
+template <typename T>
+void bob::sp::BasicFFTBatchPlan<T>::backward(T* re, T* im, T* work) const
+{
+  transform(re, im, work, +1);
+}
+
+template <typename T>
+void bob::sp::BasicFFTBatchPlan<T>::transform(T* re, T* im, T* work,
+  const int isign) const
+{
+  // The passes go back and forth between the batch and the work array
+  const size_t size = getLanes()*m_length;
+  T* xr = re;
+  T* xi = im;
+  T* yr = work;
+  T* yi = work + size;
+  size_t sl = getLanes();
+  for (size_t k=0; k<m_passes.size(); ++k) {
+    const Pass& pass = m_passes[k];
+    batch<T>::stage((int)pass.radix, (int)pass.m, (int)sl, xr, xi, yr, yi,
+        m_twr.data() + pass.twiddles, m_twi.data() + pass.twiddles,
+        m_rootr.data() + pass.roots, m_rooti.data() + pass.roots, isign);
+    std::swap(xr, yr);
+    std::swap(xi, yi);
+    sl *= pass.radix;
+  }
+  if (xr != re) {
+    std::copy(xr, xr + size, re);
+    std::copy(xi, xi + size, im);
+  }
+}
+
+// Instantiations provided by the library
+template class bob::sp::BasicFFTBatchPlan<double>;
+template class bob::sp::BasicFFTBatchPlan<float>;
@@ -0,0 +1,455 @@
+/**
+ * @date Sat Oct 17 20:14:52 CEST 2026
+ *
+ * @brief Straight-line (fully unrolled) complex FFTs of the small lengths
+ * whose factors are 2, 3 and 5, generated at compile time
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTBackend.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * The codelets are only straight-line code if all their steps are inlined,
+ * which the compilers do not do by themselves for the largest lengths
+ */
+#if defined(__GNUC__)
+#define CODELET_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define CODELET_INLINE __forceinline
+#else
+#define CODELET_INLINE inline
+#endif
+
+namespace {
+
+  /**
+   * Sine and cosine of 2*pi*t (t being a fraction of a turn), evaluated by
+   * the compiler: the argument is reduced to the first octant, where the
+   * Taylor series converge quickly
+   */
+  constexpr double PI = 3.141592653589793238462643383279502884;
+
+  constexpr double series(const double x2, const double term, const int i) {
+    return (i > 27) ? term :
+      term + series(x2, -term * x2 / ((i+1) * (i+2)), i+2);
+  }
+
+  constexpr double sinTurn(const double t);
+
+  constexpr double cosTurn(const double t) {
+    return (t > 0.5) ? cosTurn(1. - t) :
+      (t > 0.25) ? -cosTurn(0.5 - t) :
+      (t > 0.125) ? sinTurn(0.25 - t) :
+      series((2*PI*t) * (2*PI*t), 1., 0);
+  }
+
+  constexpr double sinTurn(const double t) {
+    return (t > 0.5) ? -sinTurn(1. - t) :
+      (t > 0.25) ? sinTurn(0.5 - t) :
+      (t > 0.125) ? cosTurn(0.25 - t) :
+      series((2*PI*t) * (2*PI*t), 2*PI*t, 1);
+  }
+
+  /**
+   * Radix of the last pass of a transform of length n
+   */
+  constexpr size_t radixOf(const size_t n) {
+    return (n % 4 == 0) ? 4 : (n % 2 == 0) ? 2 : (n % 3 == 0) ? 3 : 5;
+  }
+
+  /**
+   * Calls F<I>::apply(a...) for I = Begin, ..., End-1, the loop being
+   * unrolled at compile time
+   */
+  template <size_t Begin, size_t End>
+  struct Unroll {
+    template <template <size_t> class F, typename... A>
+    static CODELET_INLINE void apply(A... a) {
+      F<Begin>::apply(a...);
+      Unroll<Begin+1,End>::template apply<F>(a...);
+    }
+  };
+
+  template <size_t End>
+  struct Unroll<End,End> {
+    template <template <size_t> class F, typename... A>
+    static CODELET_INLINE void apply(A...) {}
+  };
+
+  /**
+   * Complex values held in registers, and the arithmetic of the codelets:
+   * an SSE2 vector (re, im) when available, two scalars otherwise
+   */
+  template <typename T> struct Cx { T re; T im; };
+
+  template <typename T> struct Register { typedef Cx<T> type; };
+
+  template <typename T>
+  CODELET_INLINE Cx<T> load(const T* p) {
+    Cx<T> r = { p[0], p[1] };
+    return r;
+  }
+
+  template <typename T>
+  CODELET_INLINE void store(T* p, const Cx<T>& a) {
+    p[0] = a.re;
+    p[1] = a.im;
+  }
+
+  template <typename T>
+  CODELET_INLINE Cx<T> add(const Cx<T>& a, const Cx<T>& b) {
+    Cx<T> r = { a.re + b.re, a.im + b.im };
+    return r;
+  }
+
+  template <typename T>
+  CODELET_INLINE Cx<T> sub(const Cx<T>& a, const Cx<T>& b) {
+    Cx<T> r = { a.re - b.re, a.im - b.im };
+    return r;
+  }
+
+  template <typename T>
+  CODELET_INLINE Cx<T> scale(const Cx<T>& a, const double s) {
+    Cx<T> r = { a.re * (T)s, a.im * (T)s };
+    return r;
+  }
+
+  /**
+   * sign*i*a
+   */
+  template <int Sign, typename T>
+  CODELET_INLINE Cx<T> rotate(const Cx<T>& a) {
+    Cx<T> r = { -Sign * a.im, Sign * a.re };
+    return r;
+  }
+
+  /**
+   * a*(wr + i*wi)
+   */
+  template <typename T>
+  CODELET_INLINE Cx<T> mul(const Cx<T>& a, const double wr, const double wi) {
+    Cx<T> r = { a.re * (T)wr - a.im * (T)wi, a.re * (T)wi + a.im * (T)wr };
+    return r;
+  }
+
+#if defined(__SSE2__)
+
+  // Single precision values only use the two lowest lanes of the vectors
+  template <> struct Register<double> { typedef __m128d type; };
+  template <> struct Register<float> { typedef __m128 type; };
+
+  CODELET_INLINE __m128d load(const double* p) { return _mm_loadu_pd(p); }
+  CODELET_INLINE void store(double* p, const __m128d a) { _mm_storeu_pd(p, a); }
+  CODELET_INLINE __m128d add(const __m128d a, const __m128d b) { return _mm_add_pd(a, b); }
+  CODELET_INLINE __m128d sub(const __m128d a, const __m128d b) { return _mm_sub_pd(a, b); }
+  CODELET_INLINE __m128d scale(const __m128d a, const double s) { return _mm_mul_pd(a, _mm_set1_pd(s)); }
+
+  template <int Sign>
+  CODELET_INLINE __m128d rotate(const __m128d a) {
+    return _mm_xor_pd(_mm_shuffle_pd(a, a, 1),
+        _mm_setr_pd(Sign > 0 ? -0. : 0., Sign > 0 ? 0. : -0.));
+  }
+
+  CODELET_INLINE __m128d mul(const __m128d a, const double wr, const double wi) {
+    return _mm_add_pd(_mm_mul_pd(a, _mm_set1_pd(wr)),
+        _mm_mul_pd(_mm_shuffle_pd(a, a, 1), _mm_setr_pd(-wi, wi)));
+  }
+
+  CODELET_INLINE __m128 load(const float* p) {
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+  }
+  CODELET_INLINE void store(float* p, const __m128 a) {
+    _mm_storel_pi(reinterpret_cast<__m64*>(p), a);
+  }
+  CODELET_INLINE __m128 add(const __m128 a, const __m128 b) { return _mm_add_ps(a, b); }
+  CODELET_INLINE __m128 sub(const __m128 a, const __m128 b) { return _mm_sub_ps(a, b); }
+  CODELET_INLINE __m128 scale(const __m128 a, const double s) { return _mm_mul_ps(a, _mm_set1_ps((float)s)); }
+
+  template <int Sign>
+  CODELET_INLINE __m128 rotate(const __m128 a) {
+    return _mm_xor_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+        _mm_setr_ps(Sign > 0 ? -0.f : 0.f, Sign > 0 ? 0.f : -0.f, 0.f, 0.f));
+  }
+
+  CODELET_INLINE __m128 mul(const __m128 a, const double wr, const double wi) {
+    return _mm_add_ps(_mm_mul_ps(a, _mm_set1_ps((float)wr)),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+          _mm_setr_ps((float)-wi, (float)wi, 0.f, 0.f)));
+  }
+
+#endif
+
+  /**
+   * Multiplication by the twiddle factor exp(sign*2*i*pi*e/n). The factors
+   * which are multiples of an eighth of a turn only need additions and
+   * (at most) one multiplication by sqrt(1/2).
+   */
+  template <typename T, size_t N, size_t E, int Sign,
+    int Eighth = ((8*E) % N == 0) ? (int)(8*E/N) : -1>
+  struct Twiddle {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) {
+      constexpr double wr = cosTurn((double)E / N);
+      constexpr double wi = Sign * sinTurn((double)E / N);
+      return mul(a, wr, wi);
+    }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,0> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) { return a; }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,1> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) {
+      return scale(add(a, rotate<Sign>(a)), sinTurn(0.125));
+    }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,2> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) { return rotate<Sign>(a); }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,3> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) {
+      return scale(sub(rotate<Sign>(a), a), sinTurn(0.125));
+    }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,4> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) { return sub(a, add(a, a)); }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,5> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) {
+      return scale(add(a, rotate<Sign>(a)), -sinTurn(0.125));
+    }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,6> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) { return rotate<-Sign>(a); }
+  };
+
+  template <typename T, size_t N, size_t E, int Sign>
+  struct Twiddle<T,N,E,Sign,7> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE V apply(const V& a) {
+      return scale(sub(a, rotate<Sign>(a)), sinTurn(0.125));
+    }
+  };
+
+  /**
+   * DFT of the R values x (in-place), with the roots exp(sign*2*i*pi/R)
+   */
+  template <typename T, size_t R, int Sign> struct Radix;
+
+  template <typename T, int Sign>
+  struct Radix<T,2,Sign> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE void apply(V* x) {
+      const V a = x[0];
+      x[0] = add(a, x[1]);
+      x[1] = sub(a, x[1]);
+    }
+  };
+
+  template <typename T, int Sign>
+  struct Radix<T,3,Sign> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE void apply(V* x) {
+      const V s = add(x[1], x[2]);
+      const V d = rotate<Sign>(scale(sub(x[1], x[2]), sinTurn(1. / 3.)));
+      const V m = sub(x[0], scale(s, 0.5));
+      x[0] = add(x[0], s);
+      x[1] = add(m, d);
+      x[2] = sub(m, d);
+    }
+  };
+
+  template <typename T, int Sign>
+  struct Radix<T,4,Sign> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE void apply(V* x) {
+      const V a = add(x[0], x[2]), b = sub(x[0], x[2]);
+      const V c = add(x[1], x[3]), d = rotate<Sign>(sub(x[1], x[3]));
+      x[0] = add(a, c);
+      x[1] = add(b, d);
+      x[2] = sub(a, c);
+      x[3] = sub(b, d);
+    }
+  };
+
+  template <typename T, int Sign>
+  struct Radix<T,5,Sign> {
+    typedef typename Register<T>::type V;
+    static CODELET_INLINE void apply(V* x) {
+      constexpr double c1 = cosTurn(1. / 5.), c2 = cosTurn(2. / 5.);
+      constexpr double s1 = sinTurn(1. / 5.), s2 = sinTurn(2. / 5.);
+      const V a = add(x[1], x[4]), b = sub(x[1], x[4]);
+      const V c = add(x[2], x[3]), d = sub(x[2], x[3]);
+      const V t1 = add(x[0], add(scale(a, c1), scale(c, c2)));
+      const V t2 = add(x[0], add(scale(a, c2), scale(c, c1)));
+      const V u1 = rotate<Sign>(add(scale(b, s1), scale(d, s2)));
+      const V u2 = rotate<Sign>(sub(scale(b, s2), scale(d, s1)));
+      x[0] = add(x[0], add(a, c));
+      x[1] = add(t1, u1);
+      x[4] = sub(t1, u1);
+      x[2] = add(t2, u2);
+      x[3] = sub(t2, u2);
+    }
+  };
+
+  /**
+   * Loads the values p_(j*stride) (interleaved complex numbers) multiplied
+   * by the twiddle factors exp(sign*2*i*pi*j*k/n), or stores them
+   */
+  template <typename T, size_t Stride, size_t N, size_t K, int Sign>
+  struct Load {
+    typedef typename Register<T>::type V;
+    template <size_t J> struct At {
+      static CODELET_INLINE void apply(const T* p, V* x) {
+        x[J] = Twiddle<T,N,(J*K)%N,Sign>::apply(load(p + 2*J*Stride));
+      }
+    };
+  };
+
+  template <typename T, size_t Stride>
+  struct Store {
+    typedef typename Register<T>::type V;
+    template <size_t J> struct At {
+      static CODELET_INLINE void apply(T* p, const V* x) {
+        store(p + 2*J*Stride, x[J]);
+      }
+    };
+  };
+
+  /**
+   * Decimation in time FFT of the N values in_(j*S) into out (contiguous),
+   * the last pass being of radix R = radixOf(N): the R interleaved
+   * subsequences are transformed into the consecutive blocks of length
+   * M = N/R of out, which are then combined by M twiddled butterflies.
+   * All the loops are unrolled, and the twiddle factors are constants.
+   */
+  template <typename T, size_t N, size_t S, int Sign,
+    size_t R = radixOf(N), bool Leaf = (N == R)>
+  struct Codelet {
+    static const size_t M = N / R;
+
+    template <size_t J> struct Split {
+      static CODELET_INLINE void apply(const T* in, T* out) {
+        Codelet<T,M,S*R,Sign>::apply(in + 2*J*S, out + 2*J*M);
+      }
+    };
+
+    template <size_t K> struct Butterfly {
+      static CODELET_INLINE void apply(T* out) {
+        typename Register<T>::type x[R];
+        Unroll<0,R>::template apply<Load<T,M,N,K,Sign>::template At>(
+            (const T*)(out + 2*K), x);
+        Radix<T,R,Sign>::apply(x);
+        Unroll<0,R>::template apply<Store<T,M>::template At>(out + 2*K,
+            (const typename Register<T>::type*)x);
+      }
+    };
+
+    static CODELET_INLINE void apply(const T* in, T* out) {
+      Unroll<0,R>::template apply<Split>(in, out);
+      Unroll<0,M>::template apply<Butterfly>(out);
+    }
+  };
+
+  template <typename T, size_t N, size_t S, int Sign, size_t R>
+  struct Codelet<T,N,S,Sign,R,true> {
+    static CODELET_INLINE void apply(const T* in, T* out) {
+      typename Register<T>::type x[R];
+      Unroll<0,R>::template apply<Load<T,S,N,0,Sign>::template At>(in, x);
+      Radix<T,R,Sign>::apply(x);
+      Unroll<0,R>::template apply<Store<T,1>::template At>(out,
+          (const typename Register<T>::type*)x);
+    }
+  };
+
+  /**
+   * The backend of the codelets of a given length: the signal is copied to
+   * the work array, from which the codelet writes its transform back
+   */
+  template <typename T, size_t N>
+  class CodeletBackend: public bob::sp::detail::FFTBackend<T>
+  {
+    public:
+      virtual size_t getWorkSize() const
+      {
+        return 2*N;
+      }
+
+      virtual void forward(T* data, T* work) const
+      {
+        std::copy(data, data + 2*N, work);
+        Codelet<T,N,1,-1>::apply(work, data);
+      }
+
+      virtual void backward(T* data, T* work) const
+      {
+        std::copy(data, data + 2*N, work);
+        Codelet<T,N,1,1>::apply(work, data);
+      }
+  };
+
+}
+
+template <typename T>
+bob::sp::detail::FFTBackend<T>* bob::sp::detail::newCodeletBackend(const size_t length)
+{
+  switch (length) {
+    case 2: return new CodeletBackend<T,2>();
+    case 3: return new CodeletBackend<T,3>();
+    case 4: return new CodeletBackend<T,4>();
+    case 5: return new CodeletBackend<T,5>();
+    case 6: return new CodeletBackend<T,6>();
+    case 8: return new CodeletBackend<T,8>();
+    case 9: return new CodeletBackend<T,9>();
+    case 10: return new CodeletBackend<T,10>();
+    case 12: return new CodeletBackend<T,12>();
+    case 15: return new CodeletBackend<T,15>();
+    case 16: return new CodeletBackend<T,16>();
+    case 18: return new CodeletBackend<T,18>();
+    case 20: return new CodeletBackend<T,20>();
+    case 24: return new CodeletBackend<T,24>();
+    case 25: return new CodeletBackend<T,25>();
+    case 27: return new CodeletBackend<T,27>();
+    case 30: return new CodeletBackend<T,30>();
+    case 32: return new CodeletBackend<T,32>();
+    case 36: return new CodeletBackend<T,36>();
+    case 40: return new CodeletBackend<T,40>();
+    case 45: return new CodeletBackend<T,45>();
+    case 48: return new CodeletBackend<T,48>();
+    case 50: return new CodeletBackend<T,50>();
+    case 54: return new CodeletBackend<T,54>();
+    case 60: return new CodeletBackend<T,60>();
+    case 64: return new CodeletBackend<T,64>();
+    default: return 0;
+  }
+}
+
+template bob::sp::detail::FFTBackend<double>* bob::sp::detail::newCodeletBackend<double>(const size_t);
+template bob::sp::detail::FFTBackend<float>* bob::sp::detail::newCodeletBackend<float>(const size_t);
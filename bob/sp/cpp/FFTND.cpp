@@ -0,0 +1,292 @@
+/**
+ * @date Fri Oct 16 21:14:52 CEST 2026
+ *
+ * @brief N-dimensional Fast Fourier Transforms, computed as a sequence of
+ * batched 1D transforms, one per dimension
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTND.h>
+#include <bob.sp/ThreadPool.h>
+
+#include <boost/format.hpp>
+
+namespace {
+
+  void checkShapeValues(const std::vector<size_t>& shape)
+  {
+    if (shape.empty())
+      throw std::runtime_error("FFT shape should have at least one dimension.");
+    for (size_t i=0; i<shape.size(); ++i)
+      if (shape[i] < 1) {
+        boost::format m("FFT size along dimension %d should be at least 1.");
+        m % i;
+        throw std::runtime_error(m.str());
+      }
+  }
+
+}
+
+bob::sp::FFTNDAbstract::FFTNDAbstract():
+  m_shape(1, 1), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+}
+
+bob::sp::FFTNDAbstract::FFTNDAbstract(const std::vector<size_t>& shape):
+  m_shape(shape), m_threads(1), m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  checkShapeValues(shape);
+}
+
+bob::sp::FFTNDAbstract::FFTNDAbstract(
+    const bob::sp::FFTNDAbstract& other):
+  m_shape(other.m_shape), m_threads(other.m_threads),
+  m_engine(other.m_engine)
+{
+}
+
+bob::sp::FFTNDAbstract::~FFTNDAbstract()
+{
+}
+
+bob::sp::FFTNDAbstract&
+bob::sp::FFTNDAbstract::operator=(const FFTNDAbstract& other)
+{
+  if (this != &other) {
+    setShape(other.m_shape);
+    setThreads(other.m_threads);
+    setEngine(other.m_engine);
+  }
+  return *this;
+}
+
+bool bob::sp::FFTNDAbstract::operator==(const bob::sp::FFTNDAbstract& b) const
+{
+  return (this->m_shape == b.m_shape && this->m_engine == b.m_engine &&
+      this->m_threads == b.m_threads);
+}
+
+bool bob::sp::FFTNDAbstract::operator!=(const bob::sp::FFTNDAbstract& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::FFTNDAbstract::setShape(const std::vector<size_t>& shape)
+{
+  checkShapeValues(shape);
+  m_shape = shape;
+}
+
+void bob::sp::FFTNDAbstract::setThreads(const size_t threads)
+{
+  m_threads = threads;
+}
+
+void bob::sp::FFTNDAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  m_engine = engine;
+}
+
+void bob::sp::FFTNDAbstract::checkShape(const int* extents,
+  const int rank) const
+{
+  if ((size_t)rank != m_shape.size()) {
+    boost::format m("Cannot perform a %dD FFT on a %dD array.");
+    m % m_shape.size() % rank;
+    throw std::runtime_error(m.str());
+  }
+  for (int i=0; i<rank; ++i)
+    if ((size_t)extents[i] != m_shape[i]) {
+      boost::format m("Cannot perform a FFT of size %d along dimension %d of an array of size %d along it.");
+      m % m_shape[i] % i % extents[i];
+      throw std::runtime_error(m.str());
+    }
+}
+
+template <typename T, typename F>
+void bob::sp::FFTNDAbstract::process(const std::vector<F>& ffts,
+  const std::complex<T>* src, std::complex<T>* dst) const
+{
+  const size_t rank = m_shape.size();
+  size_t total = 1;
+  for (size_t i=0; i<rank; ++i) total *= m_shape[i];
+
+  // Compute the FFT along the last dimension, from src into dst, as a batch
+  // of contiguous rows
+  const size_t last = m_shape[rank-1];
+  const blitz::TinyVector<int,2> rows(total / last, last);
+  const blitz::Array<std::complex<T>,2> src2(const_cast<std::complex<T>*>(src),
+      rows, blitz::neverDeleteData);
+  blitz::Array<std::complex<T>,2> dst2(dst, rows, blitz::neverDeleteData);
+  ffts[rank-1](src2, dst2, 1);
+
+  // Compute the FFT along the other dimensions, in place, from the last to
+  // the first one: at each index along the preceding dimensions, the values
+  // form the columns of a C-ordered (length, inner) array. These arrays are
+  // spread over the threads if there are enough of them, their columns
+  // otherwise.
+  const size_t threads = bob::sp::detail::resolveThreads(m_threads);
+  size_t inner = last;
+  for (size_t a=rank-1; a-- > 0; ) {
+    const size_t length = m_shape[a];
+    const size_t outer = total / (length*inner);
+    const blitz::TinyVector<int,2> columns(length, inner);
+    auto slab = [&](size_t o) {
+      blitz::Array<std::complex<T>,2> d(dst + o*length*inner, columns,
+          blitz::neverDeleteData);
+      ffts[a](d, d, 0);
+    };
+    if (length > 1) {
+      if (outer >= threads)
+        bob::sp::detail::parallelFor(outer, m_threads, slab);
+      else
+        for (size_t o=0; o<outer; ++o) slab(o);
+    }
+    inner *= length;
+  }
+}
+
+
+bob::sp::FFTND::FFTND():
+  bob::sp::FFTNDAbstract()
+{
+  initFFTs();
+}
+
+bob::sp::FFTND::FFTND(const std::vector<size_t>& shape):
+  bob::sp::FFTNDAbstract(shape)
+{
+  initFFTs();
+}
+
+bob::sp::FFTND::FFTND(const bob::sp::FFTND& other):
+  bob::sp::FFTNDAbstract(other)
+{
+  initFFTs();
+}
+
+bob::sp::FFTND::~FFTND()
+{
+}
+
+bob::sp::FFTND&
+bob::sp::FFTND::operator=(const FFTND& other)
+{
+  if (this != &other) {
+    bob::sp::FFTNDAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::FFTND::setShape(const std::vector<size_t>& shape)
+{
+  bob::sp::FFTNDAbstract::setShape(shape);
+  initFFTs();
+}
+
+void bob::sp::FFTND::setThreads(const size_t threads)
+{
+  bob::sp::FFTNDAbstract::setThreads(threads);
+  for (size_t i=0; i<m_fft.size(); ++i) m_fft[i].setThreads(threads);
+}
+
+void bob::sp::FFTND::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  for (size_t i=0; i<m_fft.size(); ++i) m_fft[i].setEngine(engine);
+  bob::sp::FFTNDAbstract::setEngine(engine);
+}
+
+void bob::sp::FFTND::initFFTs()
+{
+  m_fft.clear();
+  for (size_t i=0; i<m_shape.size(); ++i) {
+    m_fft.push_back(bob::sp::FFT1D(m_shape[i]));
+    m_fft.back().setThreads(m_threads);
+    m_fft.back().setEngine(m_engine);
+  }
+}
+
+void bob::sp::FFTND::processNoCheck(const std::complex<double>* src,
+  std::complex<double>* dst) const
+{
+  process(m_fft, src, dst);
+}
+
+void bob::sp::FFTND::processNoCheck(const std::complex<float>* src,
+  std::complex<float>* dst) const
+{
+  process(m_fft, src, dst);
+}
+
+
+bob::sp::IFFTND::IFFTND():
+  bob::sp::FFTNDAbstract()
+{
+  initFFTs();
+}
+
+bob::sp::IFFTND::IFFTND(const std::vector<size_t>& shape):
+  bob::sp::FFTNDAbstract(shape)
+{
+  initFFTs();
+}
+
+bob::sp::IFFTND::IFFTND(const bob::sp::IFFTND& other):
+  bob::sp::FFTNDAbstract(other)
+{
+  initFFTs();
+}
+
+bob::sp::IFFTND::~IFFTND()
+{
+}
+
+bob::sp::IFFTND&
+bob::sp::IFFTND::operator=(const IFFTND& other)
+{
+  if (this != &other) {
+    bob::sp::FFTNDAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::IFFTND::setShape(const std::vector<size_t>& shape)
+{
+  bob::sp::FFTNDAbstract::setShape(shape);
+  initFFTs();
+}
+
+void bob::sp::IFFTND::setThreads(const size_t threads)
+{
+  bob::sp::FFTNDAbstract::setThreads(threads);
+  for (size_t i=0; i<m_ifft.size(); ++i) m_ifft[i].setThreads(threads);
+}
+
+void bob::sp::IFFTND::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  for (size_t i=0; i<m_ifft.size(); ++i) m_ifft[i].setEngine(engine);
+  bob::sp::FFTNDAbstract::setEngine(engine);
+}
+
+void bob::sp::IFFTND::initFFTs()
+{
+  m_ifft.clear();
+  for (size_t i=0; i<m_shape.size(); ++i) {
+    m_ifft.push_back(bob::sp::IFFT1D(m_shape[i]));
+    m_ifft.back().setThreads(m_threads);
+    m_ifft.back().setEngine(m_engine);
+  }
+}
+
+void bob::sp::IFFTND::processNoCheck(const std::complex<double>* src,
+  std::complex<double>* dst) const
+{
+  process(m_ifft, src, dst);
+}
+
+void bob::sp::IFFTND::processNoCheck(const std::complex<float>* src,
+  std::complex<float>* dst) const
+{
+  process(m_ifft, src, dst);
+}
@@ -0,0 +1,516 @@
+/**
+ * @date Fri Oct 16 09:12:41 CEST 2026
+ *
+ * @brief Immutable, process-wide shared plans for the 1D Fast Fourier
+ * Transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTPlan.h>
+#include <bob.sp/StockhamFFT.h>
+#include <bob.sp/fftpack.h>
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <boost/weak_ptr.hpp>
+#include <boost/format.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * Plans are indexed by length, the kind and the engine being stored in
+   * the three lowest bits (Real plans always use fftpack)
+   */
+  size_t planKey(const size_t length, const bob::sp::FFTPlanBase::Kind kind,
+    const bob::sp::FFTPlanBase::Engine engine) {
+    return 8*length + (kind == bob::sp::FFTPlanBase::Real ? 4 : 0) +
+      (size_t)engine;
+  }
+
+  /**
+   * The cache only keeps weak references: plans are released as soon as no
+   * transform uses them anymore. Expired entries are purged on insertion.
+   * There is one cache per precision.
+   */
+  template <typename T>
+  struct PlanCache {
+    typedef std::unordered_map<size_t,
+      boost::weak_ptr<const bob::sp::BasicFFTPlan<T> > > plan_map_t;
+    std::mutex mutex;
+    plan_map_t plans;
+  };
+
+  template <typename T>
+  PlanCache<T>& cache() {
+    static PlanCache<T> s_cache;
+    return s_cache;
+  }
+
+  /**
+   * Entry points of the double and single precision builds of fftpack
+   */
+  template <typename T> struct fftpack;
+
+  template <> struct fftpack<double> {
+    static void cffti(int n, double* plan) { cffti_plan(n, plan); }
+    static int cffti(int n, double* plan, int nf, const int* factors)
+    { return cffti_plan_factors(n, plan, nf, factors); }
+    static void cfftf(int n, double* c, double* w, const double* plan)
+    { cfftf_plan(n, c, w, plan); }
+    static void cfftb(int n, double* c, double* w, const double* plan)
+    { cfftb_plan(n, c, w, plan); }
+    static void rffti(int n, double* plan) { rffti_plan(n, plan); }
+    static void rfftf(int n, double* r, double* w, const double* plan)
+    { rfftf_plan(n, r, w, plan); }
+    static void rfftb(int n, double* r, double* w, const double* plan)
+    { rfftb_plan(n, r, w, plan); }
+  };
+
+  template <> struct fftpack<float> {
+    static void cffti(int n, float* plan) { cffti_plan_float(n, plan); }
+    static int cffti(int n, float* plan, int nf, const int* factors)
+    { return cffti_plan_factors_float(n, plan, nf, factors); }
+    static void cfftf(int n, float* c, float* w, const float* plan)
+    { cfftf_plan_float(n, c, w, plan); }
+    static void cfftb(int n, float* c, float* w, const float* plan)
+    { cfftb_plan_float(n, c, w, plan); }
+    static void rffti(int n, float* plan) { rffti_plan_float(n, plan); }
+    static void rfftf(int n, float* r, float* w, const float* plan)
+    { rfftf_plan_float(n, r, w, plan); }
+    static void rfftb(int n, float* r, float* w, const float* plan)
+    { rfftb_plan_float(n, r, w, plan); }
+  };
+
+  /**
+   * The fftpack backend, for both kinds of plans. The factors of complex
+   * plans may be given in a specific order (default one if empty).
+   */
+  template <typename T>
+  class FftpackBackend: public bob::sp::detail::FFTBackend<T>
+  {
+    public:
+      FftpackBackend(const size_t length, const bob::sp::FFTPlanBase::Kind kind,
+          const std::vector<int>& factors=std::vector<int>()):
+        m_length(length), m_kind(kind)
+      {
+        if (m_kind == bob::sp::FFTPlanBase::Complex) {
+          m_plan.resize(2*length+15);
+          if (factors.empty())
+            fftpack<T>::cffti((int)m_length, m_plan.data());
+          else if (fftpack<T>::cffti((int)m_length, m_plan.data(),
+                (int)factors.size(), factors.data()) != 0) {
+            boost::format m("invalid fftpack factorization of the length %lu");
+            m % length;
+            throw std::runtime_error(m.str());
+          }
+        }
+        else {
+          m_plan.resize(length+15);
+          fftpack<T>::rffti((int)m_length, m_plan.data());
+        }
+      }
+
+      virtual size_t getWorkSize() const
+      {
+        return (m_kind == bob::sp::FFTPlanBase::Complex ? 2*m_length : m_length);
+      }
+
+      virtual void forward(T* data, T* work) const
+      {
+        if (m_kind == bob::sp::FFTPlanBase::Complex)
+          fftpack<T>::cfftf((int)m_length, data, work, m_plan.data());
+        else fftpack<T>::rfftf((int)m_length, data, work, m_plan.data());
+      }
+
+      virtual void backward(T* data, T* work) const
+      {
+        if (m_kind == bob::sp::FFTPlanBase::Complex)
+          fftpack<T>::cfftb((int)m_length, data, work, m_plan.data());
+        else fftpack<T>::rfftb((int)m_length, data, work, m_plan.data());
+      }
+
+    private:
+      size_t m_length;
+      bob::sp::FFTPlanBase::Kind m_kind;
+      std::vector<T> m_plan;
+  };
+
+  /**
+   * Rough cost of a direct fftpack transform of length n: each pass over a
+   * factor p costs about n*p operations. The radix 2, 3, 4 and 5 passes are
+   * specialized, but the generic pass is quadratic in p.
+   */
+  double directCost(size_t n) {
+    double res = 0.;
+    while (n % 4 == 0) { res += 4.; n /= 4; }
+    for (size_t p=2; p*p<=n; ++p)
+      while (n % p == 0) { res += (double)p; n /= p; }
+    if (n > 1) res += (double)n;
+    return res;
+  }
+
+}
+
+template <typename T>
+bob::sp::detail::FFTBackend<T>* bob::sp::detail::newFftpackBackend(
+    const size_t length, const std::vector<int>& factors)
+{
+  return new FftpackBackend<T>(length, FFTPlanBase::Complex, factors);
+}
+
+template <typename T>
+boost::shared_ptr<const bob::sp::BasicFFTPlan<T> >
+bob::sp::BasicFFTPlan<T>::get(const size_t length, const Kind kind,
+  Engine engine)
+{
+  if (length < 1)
+    throw std::runtime_error("FFT length should be at least 1.");
+  if (kind == Real) engine = Fftpack;
+  if (!isAvailable(engine))
+    throw std::runtime_error("bob.sp was compiled without FFTW3 support (BOB_SP_HAVE_FFTW3)");
+
+  typedef typename PlanCache<T>::plan_map_t plan_map_t;
+  PlanCache<T>& c = cache<T>();
+  const size_t key = planKey(length, kind, engine);
+  {
+    std::lock_guard<std::mutex> lock(c.mutex);
+    typename plan_map_t::iterator it = c.plans.find(key);
+    if (it != c.plans.end()) {
+      boost::shared_ptr<const BasicFFTPlan> plan = it->second.lock();
+      if (plan) return plan;
+    }
+  }
+
+  // The plan is built without holding the lock, as building a Bluestein
+  // plan requires another plan
+  boost::shared_ptr<const BasicFFTPlan> plan(new BasicFFTPlan(length, kind,
+        engine));
+
+  std::lock_guard<std::mutex> lock(c.mutex);
+  typename plan_map_t::iterator it = c.plans.find(key);
+  if (it != c.plans.end()) {
+    // Another thread may have been faster
+    boost::shared_ptr<const BasicFFTPlan> other = it->second.lock();
+    if (other) return other;
+  }
+
+  for (typename plan_map_t::iterator jt = c.plans.begin(); jt != c.plans.end(); ) {
+    if (jt->second.expired()) jt = c.plans.erase(jt);
+    else ++jt;
+  }
+
+  c.plans[key] = plan;
+  return plan;
+}
+
+template <typename T>
+size_t bob::sp::BasicFFTPlan<T>::getCacheSize()
+{
+  typedef typename PlanCache<T>::plan_map_t plan_map_t;
+  PlanCache<T>& c = cache<T>();
+  std::lock_guard<std::mutex> lock(c.mutex);
+  size_t res = 0;
+  for (typename plan_map_t::const_iterator it = c.plans.begin(); it != c.plans.end(); ++it)
+    if (!it->second.expired()) ++res;
+  return res;
+}
+
+bool bob::sp::FFTPlanBase::isAvailable(const Engine engine)
+{
+  return (engine != Fftw || bob::sp::detail::hasFFTW());
+}
+
+void bob::sp::FFTPlanBase::importTuning(const std::string& filename)
+{
+  bob::sp::detail::importFFTTuning(filename);
+}
+
+void bob::sp::FFTPlanBase::exportTuning(const std::string& filename)
+{
+  bob::sp::detail::exportFFTTuning(filename);
+}
+
+void bob::sp::FFTPlanBase::importWisdom(const std::string& filename)
+{
+  bob::sp::detail::importFFTWWisdom(filename);
+}
+
+void bob::sp::FFTPlanBase::exportWisdom(const std::string& filename)
+{
+  bob::sp::detail::exportFFTWWisdom(filename);
+}
+
+size_t bob::sp::FFTPlanBase::nextSmoothLength(const size_t n)
+{
+  size_t best = 1;
+  while (best < n) best *= 2;
+  for (size_t p5=1; p5<best; p5*=5)
+    for (size_t p35=p5; p35<best; p35*=3) {
+      size_t m = p35;
+      while (m < n) m *= 2;
+      if (m < best) best = m;
+    }
+  return best;
+}
+
+size_t bob::sp::FFTPlanBase::nextFastLength(const size_t n,
+    const Engine engine)
+{
+  const size_t smooth = nextSmoothLength(n);
+  size_t best = smooth;
+  double best_cost = (double)best * directCost(best);
+  // Smallest multiple >= n of each odd 7-smooth number below it
+  for (size_t p7=1; p7<smooth; p7*=7)
+    for (size_t p5=p7; p5<smooth; p5*=5)
+      for (size_t p3=p5; p3<smooth; p3*=3) {
+        size_t m = p3;
+        while (m < n) m *= 2;
+        if (m >= smooth) continue;
+        const double cost = (double)m * directCost(m);
+        if (engine == Fftw ? m < best : cost < best_cost) {
+          best = m;
+          best_cost = cost;
+        }
+      }
+  return best;
+}
+
+bool bob::sp::FFTPlanBase::useBluestein(const size_t length)
+{
+  const size_t m = nextFastLength(2*length-1);
+  const double direct = (double)length * directCost(length);
+  // Three transforms of length m, plus the pointwise products
+  const double bluestein = (double)m * (3. * directCost(m) + 6.);
+  return bluestein < direct;
+}
+
+template <typename T>
+bob::sp::BasicFFTPlan<T>::BasicFFTPlan(const size_t length, const Kind kind,
+    const Engine engine):
+  m_length(length), m_kind(kind), m_engine(engine),
+  // FFTW has its own algorithms for the lengths with large prime factors
+  m_bluestein(engine != Fftw && useBluestein(length))
+{
+  // The codelets are faster than any other engine at their (small)
+  // lengths, which then do not need to be measured
+  if (m_kind == Complex && (m_engine == Fftpack || m_engine == Tuned)) {
+    m_backend.reset(bob::sp::detail::newCodeletBackend<T>(m_length));
+    if (m_backend) return;
+  }
+
+  if (m_bluestein) initBluestein();
+  else if (m_engine == Stockham) {
+    bob::sp::detail::StockhamFFT<T>* stockham =
+      new bob::sp::detail::StockhamFFT<T>();
+    m_backend.reset(stockham);
+    stockham->init(m_length);
+  }
+  else if (m_engine == Fftw)
+    m_backend.reset(bob::sp::detail::newFFTWBackend<T>(m_length));
+  else if (m_engine == Tuned)
+    m_backend.reset(bob::sp::detail::newTunedBackend<T>(m_length));
+  else
+    m_backend.reset(new FftpackBackend<T>(m_length, m_kind));
+}
+
+template <typename T>
+bob::sp::BasicFFTPlan<T>::~BasicFFTPlan()
+{
+}
+
+template <typename T>
+size_t bob::sp::BasicFFTPlan<T>::getWorkSize() const
+{
+  if (m_bluestein) {
+    // Convolution buffer and work array of the inner transform, plus a
+    // complex copy of the signal for real transforms
+    const size_t res = 2*m_sub->getLength() + m_sub->getWorkSize();
+    return (m_kind == Complex ? res : res + 2*m_length);
+  }
+  return m_backend->getWorkSize();
+}
+
+template <typename T>
+void bob::sp::BasicFFTPlan<T>::forward(T* data, T* work) const
+{
+  if (m_bluestein) {
+    if (m_kind == Complex) bluestein(data, work, false);
+    else realBluestein(data, work, false);
+  }
+  else m_backend->forward(data, work);
+}
+
+template <typename T>
+void bob::sp::BasicFFTPlan<T>::backward(T* data, T* work) const
+{
+  if (m_bluestein) {
+    if (m_kind == Complex) bluestein(data, work, true);
+    else realBluestein(data, work, true);
+  }
+  else m_backend->backward(data, work);
+}
+
+template <typename T>
+void bob::sp::BasicFFTPlan<T>::initBluestein()
+{
+  const size_t n = m_length;
+  m_sub = get(nextFastLength(2*n-1, m_engine), Complex, m_engine);
+  const size_t m = m_sub->getLength();
+
+  // Chirp c_k = exp(-i*pi*k^2/n). k^2 is reduced modulo 2n beforehand, to
+  // keep the accuracy for large k.
+  const double PI = boost::math::constants::pi<double>();
+  std::vector<double> chirp(2*n);
+  for (size_t k=0; k<n; ++k) {
+    const double arg = PI * (double)((k*k) % (2*n)) / (double)n;
+    chirp[2*k] = cos(arg);
+    chirp[2*k+1] = -sin(arg);
+  }
+
+  // Convolution kernel: FFT of the conjugate chirp, wrapped around to
+  // length m, and normalized by 1/m for the inverse transform. It is always
+  // computed in double precision.
+  std::vector<double> kernel(2*m, 0.);
+  kernel[0] = chirp[0] / m;
+  kernel[1] = -chirp[1] / m;
+  for (size_t k=1; k<n; ++k) {
+    kernel[2*k] = kernel[2*(m-k)] = chirp[2*k] / m;
+    kernel[2*k+1] = kernel[2*(m-k)+1] = -chirp[2*k+1] / m;
+  }
+  boost::shared_ptr<const FFTPlan> sub = FFTPlan::get(m, Complex);
+  std::vector<double> work(sub->getWorkSize());
+  sub->forward(kernel.data(), work.data());
+
+  m_chirp.assign(chirp.begin(), chirp.end());
+  m_kernel.assign(kernel.begin(), kernel.end());
+}
+
+template <typename T>
+void bob::sp::BasicFFTPlan<T>::bluestein(T* data, T* work,
+  const bool inverse) const
+{
+  // The inverse transform is obtained by conjugating the input and the
+  // output of the direct one
+  const size_t n = m_length;
+  const size_t m = m_sub->getLength();
+  const T sign = (inverse ? -1 : 1);
+  const T* c = m_chirp.data();
+  const T* b = m_kernel.data();
+  T* a = work;
+
+  // a = [x*c 0]
+  for (size_t k=0; k<n; ++k) {
+    const T re = data[2*k], im = sign*data[2*k+1];
+    a[2*k] = re*c[2*k] - im*c[2*k+1];
+    a[2*k+1] = re*c[2*k+1] + im*c[2*k];
+  }
+  std::fill(a + 2*n, a + 2*m, (T)0);
+
+  // a = ifft(fft(a) * b)
+  m_sub->forward(a, work + 2*m);
+  for (size_t k=0; k<m; ++k) {
+    const T re = a[2*k], im = a[2*k+1];
+    a[2*k] = re*b[2*k] - im*b[2*k+1];
+    a[2*k+1] = re*b[2*k+1] + im*b[2*k];
+  }
+  m_sub->backward(a, work + 2*m);
+
+  // x = a*c
+  for (size_t k=0; k<n; ++k) {
+    const T re = a[2*k], im = a[2*k+1];
+    data[2*k] = re*c[2*k] - im*c[2*k+1];
+    data[2*k+1] = sign*(re*c[2*k+1] + im*c[2*k]);
+  }
+}
+
+template <typename T>
+void bob::sp::BasicFFTPlan<T>::realBluestein(T* data, T* work,
+  const bool inverse) const
+{
+  // The real transforms go through a complex transform of the same length,
+  // from/to the fftpack halfcomplex order
+  const size_t n = m_length;
+  T* z = work;
+  if (!inverse) {
+    for (size_t k=0; k<n; ++k) { z[2*k] = data[k]; z[2*k+1] = 0; }
+    bluestein(z, work + 2*n, false);
+    data[0] = z[0];
+    std::copy(z + 2, z + n + 1, data + 1);
+  }
+  else {
+    z[0] = data[0];
+    z[1] = 0;
+    for (size_t k=1; 2*k<n; ++k) {
+      z[2*k] = z[2*(n-k)] = data[2*k-1];
+      z[2*k+1] = data[2*k];
+      z[2*(n-k)+1] = -data[2*k];
+    }
+    if (n % 2 == 0) {
+      z[n] = data[n-1];
+      z[n+1] = 0;
+    }
+    bluestein(z, work + 2*n, true);
+    for (size_t k=0; k<n; ++k) data[k] = z[2*k];
+  }
+}
+
+bob::sp::detail::FFTPlans::FFTPlans():
+  m_float_ptr(0)
+{
+}
+
+bob::sp::detail::FFTPlans::FFTPlans(const FFTPlans& other):
+  m_double(other.m_double), m_float_ptr(0)
+{
+  std::lock_guard<std::mutex> lock(other.m_mutex);
+  m_float = other.m_float;
+  m_float_ptr.store(m_float.get(), std::memory_order_release);
+}
+
+bob::sp::detail::FFTPlans&
+bob::sp::detail::FFTPlans::operator=(const FFTPlans& other)
+{
+  if (this != &other) {
+    boost::shared_ptr<const FFTPlanFloat> plan;
+    {
+      std::lock_guard<std::mutex> lock(other.m_mutex);
+      plan = other.m_float;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_double = other.m_double;
+    m_float = plan;
+    m_float_ptr.store(m_float.get(), std::memory_order_release);
+  }
+  return *this;
+}
+
+void bob::sp::detail::FFTPlans::reset(const size_t length,
+  const FFTPlanBase::Kind kind, const FFTPlanBase::Engine engine)
+{
+  m_double = FFTPlan::get(length, kind, engine);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_float.reset();
+  m_float_ptr.store(0, std::memory_order_release);
+}
+
+const bob::sp::FFTPlanFloat& bob::sp::detail::FFTPlans::fetchFloat() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_float) {
+    m_float = FFTPlanFloat::get(m_double->getLength(), m_double->getKind(),
+        m_double->getEngine());
+    m_float_ptr.store(m_float.get(), std::memory_order_release);
+  }
+  return *m_float;
+}
+
+// Instantiations provided by the library
+template class bob::sp::BasicFFTPlan<double>;
+template class bob::sp::BasicFFTPlan<float>;
+template bob::sp::detail::FFTBackend<double>* bob::sp::detail::newFftpackBackend<double>(const size_t, const std::vector<int>&);
+template bob::sp::detail::FFTBackend<float>* bob::sp::detail::newFftpackBackend<float>(const size_t, const std::vector<int>&);
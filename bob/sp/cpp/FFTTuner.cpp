@@ -0,0 +1,312 @@
+/**
+ * @date Sat Oct 17 11:02:37 CEST 2026
+ *
+ * @brief Measured (tuned) backend of the complex 1D Fast Fourier Transforms,
+ * and persistence of its measurements
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTBackend.h>
+#include <bob.sp/StockhamFFT.h>
+#include <bob.sp/fftpack.h>
+
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <boost/shared_ptr.hpp>
+#include <boost/format.hpp>
+
+namespace {
+
+  /**
+   * The backend chosen for a length: the Stockham engine, or fftpack with
+   * the given order of the factors
+   */
+  struct Choice {
+    bool stockham;
+    std::vector<int> factors;
+  };
+
+  /**
+   * The choices made so far (measured or imported), for each length. There
+   * is one table per precision.
+   */
+  struct TuningTable {
+    typedef std::map<size_t, Choice> choice_map_t;
+    std::mutex mutex;
+    choice_map_t choices;
+  };
+
+  template <typename T>
+  TuningTable& table() {
+    static TuningTable s_table;
+    return s_table;
+  }
+
+  /**
+   * Names of the precisions, in the tuning files
+   */
+  template <typename T> const char* precisionName();
+  template <> const char* precisionName<double>() { return "double"; }
+  template <> const char* precisionName<float>() { return "float"; }
+
+  /**
+   * Minimum duration (in seconds) of a timed round of transforms, and
+   * number of rounds (the fastest one being kept)
+   */
+  const double MIN_ROUND_TIME = 1e-3;
+  const int ROUNDS = 3;
+
+  /**
+   * Orders of the fftpack factors of n which are worth trying: the groups of
+   * radix 2, 3, 4 and 5 factors are permuted, the other primes coming last,
+   * in increasing order. The power of two is split in as many radix 4
+   * factors as possible, or in one radix 4 factor less. The default order of
+   * fftpack comes first.
+   */
+  std::vector<std::vector<int> > factorOrders(size_t n) {
+    size_t twos = 0, threes = 0, fives = 0;
+    while (n % 2 == 0) { ++twos; n /= 2; }
+    while (n % 3 == 0) { ++threes; n /= 3; }
+    while (n % 5 == 0) { ++fives; n /= 5; }
+    std::vector<int> others;
+    for (size_t p=7; p*p<=n; p+=2)
+      while (n % p == 0) { others.push_back((int)p); n /= p; }
+    if (n > 1) others.push_back((int)n);
+
+    std::vector<std::vector<int> > res;
+    for (size_t split=0; split<2 && split<=twos/2; ++split) {
+      const size_t fours = twos/2 - split;
+      size_t count[6] = {0, 0, twos - 2*fours, threes, fours, fives};
+      int radix[4] = {2, 3, 4, 5};
+      do {
+        std::vector<int> order;
+        for (int i=0; i<4; ++i) order.insert(order.end(), count[radix[i]], radix[i]);
+        order.insert(order.end(), others.begin(), others.end());
+        if (order.size() <= FFTPACK_MAX_FACTORS &&
+            std::find(res.begin(), res.end(), order) == res.end())
+          res.push_back(order);
+      } while (std::next_permutation(radix, radix+4));
+    }
+    return res;
+  }
+
+  /**
+   * Builds the backend of a choice
+   */
+  template <typename T>
+  bob::sp::detail::FFTBackend<T>* newBackend(const size_t length,
+      const Choice& choice) {
+    if (!choice.stockham)
+      return bob::sp::detail::newFftpackBackend<T>(length, choice.factors);
+    bob::sp::detail::StockhamFFT<T>* res = new bob::sp::detail::StockhamFFT<T>();
+    try {
+      res->init(length);
+    }
+    catch (...) {
+      delete res;
+      throw;
+    }
+    return res;
+  }
+
+  /**
+   * Time (in seconds) of a direct transform of the given signal, as the
+   * fastest of several rounds. The signal is restored before each transform,
+   * so that the values cannot overflow.
+   */
+  template <typename T>
+  double measure(const bob::sp::detail::FFTBackend<T>& backend,
+      const std::vector<T>& signal) {
+    typedef std::chrono::steady_clock clock;
+    std::vector<T> data(signal.size());
+    std::vector<T> work(backend.getWorkSize());
+    double best = std::numeric_limits<double>::max();
+    size_t repeats = 1;
+    for (int round=0; round<ROUNDS; ++round) {
+      const clock::time_point start = clock::now();
+      for (size_t r=0; r<repeats; ++r) {
+        std::copy(signal.begin(), signal.end(), data.begin());
+        backend.forward(data.data(), work.data());
+      }
+      const double elapsed =
+        std::chrono::duration<double>(clock::now() - start).count();
+      best = std::min(best, elapsed / repeats);
+      // The first round (of a single transform) calibrates the others
+      if (round == 0 && elapsed < MIN_ROUND_TIME)
+        repeats = (size_t)(MIN_ROUND_TIME / std::max(elapsed, 1e-9)) + 1;
+    }
+    return best;
+  }
+
+  /**
+   * Times all the candidates for the given length, and returns the fastest
+   */
+  template <typename T>
+  Choice tune(const size_t length) {
+    std::vector<T> signal(2*length);
+    for (size_t k=0; k<signal.size(); ++k)
+      signal[k] = (T)((k * 7919) % 1024) / (T)1024 - (T)0.5;
+
+    std::vector<Choice> candidates;
+    const std::vector<std::vector<int> > orders = factorOrders(length);
+    for (size_t i=0; i<orders.size(); ++i) {
+      Choice choice = {false, orders[i]};
+      candidates.push_back(choice);
+    }
+    Choice stockham = {true, std::vector<int>()};
+    candidates.push_back(stockham);
+
+    size_t best = 0;
+    double best_time = std::numeric_limits<double>::max();
+    for (size_t i=0; i<candidates.size(); ++i) {
+      boost::shared_ptr<bob::sp::detail::FFTBackend<T> >
+        backend(newBackend<T>(length, candidates[i]));
+      const double time = measure(*backend, signal);
+      if (time < best_time) { best = i; best_time = time; }
+    }
+    return candidates[best];
+  }
+
+  /**
+   * A line of a tuning file
+   */
+  struct Entry {
+    bool single;
+    size_t length;
+    Choice choice;
+  };
+
+  /**
+   * Parses a line of a tuning file. Returns false if it is not valid.
+   */
+  bool parseEntry(const std::string& line, Entry& entry) {
+    std::istringstream in(line);
+    std::string precision, engine;
+    long long length = 0;
+    if (!(in >> precision >> length >> engine) || length < 1) return false;
+
+    Choice choice;
+    if (engine == "stockham") choice.stockham = true;
+    else if (engine == "fftpack") choice.stockham = false;
+    else return false;
+
+    long long product = 1;
+    int factor = 0;
+    while (in >> factor) {
+      if (factor < 2 || choice.stockham) return false;
+      choice.factors.push_back(factor);
+      product *= factor;
+      if (product > length) return false;
+    }
+    if (!in.eof()) return false;
+    if (!choice.stockham && (product != length ||
+          choice.factors.size() > FFTPACK_MAX_FACTORS)) return false;
+
+    if (precision == precisionName<double>()) entry.single = false;
+    else if (precision == precisionName<float>()) entry.single = true;
+    else return false;
+    entry.length = (size_t)length;
+    entry.choice = choice;
+    return true;
+  }
+
+  /**
+   * Writes the choices of one precision, one per line
+   */
+  template <typename T>
+  void writeChoices(std::ostream& out) {
+    TuningTable& t = table<T>();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    for (TuningTable::choice_map_t::const_iterator it = t.choices.begin();
+        it != t.choices.end(); ++it) {
+      out << precisionName<T>() << ' ' << it->first << ' ' <<
+        (it->second.stockham ? "stockham" : "fftpack");
+      for (size_t i=0; i<it->second.factors.size(); ++i)
+        out << ' ' << it->second.factors[i];
+      out << '\n';
+    }
+  }
+
+}
+
+template <typename T>
+bob::sp::detail::FFTBackend<T>* bob::sp::detail::newTunedBackend(const size_t length)
+{
+  TuningTable& t = table<T>();
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    TuningTable::choice_map_t::const_iterator it = t.choices.find(length);
+    if (it != t.choices.end()) return newBackend<T>(length, it->second);
+  }
+
+  // The candidates are timed without holding the lock, so that the other
+  // lengths can be planned in the meantime. If another thread tuned the
+  // same length, its choice is kept.
+  const Choice choice = tune<T>(length);
+  std::lock_guard<std::mutex> lock(t.mutex);
+  std::pair<TuningTable::choice_map_t::iterator, bool> res =
+    t.choices.insert(std::make_pair(length, choice));
+  return newBackend<T>(length, res.first->second);
+}
+
+void bob::sp::detail::importFFTTuning(const std::string& filename)
+{
+  std::ifstream file(filename.c_str());
+  if (!file) {
+    boost::format m("cannot read the FFT tuning file `%s'");
+    m % filename;
+    throw std::runtime_error(m.str());
+  }
+
+  // Lines: "<precision> <length> <engine> [<factors>...]", '#' starting a
+  // comment. Nothing is merged unless the whole file is valid.
+  std::vector<Entry> entries;
+  std::string line;
+  for (size_t number=1; std::getline(file, line); ++number) {
+    const size_t comment = line.find('#');
+    if (comment != std::string::npos) line.erase(comment);
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    Entry entry;
+    if (!parseEntry(line, entry)) {
+      boost::format m("`%s' is not a valid FFT tuning file (line %lu)");
+      m % filename % number;
+      throw std::runtime_error(m.str());
+    }
+    entries.push_back(entry);
+  }
+
+  TuningTable& d = table<double>();
+  TuningTable& f = table<float>();
+  std::lock_guard<std::mutex> lock_double(d.mutex);
+  std::lock_guard<std::mutex> lock_float(f.mutex);
+  for (size_t i=0; i<entries.size(); ++i)
+    (entries[i].single ? f : d).choices[entries[i].length] = entries[i].choice;
+}
+
+void bob::sp::detail::exportFFTTuning(const std::string& filename)
+{
+  std::ostringstream content;
+  content << "# bob.sp FFT tuning: <precision> <length> <engine> [<factors>...]\n";
+  writeChoices<double>(content);
+  writeChoices<float>(content);
+
+  std::ofstream file(filename.c_str());
+  file << content.str();
+  file.close();
+  if (!file) {
+    boost::format m("cannot write the FFT tuning file `%s'");
+    m % filename;
+    throw std::runtime_error(m.str());
+  }
+}
+
+// Instantiations provided by the library
+template bob::sp::detail::FFTBackend<double>* bob::sp::detail::newTunedBackend<double>(const size_t);
+template bob::sp::detail::FFTBackend<float>* bob::sp::detail::newTunedBackend<float>(const size_t);
@@ -0,0 +1,260 @@
+/**
+ * @date Sat Oct 17 09:41:06 CEST 2026
+ *
+ * @brief Optional FFTW3 backend of the 1D Fast Fourier Transforms, and
+ * persistence of the FFTW wisdom
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FFTBackend.h>
+
+#include <stdexcept>
+#include <boost/format.hpp>
+
+#ifdef BOB_SP_HAVE_FFTW3
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <fftw3.h>
+
+namespace {
+
+  /**
+   * Only the fftw_execute*() functions of FFTW are thread-safe: the planner,
+   * the destruction of the plans and the wisdom are protected by this mutex
+   */
+  std::mutex& plannerMutex() {
+    static std::mutex s_mutex;
+    return s_mutex;
+  }
+
+  /**
+   * Entry points of the double and single precision builds of FFTW3
+   */
+  template <typename T> struct fftw;
+
+  template <> struct fftw<double> {
+    typedef fftw_plan plan;
+    static plan dft(int n, double* data, int sign) {
+      return fftw_plan_dft_1d(n, reinterpret_cast<fftw_complex*>(data),
+          reinterpret_cast<fftw_complex*>(data), sign, FFTW_MEASURE);
+    }
+    static void execute(const plan p, double* data) {
+      fftw_execute_dft(p, reinterpret_cast<fftw_complex*>(data),
+          reinterpret_cast<fftw_complex*>(data));
+    }
+    static void destroy(plan p) { fftw_destroy_plan(p); }
+    static double* alloc(size_t n) { return fftw_alloc_real(n); }
+    static void free(double* p) { fftw_free(p); }
+    static int alignment(const double* p) { return fftw_alignment_of(const_cast<double*>(p)); }
+    static char* exportWisdom() { return fftw_export_wisdom_to_string(); }
+    static void freeWisdom(char* s) { fftw_free(s); }
+    static int importWisdom(const char* s) { return fftw_import_wisdom_from_string(s); }
+  };
+
+  template <> struct fftw<float> {
+    typedef fftwf_plan plan;
+    static plan dft(int n, float* data, int sign) {
+      return fftwf_plan_dft_1d(n, reinterpret_cast<fftwf_complex*>(data),
+          reinterpret_cast<fftwf_complex*>(data), sign, FFTW_MEASURE);
+    }
+    static void execute(const plan p, float* data) {
+      fftwf_execute_dft(p, reinterpret_cast<fftwf_complex*>(data),
+          reinterpret_cast<fftwf_complex*>(data));
+    }
+    static void destroy(plan p) { fftwf_destroy_plan(p); }
+    static float* alloc(size_t n) { return fftwf_alloc_real(n); }
+    static void free(float* p) { fftwf_free(p); }
+    static int alignment(const float* p) { return fftwf_alignment_of(const_cast<float*>(p)); }
+    static char* exportWisdom() { return fftwf_export_wisdom_to_string(); }
+    static void freeWisdom(char* s) { fftwf_free(s); }
+    static int importWisdom(const char* s) { return fftwf_import_wisdom_from_string(s); }
+  };
+
+  /**
+   * Alignment (in bytes) of the copies of the misaligned signals, which is
+   * a multiple of the one required by any SIMD extension of FFTW
+   */
+  const size_t ALIGNMENT = 64;
+
+  /**
+   * Complex FFTs computed by two in-place FFTW plans. The plans are made for
+   * SIMD aligned arrays: the signals which are not are copied to an aligned
+   * part of the work array.
+   */
+  template <typename T>
+  class FFTWBackend: public bob::sp::detail::FFTBackend<T>
+  {
+    public:
+      explicit FFTWBackend(const size_t length):
+        m_length(length), m_forward(0), m_backward(0)
+      {
+        std::lock_guard<std::mutex> lock(plannerMutex());
+        // FFTW_MEASURE overwrites the arrays while planning
+        T* buffer = fftw<T>::alloc(2*length);
+        m_forward = fftw<T>::dft((int)length, buffer, FFTW_FORWARD);
+        m_backward = fftw<T>::dft((int)length, buffer, FFTW_BACKWARD);
+        fftw<T>::free(buffer);
+        if (!m_forward || !m_backward) {
+          if (m_forward) fftw<T>::destroy(m_forward);
+          if (m_backward) fftw<T>::destroy(m_backward);
+          boost::format m("FFTW cannot plan the FFT of length %lu");
+          m % length;
+          throw std::runtime_error(m.str());
+        }
+      }
+
+      virtual ~FFTWBackend()
+      {
+        std::lock_guard<std::mutex> lock(plannerMutex());
+        fftw<T>::destroy(m_forward);
+        fftw<T>::destroy(m_backward);
+      }
+
+      virtual size_t getWorkSize() const
+      {
+        return 2*m_length + ALIGNMENT / sizeof(T);
+      }
+
+      virtual void forward(T* data, T* work) const
+      {
+        execute(m_forward, data, work);
+      }
+
+      virtual void backward(T* data, T* work) const
+      {
+        execute(m_backward, data, work);
+      }
+
+    private:
+      void execute(const typename fftw<T>::plan p, T* data, T* work) const
+      {
+        if (fftw<T>::alignment(data) == 0) {
+          fftw<T>::execute(p, data);
+          return;
+        }
+        T* aligned = reinterpret_cast<T*>(
+            (reinterpret_cast<uintptr_t>(work) + ALIGNMENT - 1) & ~(uintptr_t)(ALIGNMENT - 1));
+        std::copy(data, data + 2*m_length, aligned);
+        fftw<T>::execute(p, aligned);
+        std::copy(aligned, aligned + 2*m_length, data);
+      }
+
+      size_t m_length;
+      typename fftw<T>::plan m_forward;
+      typename fftw<T>::plan m_backward;
+  };
+
+  /**
+   * Exports the wisdom of one precision, as a string
+   */
+  template <typename T>
+  std::string exportWisdom() {
+    char* wisdom = fftw<T>::exportWisdom();
+    if (!wisdom) throw std::runtime_error("FFTW cannot export its wisdom");
+    std::string res(wisdom);
+    fftw<T>::freeWisdom(wisdom);
+    return res;
+  }
+
+}
+
+bool bob::sp::detail::hasFFTW()
+{
+  return true;
+}
+
+template <typename T>
+bob::sp::detail::FFTBackend<T>* bob::sp::detail::newFFTWBackend(const size_t length)
+{
+  return new FFTWBackend<T>(length);
+}
+
+void bob::sp::detail::importFFTWWisdom(const std::string& filename)
+{
+  std::ifstream file(filename.c_str());
+  if (!file) {
+    boost::format m("cannot read the FFTW wisdom file `%s'");
+    m % filename;
+    throw std::runtime_error(m.str());
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+
+  // The file holds the wisdom of the double precision plans, then the one
+  // of the single precision plans, each of them being an s-expression
+  const std::string wisdom = content.str();
+  size_t split = 0;
+  for (int depth=0; split<wisdom.size(); ++split) {
+    if (wisdom[split] == '(') ++depth;
+    else if (wisdom[split] == ')' && --depth == 0) { ++split; break; }
+  }
+
+  std::lock_guard<std::mutex> lock(plannerMutex());
+  if (!fftw<double>::importWisdom(wisdom.substr(0, split).c_str()) ||
+      !fftw<float>::importWisdom(wisdom.substr(split).c_str())) {
+    boost::format m("`%s' is not a valid FFTW wisdom file");
+    m % filename;
+    throw std::runtime_error(m.str());
+  }
+}
+
+void bob::sp::detail::exportFFTWWisdom(const std::string& filename)
+{
+  std::string wisdom;
+  {
+    std::lock_guard<std::mutex> lock(plannerMutex());
+    wisdom = exportWisdom<double>() + exportWisdom<float>();
+  }
+
+  std::ofstream file(filename.c_str());
+  file << wisdom;
+  file.close();
+  if (!file) {
+    boost::format m("cannot write the FFTW wisdom file `%s'");
+    m % filename;
+    throw std::runtime_error(m.str());
+  }
+}
+
+#else /* BOB_SP_HAVE_FFTW3 */
+
+namespace {
+
+  void noFFTW() {
+    throw std::runtime_error("bob.sp was compiled without FFTW3 support (BOB_SP_HAVE_FFTW3)");
+  }
+
+}
+
+bool bob::sp::detail::hasFFTW()
+{
+  return false;
+}
+
+template <typename T>
+bob::sp::detail::FFTBackend<T>* bob::sp::detail::newFFTWBackend(const size_t)
+{
+  noFFTW();
+  return 0;
+}
+
+void bob::sp::detail::importFFTWWisdom(const std::string&)
+{
+  noFFTW();
+}
+
+void bob::sp::detail::exportFFTWWisdom(const std::string&)
+{
+  noFFTW();
+}
+
+#endif /* BOB_SP_HAVE_FFTW3 */
+
+// Instantiations provided by the library
+template bob::sp::detail::FFTBackend<double>* bob::sp::detail::newFFTWBackend<double>(const size_t);
+template bob::sp::detail::FFTBackend<float>* bob::sp::detail::newFFTWBackend<float>(const size_t);
@@ -0,0 +1,183 @@
+/**
+ * @date Sat Oct 17 21:36:08 CEST 2026
+ *
+ * @brief Four-step decomposition of the complex 1D FFTs of the lengths
+ * whose signals do not fit in the caches
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/FourStepFFT.h>
+#include <bob.sp/Workspace.h>
+#include <bob.sp/ThreadPool.h>
+#include <bob.sp/ColumnTiles.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <boost/format.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * Shortest length computed with the four-step algorithm: the signals of
+   * the shorter ones (16 MB in double precision) mostly fit in the caches,
+   * where the radix passes of a single plan are faster
+   */
+  const size_t MIN_LENGTH = (size_t)1 << 20;
+
+  /**
+   * x * f * scale, f being conjugated if asked
+   */
+  template <typename T>
+  inline std::complex<T> product(const std::complex<T>& x,
+    const std::complex<double>& f, const bool conjugate, const T scale)
+  {
+    const T fr = (T)f.real() * scale;
+    const T fi = (conjugate ? -(T)f.imag() : (T)f.imag()) * scale;
+    return std::complex<T>(x.real()*fr - x.imag()*fi,
+        x.real()*fi + x.imag()*fr);
+  }
+
+}
+
+size_t bob::sp::detail::FourStepFFT::split(const size_t length)
+{
+  if (length < MIN_LENGTH) return 0;
+  size_t rows = (size_t)std::sqrt((double)length);
+  while (rows*rows > length) --rows;
+  while (length % rows != 0) --rows;
+  return (64*rows*rows >= length ? rows : 0);
+}
+
+bob::sp::detail::FourStepFFT::FourStepFFT(const size_t length,
+    const bob::sp::FFTPlanBase::Engine engine):
+  m_length(length), m_rows(split(length)),
+  m_columns(m_rows ? length / m_rows : 0), m_shift(0)
+{
+  if (m_rows == 0) {
+    boost::format m("the four-step FFT is not used for the length %lu");
+    m % length;
+    throw std::runtime_error(m.str());
+  }
+
+  // S = 2^m_shift >= sqrt(N)
+  while (((size_t)1 << (2*m_shift)) < length) ++m_shift;
+  const size_t S = (size_t)1 << m_shift;
+  const double PI = boost::math::constants::pi<double>();
+  m_low.resize(S);
+  for (size_t j=0; j<S; ++j)
+    m_low[j] = std::polar(1., -2. * PI * (double)j / (double)length);
+  m_high.resize(length / S + 1);
+  for (size_t j=0; j<m_high.size(); ++j)
+    m_high[j] = std::polar(1., -2. * PI * (double)(j*S) / (double)length);
+
+  m_column_plans.reset(m_rows, bob::sp::FFTPlanBase::Complex, engine);
+  m_row_plans.reset(m_columns, bob::sp::FFTPlanBase::Complex, engine);
+}
+
+template <typename T>
+void bob::sp::detail::FourStepFFT::transform(const std::complex<T>* src,
+    std::complex<T>* dst, const bool inverse,
+    const std::complex<double>* u, const size_t threads) const
+{
+  // The output of the first step is written to dst, unless the transform
+  // is in place: src is then still being read
+  if (src != dst) steps(src, dst, dst, inverse, u, threads);
+  else {
+    Workspace<std::complex<T> > scratch(m_length);
+    steps(src, scratch.data(), dst, inverse, u, threads);
+  }
+}
+
+template <typename T>
+void bob::sp::detail::FourStepFFT::steps(const std::complex<T>* src,
+    std::complex<T>* z, std::complex<T>* dst, const bool inverse,
+    const std::complex<double>* u, const size_t threads) const
+{
+  typedef std::complex<T> complex_t;
+  const size_t N = m_length, N1 = m_columns, N2 = m_rows;
+  const T scale = (inverse ? (T)1 / (T)N : (T)1);
+  const bob::sp::BasicFFTPlan<T>& column_plan = m_column_plans.get<T>();
+  const bob::sp::BasicFFTPlan<T>& row_plan = m_row_plans.get<T>();
+  const size_t count = resolveThreads(threads);
+
+  // 1. Columns of src (seen as a (N2, N1) matrix), by tiles, into the rows
+  // of z (seen as a (N1, N2) matrix). The centered mode (direct) and the
+  // normalization (inverse) are applied while gathering the tiles, and the
+  // twiddle factors while scattering them.
+  const size_t B = tileWidth(N2, sizeof(complex_t), (N1 + count - 1) / count,
+      256/sizeof(complex_t));
+  const size_t ld = N2 + 64/sizeof(complex_t);
+  processColumnTiles<T>(src, 0, N1*sizeof(complex_t), sizeof(complex_t), N2,
+      N1, B, threads, 2*B*ld, column_plan.getWorkSize(),
+    [&](T* buf, size_t j0, size_t nb, size_t k) {
+      complex_t* b = reinterpret_cast<complex_t*>(buf);
+      const complex_t* x = src + k*N1 + j0;
+      if (u && !inverse) {
+        const std::complex<double>* f = u + k*N1 + j0;
+        for (size_t l=0; l<nb; ++l) b[l*ld+k] = product(x[l], f[l], true, (T)1);
+      }
+      else
+        for (size_t l=0; l<nb; ++l) b[l*ld+k] = x[l] * scale;
+    },
+    [&](T* buf, size_t nb, T* w) {
+      for (size_t l=0; l<nb; ++l) {
+        if (inverse) column_plan.backward(buf + 2*l*ld, w);
+        else column_plan.forward(buf + 2*l*ld, w);
+      }
+    },
+    [&](const T* buf, size_t j0, size_t nb, size_t k) {
+      // The value k of the column n1 = j0+l gets W^(n1*k) (conjugated for
+      // the inverse transform), W^(j0*k) being multiplied by W^k from one
+      // column to the next (k < N2 <= S). The nb rows of z are written
+      // one value at a time, as nb sequential streams.
+      const complex_t* b = reinterpret_cast<const complex_t*>(buf);
+      complex_t* y = z + j0*N2 + k;
+      const std::complex<double> step = m_low[k];
+      std::complex<double> f = twiddle((j0*k) % N);
+      for (size_t l=0; l<nb; ++l) {
+        y[l*N2] = product(b[l*ld+k], f, inverse, (T)1);
+        f = std::complex<double>(f.real()*step.real() - f.imag()*step.imag(),
+            f.real()*step.imag() + f.imag()*step.real());
+      }
+    });
+
+  // 2. Columns of z (length N1), by tiles, into the same columns of dst:
+  // the value k1 of the column k2 is X_(k2+N2*k1). The centered mode
+  // (inverse) is applied while scattering them.
+  const size_t C = tileWidth(N1, sizeof(complex_t), (N2 + count - 1) / count,
+      256/sizeof(complex_t));
+  const size_t ld1 = N1 + 64/sizeof(complex_t);
+  processColumnTiles<T>(z, dst, N2*sizeof(complex_t), sizeof(complex_t), N1,
+      N2, C, threads, 2*C*ld1, row_plan.getWorkSize(),
+    [&](T* buf, size_t j0, size_t nb, size_t k) {
+      complex_t* b = reinterpret_cast<complex_t*>(buf);
+      const complex_t* x = z + k*N2 + j0;
+      for (size_t l=0; l<nb; ++l) b[l*ld1+k] = x[l];
+    },
+    [&](T* buf, size_t nb, T* w) {
+      for (size_t l=0; l<nb; ++l) {
+        if (inverse) row_plan.backward(buf + 2*l*ld1, w);
+        else row_plan.forward(buf + 2*l*ld1, w);
+      }
+    },
+    [&](const T* buf, size_t j0, size_t nb, size_t k) {
+      const complex_t* b = reinterpret_cast<const complex_t*>(buf);
+      complex_t* y = dst + k*N2 + j0;
+      if (u && inverse) {
+        const std::complex<double>* f = u + k*N2 + j0;
+        for (size_t l=0; l<nb; ++l) y[l] = product(b[l*ld1+k], f[l], false, (T)1);
+      }
+      else
+        for (size_t l=0; l<nb; ++l) y[l] = b[l*ld1+k];
+    });
+}
+
+template void bob::sp::detail::FourStepFFT::transform<double>(
+    const std::complex<double>*, std::complex<double>*, const bool,
+    const std::complex<double>*, const size_t) const;
+template void bob::sp::detail::FourStepFFT::transform<float>(
+    const std::complex<float>*, std::complex<float>*, const bool,
+    const std::complex<double>*, const size_t) const;
@@ -0,0 +1,279 @@
+/**
+ * @date Sat Oct 17 15:48:10 CEST 2026
+ *
+ * @brief Implement a blitz-based evaluation of a few bins of the Discrete
+ * Fourier Transform, with the Goertzel algorithm
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/Goertzel.h>
+#include <bob.sp/Workspace.h>
+#include <bob.sp/fftpack.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * exp(-2*i*pi*f*t/N), with the phase reduced modulo 1 (turn) before the
+   * trigonometric functions are evaluated
+   */
+  std::complex<double> phase(const double f, const double t, const double N) {
+    const double PI = boost::math::constants::pi<double>();
+    const double turn = fmod(fmod(f, N) * t, N) / N;
+    return std::complex<double>(cos(2. * PI * turn), -sin(2. * PI * turn));
+  }
+
+  void checkFrequencies(const std::vector<double>& frequencies) {
+    for (size_t i=0; i<frequencies.size(); ++i)
+      if (!std::isfinite(frequencies[i]))
+        throw std::runtime_error("Goertzel frequencies should be finite.");
+  }
+
+  /**
+   * Number of recurrences (lanes) to keep busy, and minimum length of the
+   * segments of the signal when it is split to get them
+   */
+  const size_t LANES = 64;
+  const size_t MIN_SEGMENT = 64;
+
+  /**
+   * Value of the transform, or its power, from its value on the segments
+   */
+  template <typename T>
+  void finish(const std::complex<double>& value, const size_t,
+      const double, const double, const double, std::complex<T>& res) {
+    res = std::complex<T>((T)value.real(), (T)value.imag());
+  }
+
+  template <typename T>
+  void finish(const std::complex<double>& value, const size_t segments,
+      const double s1, const double s2, const double c, T& res) {
+    // A single segment: the power only depends on the recurrence
+    if (segments == 1) res = (T)(s1*s1 + s2*s2 - c*s1*s2);
+    else res = (T)std::norm(value);
+  }
+
+}
+
+bob::sp::Goertzel::Goertzel():
+  m_length(1), m_frequencies(1, 0.)
+{
+  initWorkingArray();
+}
+
+bob::sp::Goertzel::Goertzel(const size_t length,
+    const std::vector<double>& frequencies):
+  m_length(length), m_frequencies(frequencies)
+{
+  if (length < 1)
+    throw std::runtime_error("Goertzel length should be at least 1.");
+  checkFrequencies(frequencies);
+  initWorkingArray();
+}
+
+bob::sp::Goertzel::Goertzel(const bob::sp::Goertzel& other):
+  m_length(other.m_length), m_frequencies(other.m_frequencies),
+  m_coefficients(other.m_coefficients), m_segments(other.m_segments),
+  m_padding(other.m_padding), m_first(other.m_first),
+  m_second(other.m_second), m_shifts(other.m_shifts)
+{
+}
+
+bob::sp::Goertzel::~Goertzel()
+{
+}
+
+bob::sp::Goertzel& bob::sp::Goertzel::operator=(const Goertzel& other)
+{
+  if (this != &other) {
+    m_length = other.m_length;
+    m_frequencies = other.m_frequencies;
+    m_coefficients = other.m_coefficients;
+    m_segments = other.m_segments;
+    m_padding = other.m_padding;
+    m_first = other.m_first;
+    m_second = other.m_second;
+    m_shifts = other.m_shifts;
+  }
+  return *this;
+}
+
+bool bob::sp::Goertzel::operator==(const bob::sp::Goertzel& b) const
+{
+  return (this->m_length == b.m_length &&
+      this->m_frequencies == b.m_frequencies);
+}
+
+bool bob::sp::Goertzel::operator!=(const bob::sp::Goertzel& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::Goertzel::operator()(const blitz::Array<double,1>& src,
+  blitz::Array<std::complex<double>,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,1>((int)m_frequencies.size()));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::Goertzel::operator()(const blitz::Array<float,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,1>((int)m_frequencies.size()));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::Goertzel::operator()(const blitz::Array<double,2>& src,
+  blitz::Array<std::complex<double>,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_frequencies.size()));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::Goertzel::operator()(const blitz::Array<float,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_frequencies.size()));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::Goertzel::power(const blitz::Array<double,1>& src,
+  blitz::Array<double,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,1>((int)m_frequencies.size()));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::Goertzel::power(const blitz::Array<float,1>& src,
+  blitz::Array<float,1>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameShape(src, blitz::TinyVector<int,1>((int)m_length));
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,1>((int)m_frequencies.size()));
+  process(src.data(), 1, dst.data());
+}
+
+void bob::sp::Goertzel::power(const blitz::Array<double,2>& src,
+  blitz::Array<double,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_frequencies.size()));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::Goertzel::power(const blitz::Array<float,2>& src,
+  blitz::Array<float,2>& dst) const
+{
+  bob::core::array::assertCZeroBaseContiguous(src);
+  bob::core::array::assertSameDimensionLength(src.extent(1), (int)m_length);
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  bob::core::array::assertSameShape(dst,
+      blitz::TinyVector<int,2>(src.extent(0), (int)m_frequencies.size()));
+  process(src.data(), src.extent(0), dst.data());
+}
+
+void bob::sp::Goertzel::setLength(const size_t length)
+{
+  if (length < 1)
+    throw std::runtime_error("Goertzel length should be at least 1.");
+  m_length = length;
+  initWorkingArray();
+}
+
+void bob::sp::Goertzel::setFrequencies(const std::vector<double>& frequencies)
+{
+  checkFrequencies(frequencies);
+  m_frequencies = frequencies;
+  initWorkingArray();
+}
+
+void bob::sp::Goertzel::initWorkingArray()
+{
+  // The value of the transform at the angular frequency w = 2*pi*f/N of a
+  // segment of length L is exp(-i*w*(L-1)) * (s[L-1] - exp(-i*w)*s[L-2]).
+  // A few frequencies do not fill the SIMD lanes, and their recurrences are
+  // bound by latency: the signal is then split into segments, whose
+  // recurrences run in the remaining lanes. The signal is padded with
+  // leading zeros to a multiple of L, and the segment j, which starts at
+  // sample j*L-P of the signal, contributes its value times
+  // exp(-i*w*(j*L-P)).
+  const size_t K = m_frequencies.size();
+  const size_t B = (K + 7) / 8 * 8;
+  m_segments = std::max((size_t)1,
+      std::min(LANES / B, m_length / MIN_SEGMENT));
+  const size_t L = (m_length + m_segments - 1) / m_segments;
+  m_padding = m_segments * L - m_length;
+
+  const double PI = boost::math::constants::pi<double>();
+  const double N = (double)m_length;
+  m_coefficients.assign(B, 0.);
+  m_first.resize(K);
+  m_second.resize(K);
+  m_shifts.resize(m_segments * K);
+  for (size_t i=0; i<K; ++i) {
+    const double f = m_frequencies[i];
+    m_coefficients[i] = 2. * cos(2. * PI * (fmod(f, N) / N));
+    m_first[i] = phase(f, (double)L - 1., N);
+    m_second[i] = phase(f, (double)L, N);
+    for (size_t j=0; j<m_segments; ++j)
+      m_shifts[j*K + i] = phase(f, (double)(j*L) - (double)m_padding, N);
+  }
+}
+
+template <typename T, typename U>
+void bob::sp::Goertzel::process(const T* src, const size_t rows, U* dst) const
+{
+  const size_t N = m_length, K = m_frequencies.size();
+  const size_t B = m_coefficients.size(), S = m_segments, P = m_padding;
+  const bool copy = (sizeof(T) != sizeof(double) || P > 0);
+  bob::sp::detail::Workspace<double> ws(2*S*B + (copy ? N + P : 0));
+  double* s1 = ws.data();
+  double* s2 = s1 + S*B;
+  double* x = s2 + S*B;
+  std::fill(x, x + (copy ? P : 0), 0.);
+
+  for (size_t r=0; r<rows; ++r) {
+    const T* row = src + r*N;
+    if (copy) std::copy(row, row + N, x + P);
+    goertzel_run((int)((N + P) / S),
+        copy ? x : reinterpret_cast<const double*>(row),
+        (int)S, (int)K, m_coefficients.data(), s1, s2);
+    for (size_t i=0; i<K; ++i) {
+      std::complex<double> value(0.);
+      for (size_t j=0; j<S; ++j)
+        value += m_shifts[j*K + i] *
+          (m_first[i] * s1[j*B + i] - m_second[i] * s2[j*B + i]);
+      finish(value, S, s1[i], s2[i], m_coefficients[i], dst[r*K + i]);
+    }
+  }
+}
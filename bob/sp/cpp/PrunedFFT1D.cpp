@@ -0,0 +1,410 @@
+/**
+ * @date Sat Oct 17 12:24:51 CEST 2026
+ *
+ * @brief Implement a blitz-based pruned 1D Fast Fourier Transform, which
+ * skips the computations feeding only known-zero inputs or discarded
+ * outputs
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/PrunedFFT1D.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * Smallest divisor of n which is >= m (m <= n)
+   */
+  size_t smallestDivisor(const size_t n, const size_t m) {
+    for (size_t d=std::max<size_t>(m, 1); d<n; ++d)
+      if (n % d == 0) return d;
+    return n;
+  }
+
+  /**
+   * exp(-2*i*pi*k/n), with k reduced modulo n beforehand, to keep the
+   * accuracy for large k
+   */
+  std::complex<double> twiddle(const size_t k, const size_t n) {
+    const double PI = boost::math::constants::pi<double>();
+    const double arg = 2. * PI * (double)(k % n) / (double)n;
+    return std::complex<double>(cos(arg), -sin(arg));
+  }
+
+  /**
+   * Number of values of each decimated signal or row handled at once by the
+   * strided copies
+   */
+  const size_t TILE = 16;
+
+  /**
+   * Rough cost of a call to an inner transform, relatively to the one of a
+   * butterfly
+   */
+  const double CALL_COST = 256.;
+
+  void checkLengths(const size_t length, const size_t input_length,
+    const size_t output_length) {
+    if (length < 1)
+      throw std::runtime_error("FFT length should be at least 1.");
+    if (input_length < 1 || input_length > length)
+      throw std::runtime_error("FFT input length should be in [1, length].");
+    if (output_length < 1 || output_length > length)
+      throw std::runtime_error("FFT output length should be in [1, length].");
+  }
+
+}
+
+bob::sp::PrunedFFT1DAbstract::PrunedFFT1DAbstract():
+  m_length(1), m_input_length(1), m_output_length(1),
+  m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  initWorkingArray();
+}
+
+bob::sp::PrunedFFT1DAbstract::PrunedFFT1DAbstract(const size_t length,
+    const size_t input_length, const size_t output_length):
+  m_length(length), m_input_length(input_length),
+  m_output_length(output_length),
+  m_engine(bob::sp::FFTPlanBase::Fftpack)
+{
+  checkLengths(length, input_length, output_length);
+  initWorkingArray();
+}
+
+bob::sp::PrunedFFT1DAbstract::PrunedFFT1DAbstract(
+    const bob::sp::PrunedFFT1DAbstract& other):
+  m_length(other.m_length), m_input_length(other.m_input_length),
+  m_output_length(other.m_output_length), m_engine(other.m_engine),
+  m_split(other.m_split), m_split_length(other.m_split_length),
+  m_groups(other.m_groups), m_group_length(other.m_group_length),
+  m_group_outputs(other.m_group_outputs),
+  m_input_twiddles(other.m_input_twiddles),
+  m_output_twiddles(other.m_output_twiddles),
+  m_plans(other.m_plans)
+{
+}
+
+bob::sp::PrunedFFT1DAbstract::~PrunedFFT1DAbstract()
+{
+}
+
+bob::sp::PrunedFFT1DAbstract&
+bob::sp::PrunedFFT1DAbstract::operator=(const PrunedFFT1DAbstract& other)
+{
+  if (this != &other) {
+    m_length = other.m_length;
+    m_input_length = other.m_input_length;
+    m_output_length = other.m_output_length;
+    m_engine = other.m_engine;
+    m_split = other.m_split;
+    m_split_length = other.m_split_length;
+    m_groups = other.m_groups;
+    m_group_length = other.m_group_length;
+    m_group_outputs = other.m_group_outputs;
+    m_input_twiddles = other.m_input_twiddles;
+    m_output_twiddles = other.m_output_twiddles;
+    m_plans = other.m_plans;
+  }
+  return *this;
+}
+
+bool bob::sp::PrunedFFT1DAbstract::operator==(const bob::sp::PrunedFFT1DAbstract& b) const
+{
+  return (this->m_length == b.m_length &&
+      this->m_input_length == b.m_input_length &&
+      this->m_output_length == b.m_output_length &&
+      this->m_engine == b.m_engine);
+}
+
+bool bob::sp::PrunedFFT1DAbstract::operator!=(const bob::sp::PrunedFFT1DAbstract& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::PrunedFFT1DAbstract::operator()(
+  const blitz::Array<std::complex<double>,1>& src,
+  blitz::Array<std::complex<double>,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(m_input_length);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,1> dst_shape(m_output_length);
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  // Process
+  processNoCheck(src.data(), dst.data());
+}
+
+void bob::sp::PrunedFFT1DAbstract::operator()(
+  const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(m_input_length);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,1> dst_shape(m_output_length);
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  // Process
+  processNoCheck(src.data(), dst.data());
+}
+
+void bob::sp::PrunedFFT1DAbstract::operator()(const std::complex<double>* src,
+  std::complex<double>* dst) const
+{
+  processNoCheck(src, dst);
+}
+
+void bob::sp::PrunedFFT1DAbstract::operator()(const std::complex<float>* src,
+  std::complex<float>* dst) const
+{
+  processNoCheck(src, dst);
+}
+
+void bob::sp::PrunedFFT1DAbstract::setLength(const size_t length,
+  const size_t input_length, const size_t output_length)
+{
+  checkLengths(length, input_length, output_length);
+  m_length = length;
+  m_input_length = input_length;
+  m_output_length = output_length;
+  initWorkingArray();
+}
+
+void bob::sp::PrunedFFT1DAbstract::setEngine(const bob::sp::FFTPlanBase::Engine engine)
+{
+  // Fetches the plan first, which throws if the engine is not available
+  m_plans.reset(m_group_length, bob::sp::FFTPlanBase::Complex, engine);
+  m_engine = engine;
+}
+
+void bob::sp::PrunedFFT1DAbstract::initWorkingArray()
+{
+  // N = P*L, with L >= K, and L = Q*S, with S >= the number of outputs
+  // required from each transform of length L. The input and output pruning
+  // are only used if they save more operations than their extra passes over
+  // the data cost: halving the length, as DCT1D does, only saves about one
+  // pass per pruning.
+  const size_t N = m_length, K = m_input_length, M = m_output_length;
+  double best_cost = 0.;
+  for (int prune=0; prune<4; ++prune) {
+    const size_t L = (prune & 1 ? smallestDivisor(N, K) : N);
+    const size_t P = N / L;
+    const size_t M0 = (M + P - 1) / P;
+    const size_t S = (prune & 2 ? smallestDivisor(L, M0) : L);
+    const size_t Q = L / S;
+    const double cost = N * log2((double)S) + (P > 1 ? 2.*N : 0.) +
+      (Q > 1 ? (double)N : 0.) + 2. * (Q - 1) * M + CALL_COST * P * Q;
+    if (prune == 0 || cost < best_cost) {
+      best_cost = cost;
+      m_split = P;
+      m_split_length = L;
+      m_group_outputs = M0;
+      m_group_length = S;
+      m_groups = Q;
+    }
+  }
+
+  // Input twiddle factors W_N^(j*r), for 0 < r < P and j < K
+  m_input_twiddles.resize((m_split-1) * m_input_length);
+  for (size_t r=1; r<m_split; ++r)
+    for (size_t j=0; j<m_input_length; ++j)
+      m_input_twiddles[(r-1)*m_input_length + j] = twiddle(j*r, m_length);
+
+  // Output twiddle factors W_L^(s*k), for 0 < s < Q and the required k
+  m_output_twiddles.resize((m_groups-1) * m_group_outputs);
+  for (size_t s=1; s<m_groups; ++s)
+    for (size_t k=0; k<m_group_outputs; ++k)
+      m_output_twiddles[(s-1)*m_group_outputs + k] = twiddle(s*k, m_split_length);
+
+  m_plans.reset(m_group_length, bob::sp::FFTPlanBase::Complex, m_engine);
+}
+
+template <typename T>
+void bob::sp::PrunedFFT1DAbstract::process(const std::complex<T>* src,
+  std::complex<T>* dst, const bool inverse) const
+{
+  // The inverse transform uses the conjugate twiddle factors
+  const size_t K = m_input_length, M = m_output_length;
+  const size_t P = m_split, L = m_split_length;
+  const size_t Q = m_groups, S = m_group_length;
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  const size_t rows = std::min(P, M);
+  bob::sp::detail::Workspace<T> ws(2*rows*L + plan.getWorkSize());
+  const T* x = reinterpret_cast<const T*>(src);
+  T* y = reinterpret_cast<T*>(dst);
+  T* work = ws.data() + 2*rows*L;
+  const T sign = (inverse ? -1 : 1);
+  const T scale = (inverse ? (T)1 / (T)m_length : (T)1);
+
+  // Each of the P transforms of length L (rows of the workspace) provides
+  // the outputs P*k+r < M, r being the index of the row
+  for (size_t r=0; r<rows; ++r) {
+    T* z = ws.data() + 2*r*L;
+
+    // 1. Twiddles the input, and splits it into Q decimated signals of
+    //    length S, one after the other: z_s[t] = u[t*Q+s]. The input is
+    //    read by tiles of TILE*Q values, to keep the strided accesses in
+    //    cache.
+    const std::complex<double>* wi = (r > 0 ?
+        m_input_twiddles.data() + (r-1)*K : 0);
+    if (Q == 1 && !wi) std::copy(x, x + 2*K, z);
+    else for (size_t t0=0; t0*Q<K; t0+=TILE) {
+      for (size_t s=0; s<Q; ++s) {
+        T* zs = z + 2*s*S;
+        const size_t end = std::min(t0 + TILE, (K > s ? (K - s + Q - 1) / Q : 0));
+        if (!wi) {
+          for (size_t t=t0, j=t0*Q+s; t<end; ++t, j+=Q) {
+            zs[2*t] = x[2*j];
+            zs[2*t+1] = x[2*j+1];
+          }
+        }
+        else {
+          for (size_t t=t0, j=t0*Q+s; t<end; ++t, j+=Q) {
+            const T wr = (T)wi[j].real(), wim = sign * (T)wi[j].imag();
+            const T re = x[2*j], im = x[2*j+1];
+            zs[2*t] = re*wr - im*wim;
+            zs[2*t+1] = re*wim + im*wr;
+          }
+        }
+      }
+    }
+    for (size_t s=0; s<Q; ++s) {
+      const size_t filled = (K > s ? (K - s + Q - 1) / Q : 0);
+      std::fill(z + 2*s*S + 2*filled, z + 2*(s+1)*S, (T)0);
+    }
+
+    // 2. Transforms each decimated signal
+    for (size_t s=0; s<Q; ++s) {
+      if (inverse) plan.backward(z + 2*s*S, work);
+      else plan.forward(z + 2*s*S, work);
+    }
+
+    // 3. Combines them for the required outputs only
+    const size_t outputs = (M - r + P - 1) / P;
+    for (size_t s=1; s<Q; ++s) {
+      const std::complex<double>* wo = m_output_twiddles.data() +
+        (s-1)*m_group_outputs;
+      const T* zs = z + 2*s*S;
+      for (size_t k=0; k<outputs; ++k) {
+        const T wr = (T)wo[k].real(), wim = sign * (T)wo[k].imag();
+        const T re = zs[2*k], im = zs[2*k+1];
+        z[2*k] += re*wr - im*wim;
+        z[2*k+1] += re*wim + im*wr;
+      }
+    }
+  }
+
+  // 4. Interleaves the rows into the output, by tiles of TILE values of
+  //    each row
+  if (P == 1 && !inverse) std::copy(ws.data(), ws.data() + 2*M, y);
+  else for (size_t k0=0; k0*P<M; k0+=TILE) {
+    for (size_t r=0; r<rows; ++r) {
+      const T* z = ws.data() + 2*r*L;
+      const size_t end = std::min(k0 + TILE, (M - r + P - 1) / P);
+      for (size_t k=k0, o=k0*P+r; k<end; ++k, o+=P) {
+        y[2*o] = z[2*k] * scale;
+        y[2*o+1] = z[2*k+1] * scale;
+      }
+    }
+  }
+}
+
+
+bob::sp::PrunedFFT1D::PrunedFFT1D():
+  bob::sp::PrunedFFT1DAbstract()
+{
+}
+
+bob::sp::PrunedFFT1D::PrunedFFT1D(const size_t length,
+    const size_t input_length, const size_t output_length):
+  bob::sp::PrunedFFT1DAbstract(length, input_length, output_length)
+{
+}
+
+bob::sp::PrunedFFT1D::PrunedFFT1D(const bob::sp::PrunedFFT1D& other):
+  bob::sp::PrunedFFT1DAbstract(other)
+{
+}
+
+bob::sp::PrunedFFT1D::~PrunedFFT1D()
+{
+}
+
+bob::sp::PrunedFFT1D&
+bob::sp::PrunedFFT1D::operator=(const PrunedFFT1D& other)
+{
+  if (this != &other) {
+    bob::sp::PrunedFFT1DAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::PrunedFFT1D::processNoCheck(const std::complex<double>* src,
+  std::complex<double>* dst) const
+{
+  process(src, dst, false);
+}
+
+void bob::sp::PrunedFFT1D::processNoCheck(const std::complex<float>* src,
+  std::complex<float>* dst) const
+{
+  process(src, dst, false);
+}
+
+
+bob::sp::PrunedIFFT1D::PrunedIFFT1D():
+  bob::sp::PrunedFFT1DAbstract()
+{
+}
+
+bob::sp::PrunedIFFT1D::PrunedIFFT1D(const size_t length,
+    const size_t input_length, const size_t output_length):
+  bob::sp::PrunedFFT1DAbstract(length, input_length, output_length)
+{
+}
+
+bob::sp::PrunedIFFT1D::PrunedIFFT1D(const bob::sp::PrunedIFFT1D& other):
+  bob::sp::PrunedFFT1DAbstract(other)
+{
+}
+
+bob::sp::PrunedIFFT1D::~PrunedIFFT1D()
+{
+}
+
+bob::sp::PrunedIFFT1D&
+bob::sp::PrunedIFFT1D::operator=(const PrunedIFFT1D& other)
+{
+  if (this != &other) {
+    bob::sp::PrunedFFT1DAbstract::operator=(other);
+  }
+  return *this;
+}
+
+void bob::sp::PrunedIFFT1D::processNoCheck(const std::complex<double>* src,
+  std::complex<double>* dst) const
+{
+  process(src, dst, true);
+}
+
+void bob::sp::PrunedIFFT1D::processNoCheck(const std::complex<float>* src,
+  std::complex<float>* dst) const
+{
+  process(src, dst, true);
+}
@@ -0,0 +1,206 @@
+/**
+ * @date Fri Oct 16 13:21:05 CEST 2026
+ *
+ * @brief Implement a blitz-based 1D Fast Fourier Transform of real signals,
+ * based on the fftpack real transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/RFFT1D.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+
+bob::sp::RFFT1DAbstract::RFFT1DAbstract():
+  m_length(1)
+{
+  initWorkingArray();
+}
+
+bob::sp::RFFT1DAbstract::RFFT1DAbstract(const size_t length):
+  m_length(length)
+{
+  if (length < 1)
+    throw std::runtime_error("RFFT length should be at least 1.");
+  initWorkingArray();
+}
+
+bob::sp::RFFT1DAbstract::RFFT1DAbstract(
+    const bob::sp::RFFT1DAbstract& other):
+  m_length(other.m_length), m_plans(other.m_plans)
+{
+}
+
+bob::sp::RFFT1DAbstract::~RFFT1DAbstract()
+{
+}
+
+bob::sp::RFFT1DAbstract&
+bob::sp::RFFT1DAbstract::operator=(const RFFT1DAbstract& other)
+{
+  if (this != &other) {
+    m_length = other.m_length;
+    m_plans = other.m_plans;
+  }
+  return *this;
+}
+
+bool bob::sp::RFFT1DAbstract::operator==(const bob::sp::RFFT1DAbstract& b) const
+{
+  return (this->m_length == b.m_length);
+}
+
+bool bob::sp::RFFT1DAbstract::operator!=(const bob::sp::RFFT1DAbstract& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::RFFT1DAbstract::setLength(const size_t length)
+{
+  if (length < 1)
+    throw std::runtime_error("RFFT length should be at least 1.");
+  m_length = length;
+  initWorkingArray();
+}
+
+void bob::sp::RFFT1DAbstract::initWorkingArray()
+{
+  m_plans.reset(m_length, bob::sp::FFTPlan::Real);
+}
+
+
+bob::sp::RFFT1D::RFFT1D():
+  bob::sp::RFFT1DAbstract(1)
+{
+}
+
+bob::sp::RFFT1D::RFFT1D(const size_t length):
+  bob::sp::RFFT1DAbstract(length)
+{
+}
+
+bob::sp::RFFT1D::RFFT1D(const bob::sp::RFFT1D& other):
+  bob::sp::RFFT1DAbstract(other)
+{
+}
+
+bob::sp::RFFT1D::~RFFT1D()
+{
+}
+
+bob::sp::RFFT1D&
+bob::sp::RFFT1D::operator=(const RFFT1D& other)
+{
+  if (this != &other) {
+    bob::sp::RFFT1DAbstract::operator=(other);
+  }
+  return *this;
+}
+
+template <typename T>
+void bob::sp::RFFT1D::process(const blitz::Array<T,1>& src,
+  blitz::Array<std::complex<T>,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(m_length);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,1> dst_shape(getSpectrumLength());
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  // The signal is copied one value after the beginning of dst, so that the
+  // halfcomplex output of fftpack (r0, re1, im1, ...) lands at its final
+  // place, except for r0 which is moved to the real part of the first bin.
+  T* d = reinterpret_cast<T*>(dst.data());
+  std::copy(src.data(), src.data() + m_length, d + 1);
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  bob::sp::detail::Workspace<T> ws(plan.getWorkSize());
+  plan.forward(d + 1, ws.data());
+  d[0] = d[1];
+  d[1] = 0;
+  if (m_length % 2 == 0) d[m_length+1] = 0;
+}
+
+void bob::sp::RFFT1D::operator()(const blitz::Array<double,1>& src,
+  blitz::Array<std::complex<double>,1>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::RFFT1D::operator()(const blitz::Array<float,1>& src,
+  blitz::Array<std::complex<float>,1>& dst) const
+{
+  process(src, dst);
+}
+
+bob::sp::IRFFT1D::IRFFT1D():
+  bob::sp::RFFT1DAbstract(1)
+{
+}
+
+bob::sp::IRFFT1D::IRFFT1D(const size_t length):
+  bob::sp::RFFT1DAbstract(length)
+{
+}
+
+bob::sp::IRFFT1D::IRFFT1D(const bob::sp::IRFFT1D& other):
+  bob::sp::RFFT1DAbstract(other)
+{
+}
+
+bob::sp::IRFFT1D::~IRFFT1D()
+{
+}
+
+bob::sp::IRFFT1D&
+bob::sp::IRFFT1D::operator=(const IRFFT1D& other)
+{
+  if (this != &other) {
+    bob::sp::RFFT1DAbstract::operator=(other);
+  }
+  return *this;
+}
+
+template <typename T>
+void bob::sp::IRFFT1D::process(const blitz::Array<std::complex<T>,1>& src,
+  blitz::Array<T,1>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertCZeroBaseContiguous(src);
+  const blitz::TinyVector<int,1> shape(getSpectrumLength());
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,1> dst_shape(m_length);
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  // Packs the spectrum into the halfcomplex order expected by fftpack,
+  // directly into dst
+  const T* s = reinterpret_cast<const T*>(src.data());
+  T* d = dst.data();
+  d[0] = s[0];
+  std::copy(s + 2, s + m_length + 1, d + 1);
+  const bob::sp::BasicFFTPlan<T>& plan = m_plans.get<T>();
+  bob::sp::detail::Workspace<T> ws(plan.getWorkSize());
+  plan.backward(d, ws.data());
+  const T scale = (T)1 / (T)m_length;
+  for (size_t i=0; i<m_length; ++i) d[i] *= scale;
+}
+
+void bob::sp::IRFFT1D::operator()(const blitz::Array<std::complex<double>,1>& src,
+  blitz::Array<double,1>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::IRFFT1D::operator()(const blitz::Array<std::complex<float>,1>& src,
+  blitz::Array<float,1>& dst) const
+{
+  process(src, dst);
+}
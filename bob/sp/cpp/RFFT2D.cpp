@@ -0,0 +1,281 @@
+/**
+ * @date Fri Oct 16 14:32:18 CEST 2026
+ *
+ * @brief Implement a blitz-based 2D Fast Fourier Transform of real signals,
+ * based on the fftpack real transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/RFFT2D.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+bob::sp::RFFT2DAbstract::RFFT2DAbstract():
+  m_height(1), m_width(1)
+{
+}
+
+bob::sp::RFFT2DAbstract::RFFT2DAbstract(
+    const size_t height, const size_t width):
+  m_height(height), m_width(width)
+{
+  if (m_height < 1)
+    throw std::runtime_error("RFFT height should be at least 1.");
+  if (m_width < 1)
+    throw std::runtime_error("RFFT width should be at least 1.");
+}
+
+bob::sp::RFFT2DAbstract::RFFT2DAbstract(
+    const bob::sp::RFFT2DAbstract& other):
+  m_height(other.m_height), m_width(other.m_width)
+{
+}
+
+bob::sp::RFFT2DAbstract::~RFFT2DAbstract()
+{
+}
+
+bob::sp::RFFT2DAbstract&
+bob::sp::RFFT2DAbstract::operator=(const RFFT2DAbstract& other)
+{
+  if (this != &other) {
+    m_height = other.m_height;
+    m_width = other.m_width;
+  }
+  return *this;
+}
+
+bool bob::sp::RFFT2DAbstract::operator==(const bob::sp::RFFT2DAbstract& b) const
+{
+  return (this->m_height == b.m_height && this->m_width == b.m_width);
+}
+
+bool bob::sp::RFFT2DAbstract::operator!=(const bob::sp::RFFT2DAbstract& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::RFFT2DAbstract::setHeight(const size_t height)
+{
+  if (height < 1)
+    throw std::runtime_error("RFFT height should be at least 1.");
+  m_height = height;
+}
+
+void bob::sp::RFFT2DAbstract::setWidth(const size_t width)
+{
+  if (width < 1)
+    throw std::runtime_error("RFFT width should be at least 1.");
+  m_width = width;
+}
+
+void bob::sp::RFFT2DAbstract::setShape(const size_t height, const size_t width)
+{
+  if (height < 1)
+    throw std::runtime_error("RFFT height should be at least 1.");
+  if (width < 1)
+    throw std::runtime_error("RFFT width should be at least 1.");
+  m_height = height;
+  m_width = width;
+}
+
+
+bob::sp::RFFT2D::RFFT2D():
+  bob::sp::RFFT2DAbstract(1,1),
+  m_fft_h(1), m_rfft_w(1)
+{
+}
+
+bob::sp::RFFT2D::RFFT2D(const size_t height, const size_t width):
+  bob::sp::RFFT2DAbstract(height, width),
+  m_fft_h(height),
+  m_rfft_w(width)
+{
+}
+
+bob::sp::RFFT2D::RFFT2D(const bob::sp::RFFT2D& other):
+  bob::sp::RFFT2DAbstract(other),
+  m_fft_h(other.m_fft_h),
+  m_rfft_w(other.m_rfft_w)
+{
+}
+
+bob::sp::RFFT2D::~RFFT2D()
+{
+}
+
+bob::sp::RFFT2D&
+bob::sp::RFFT2D::operator=(const RFFT2D& other)
+{
+  if (this != &other) {
+    bob::sp::RFFT2DAbstract::operator=(other);
+    m_fft_h = other.m_fft_h;
+    m_rfft_w = other.m_rfft_w;
+  }
+  return *this;
+}
+
+void bob::sp::RFFT2D::setHeight(const size_t height)
+{
+  bob::sp::RFFT2DAbstract::setHeight(height);
+  m_fft_h.setLength(height);
+}
+
+void bob::sp::RFFT2D::setWidth(const size_t width)
+{
+  bob::sp::RFFT2DAbstract::setWidth(width);
+  m_rfft_w.setLength(width);
+}
+
+void bob::sp::RFFT2D::setShape(const size_t height, const size_t width)
+{
+  bob::sp::RFFT2DAbstract::setShape(height, width);
+  m_fft_h.setLength(height);
+  m_rfft_w.setLength(width);
+}
+
+template <typename T>
+void bob::sp::RFFT2D::process(const blitz::Array<T,2>& src,
+  blitz::Array<std::complex<T>,2>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertZeroBase(src);
+  const blitz::TinyVector<int,2> shape(m_height, m_width);
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,2> dst_shape(m_height, getSpectrumWidth());
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  // Compute the real FFT of the rows, directly into dst
+  blitz::Range rall = blitz::Range::all();
+  for (int i=0; i<(int)m_height; ++i) {
+    const blitz::Array<T,1> srci = src(i, rall);
+    blitz::Array<std::complex<T>,1> dsti = dst(i, rall);
+    m_rfft_w(srci, dsti);
+  }
+  // Compute the complex FFT of the non-redundant columns only
+  bob::sp::detail::Workspace<std::complex<T>> ws(m_height);
+  blitz::Array<std::complex<T>,1> buffer_h = ws(0, m_height);
+  for (int j=0; j<(int)getSpectrumWidth(); ++j) {
+    blitz::Array<std::complex<T>,1> dstj = dst(rall, j);
+    buffer_h = dstj;
+    m_fft_h(buffer_h);
+    dstj = buffer_h;
+  }
+}
+
+void bob::sp::RFFT2D::operator()(const blitz::Array<double,2>& src,
+  blitz::Array<std::complex<double>,2>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::RFFT2D::operator()(const blitz::Array<float,2>& src,
+  blitz::Array<std::complex<float>,2>& dst) const
+{
+  process(src, dst);
+}
+
+
+bob::sp::IRFFT2D::IRFFT2D():
+  bob::sp::RFFT2DAbstract(1,1),
+  m_ifft_h(1), m_irfft_w(1)
+{
+}
+
+bob::sp::IRFFT2D::IRFFT2D(const size_t height, const size_t width):
+  bob::sp::RFFT2DAbstract(height, width),
+  m_ifft_h(height),
+  m_irfft_w(width)
+{
+}
+
+bob::sp::IRFFT2D::IRFFT2D(const bob::sp::IRFFT2D& other):
+  bob::sp::RFFT2DAbstract(other),
+  m_ifft_h(other.m_ifft_h),
+  m_irfft_w(other.m_irfft_w)
+{
+}
+
+bob::sp::IRFFT2D::~IRFFT2D()
+{
+}
+
+bob::sp::IRFFT2D&
+bob::sp::IRFFT2D::operator=(const IRFFT2D& other)
+{
+  if (this != &other) {
+    bob::sp::RFFT2DAbstract::operator=(other);
+    m_ifft_h = other.m_ifft_h;
+    m_irfft_w = other.m_irfft_w;
+  }
+  return *this;
+}
+
+void bob::sp::IRFFT2D::setHeight(const size_t height)
+{
+  bob::sp::RFFT2DAbstract::setHeight(height);
+  m_ifft_h.setLength(height);
+}
+
+void bob::sp::IRFFT2D::setWidth(const size_t width)
+{
+  bob::sp::RFFT2DAbstract::setWidth(width);
+  m_irfft_w.setLength(width);
+}
+
+void bob::sp::IRFFT2D::setShape(const size_t height, const size_t width)
+{
+  bob::sp::RFFT2DAbstract::setShape(height, width);
+  m_ifft_h.setLength(height);
+  m_irfft_w.setLength(width);
+}
+
+template <typename T>
+void bob::sp::IRFFT2D::process(const blitz::Array<std::complex<T>,2>& src,
+  blitz::Array<T,2>& dst) const
+{
+  // Check input, inclusive dimension
+  bob::core::array::assertZeroBase(src);
+  const blitz::TinyVector<int,2> shape(m_height, getSpectrumWidth());
+  bob::core::array::assertSameShape(src, shape);
+
+  // Check output
+  bob::core::array::assertCZeroBaseContiguous(dst);
+  const blitz::TinyVector<int,2> dst_shape(m_height, m_width);
+  bob::core::array::assertSameShape(dst, dst_shape);
+
+  const size_t width = getSpectrumWidth();
+  bob::sp::detail::Workspace<std::complex<T>> ws(m_height*width + m_height);
+  blitz::Array<std::complex<T>,2> buffer_hw = ws(0, m_height, width);
+  blitz::Array<std::complex<T>,1> buffer_h = ws(m_height*width, m_height);
+  blitz::Range rall = blitz::Range::all();
+  // Compute the complex inverse FFT of the non-redundant columns
+  for (int j=0; j<(int)width; ++j) {
+    buffer_h = src(rall, j);
+    m_ifft_h(buffer_h);
+    blitz::Array<std::complex<T>,1> bufj = buffer_hw(rall, j);
+    bufj = buffer_h;
+  }
+  // Compute the real inverse FFT of the rows, directly into dst
+  for (int i=0; i<(int)m_height; ++i) {
+    const blitz::Array<std::complex<T>,1> bufi = buffer_hw(i, rall);
+    blitz::Array<T,1> dsti = dst(i, rall);
+    m_irfft_w(bufi, dsti);
+  }
+}
+
+void bob::sp::IRFFT2D::operator()(const blitz::Array<std::complex<double>,2>& src,
+  blitz::Array<double,2>& dst) const
+{
+  process(src, dst);
+}
+
+void bob::sp::IRFFT2D::operator()(const blitz::Array<std::complex<float>,2>& src,
+  blitz::Array<float,2>& dst) const
+{
+  process(src, dst);
+}
@@ -0,0 +1,305 @@
+/**
+ * @date Sat Oct 17 14:18:32 CEST 2026
+ *
+ * @brief Implement a blitz-based sliding Discrete Fourier Transform, which
+ * updates the spectrum of a window moving over a stream of samples
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/SlidingDFT.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/format.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * exp(-2*i*pi*k/n), with k reduced modulo n beforehand, to keep the
+   * accuracy for large k
+   */
+  std::complex<double> twiddle(const size_t k, const size_t n) {
+    const double PI = boost::math::constants::pi<double>();
+    const double arg = 2. * PI * (double)(k % n) / (double)n;
+    return std::complex<double>(cos(arg), -sin(arg));
+  }
+
+  /**
+   * Default refresh interval, in windows
+   */
+  const size_t REFRESH_WINDOWS = 16;
+
+  /**
+   * Rough cost of an FFT of length n (with the copies of the window), and of
+   * an update of a bin by a sample, relatively to the one of a butterfly
+   */
+  double fftCost(const size_t n) {
+    return n * std::max(log2((double)n), 1.) + 256.;
+  }
+
+  const double UPDATE_COST = 2.;
+
+  void checkBins(const size_t length, const std::vector<size_t>& bins) {
+    for (size_t i=0; i<bins.size(); ++i) {
+      if (bins[i] >= length) {
+        boost::format m("sliding DFT bin %lu should be in [0, %lu[.");
+        m % bins[i] % length;
+        throw std::runtime_error(m.str());
+      }
+    }
+  }
+
+  std::vector<size_t> allBins(const size_t length) {
+    std::vector<size_t> res(length);
+    for (size_t k=0; k<length; ++k) res[k] = k;
+    return res;
+  }
+
+}
+
+bob::sp::SlidingDFT::SlidingDFT():
+  m_length(1), m_bins(allBins(1)), m_refresh_interval(REFRESH_WINDOWS)
+{
+  initWorkingArray();
+}
+
+bob::sp::SlidingDFT::SlidingDFT(const size_t length):
+  m_length(length), m_bins(allBins(length)),
+  m_refresh_interval(REFRESH_WINDOWS * length)
+{
+  if (length < 1)
+    throw std::runtime_error("sliding DFT length should be at least 1.");
+  initWorkingArray();
+}
+
+bob::sp::SlidingDFT::SlidingDFT(const size_t length,
+    const std::vector<size_t>& bins):
+  m_length(length), m_bins(bins),
+  m_refresh_interval(REFRESH_WINDOWS * length)
+{
+  if (length < 1)
+    throw std::runtime_error("sliding DFT length should be at least 1.");
+  checkBins(length, bins);
+  initWorkingArray();
+}
+
+bob::sp::SlidingDFT::SlidingDFT(const bob::sp::SlidingDFT& other):
+  m_length(other.m_length), m_bins(other.m_bins),
+  m_refresh_interval(other.m_refresh_interval),
+  m_twiddles(other.m_twiddles), m_rotations(other.m_rotations),
+  m_window(other.m_window),
+  m_spectrum(other.m_spectrum), m_position(other.m_position),
+  m_pending(other.m_pending), m_plans(other.m_plans)
+{
+}
+
+bob::sp::SlidingDFT::~SlidingDFT()
+{
+}
+
+bob::sp::SlidingDFT&
+bob::sp::SlidingDFT::operator=(const SlidingDFT& other)
+{
+  if (this != &other) {
+    m_length = other.m_length;
+    m_bins = other.m_bins;
+    m_refresh_interval = other.m_refresh_interval;
+    m_twiddles = other.m_twiddles;
+    m_rotations = other.m_rotations;
+    m_window = other.m_window;
+    m_spectrum = other.m_spectrum;
+    m_position = other.m_position;
+    m_pending = other.m_pending;
+    m_plans = other.m_plans;
+  }
+  return *this;
+}
+
+bool bob::sp::SlidingDFT::operator==(const bob::sp::SlidingDFT& b) const
+{
+  return (this->m_length == b.m_length && this->m_bins == b.m_bins &&
+      this->m_refresh_interval == b.m_refresh_interval);
+}
+
+bool bob::sp::SlidingDFT::operator!=(const bob::sp::SlidingDFT& b) const
+{
+  return !(this->operator==(b));
+}
+
+void bob::sp::SlidingDFT::operator()(
+  const blitz::Array<std::complex<double>,1>& src)
+{
+  bob::core::array::assertZeroBase(src);
+  update(src);
+}
+
+void bob::sp::SlidingDFT::operator()(const blitz::Array<double,1>& src)
+{
+  bob::core::array::assertZeroBase(src);
+  update(src);
+}
+
+void bob::sp::SlidingDFT::getSpectrum(
+  blitz::Array<std::complex<double>,1>& dst) const
+{
+  bob::core::array::assertZeroBase(dst);
+  const blitz::TinyVector<int,1> shape(m_bins.size());
+  bob::core::array::assertSameShape(dst, shape);
+  for (size_t i=0; i<m_bins.size(); ++i) dst((int)i) = m_spectrum[i];
+}
+
+void bob::sp::SlidingDFT::reset()
+{
+  std::fill(m_window.begin(), m_window.end(), std::complex<double>(0));
+  std::fill(m_spectrum.begin(), m_spectrum.end(), std::complex<double>(0));
+  m_position = 0;
+  m_pending = 0;
+}
+
+void bob::sp::SlidingDFT::setLength(const size_t length)
+{
+  if (length < 1)
+    throw std::runtime_error("sliding DFT length should be at least 1.");
+  m_length = length;
+  m_bins = allBins(length);
+  m_refresh_interval = REFRESH_WINDOWS * length;
+  initWorkingArray();
+}
+
+void bob::sp::SlidingDFT::setBins(const std::vector<size_t>& bins)
+{
+  checkBins(m_length, bins);
+  m_bins = bins;
+  initRotations();
+  m_spectrum.resize(bins.size());
+  refresh();
+}
+
+void bob::sp::SlidingDFT::initWorkingArray()
+{
+  m_twiddles.resize(m_length);
+  for (size_t t=0; t<m_length; ++t) m_twiddles[t] = twiddle(t, m_length);
+  initRotations();
+  m_window.resize(m_length);
+  m_spectrum.resize(m_bins.size());
+  reset();
+  m_plans.reset(m_length, bob::sp::FFTPlanBase::Complex);
+}
+
+void bob::sp::SlidingDFT::initRotations()
+{
+  m_rotations.resize(m_bins.size());
+  for (size_t i=0; i<m_bins.size(); ++i)
+    m_rotations[i] = std::conj(m_twiddles[m_bins[i]]);
+}
+
+void bob::sp::SlidingDFT::refresh()
+{
+  const size_t N = m_length, K = m_bins.size();
+  const std::complex<double>* oldest = m_window.data() + m_position;
+  m_pending = 0;
+
+  if (UPDATE_COST * N * K > fftCost(N)) {
+    // FFT of the window, from its oldest sample
+    const bob::sp::BasicFFTPlan<double>& plan = m_plans.get<double>();
+    bob::sp::detail::Workspace<double> ws(2*N + plan.getWorkSize());
+    std::complex<double>* z = reinterpret_cast<std::complex<double>*>(ws.data());
+    std::copy(m_window.data() + m_position, m_window.data() + N, z);
+    std::copy(m_window.data(), m_window.data() + m_position, z + N - m_position);
+    plan.forward(ws.data(), ws.data() + 2*N);
+    for (size_t i=0; i<K; ++i) m_spectrum[i] = z[m_bins[i]];
+    return;
+  }
+
+  // Direct sums, for a few bins
+  const double* tw = reinterpret_cast<const double*>(m_twiddles.data());
+  for (size_t i=0; i<K; ++i) {
+    const size_t k = m_bins[i];
+    const double* x = reinterpret_cast<const double*>(oldest);
+    double re = 0., im = 0.;
+    for (size_t m=0, t=0; m<N; ++m, x+=2) {
+      if (m == N - m_position) x = reinterpret_cast<const double*>(m_window.data());
+      re += x[0]*tw[2*t] - x[1]*tw[2*t+1];
+      im += x[0]*tw[2*t+1] + x[1]*tw[2*t];
+      t += k; if (t >= N) t -= N;
+    }
+    m_spectrum[i] = std::complex<double>(re, im);
+  }
+}
+
+template <typename T>
+void bob::sp::SlidingDFT::update(const blitz::Array<T,1>& src)
+{
+  const size_t N = m_length, K = m_bins.size();
+  const size_t h = src.extent(0);
+  if (h == 0) return;
+
+  // Large hops: recomputing the spectrum is cheaper than updating it. Only
+  // the last N samples are then pushed into the window.
+  const bool recompute =
+    (UPDATE_COST * h * K >= std::min(UPDATE_COST * N * K, fftCost(N)));
+  if (recompute) {
+    const size_t first = (h > N ? h - N : 0);
+    m_position = (m_position + first) % N;
+    for (size_t j=first; j<h; ++j) {
+      m_window[m_position] = std::complex<double>(src((int)j));
+      if (++m_position == N) m_position = 0;
+    }
+    refresh();
+    return;
+  }
+
+  const double* tw = reinterpret_cast<const double*>(m_twiddles.data());
+  double* X = reinterpret_cast<double*>(m_spectrum.data());
+
+  if (h == 1) {
+    // X'_k = W^(-k) * (X_k + x_N - x_0)
+    const std::complex<double> x(src(0));
+    const std::complex<double> delta = x - m_window[m_position];
+    m_window[m_position] = x;
+    if (++m_position == N) m_position = 0;
+    const double dr = delta.real(), di = delta.imag();
+    const double* w = reinterpret_cast<const double*>(m_rotations.data());
+    for (size_t i=0; i<K; ++i) {
+      const double re = X[2*i] + dr, im = X[2*i+1] + di;
+      const double wr = w[2*i], wi = w[2*i+1];
+      X[2*i] = re*wr - im*wi;
+      X[2*i+1] = re*wi + im*wr;
+    }
+  }
+  else {
+    // Pushes the samples into the window, keeping their differences with
+    // the (oldest) samples they replace
+    bob::sp::detail::Workspace<std::complex<double> > ws(h);
+    std::complex<double>* delta = ws.data();
+    for (size_t j=0; j<h; ++j) {
+      const std::complex<double> x(src((int)j));
+      delta[j] = x - m_window[m_position];
+      m_window[m_position] = x;
+      if (++m_position == N) m_position = 0;
+    }
+
+    // X'_k = W^(-k*h) * (X_k + sum_j delta_j * W^(k*j)), with h < N
+    const double* d = reinterpret_cast<const double*>(delta);
+    for (size_t i=0; i<K; ++i) {
+      const size_t k = m_bins[i];
+      double re = X[2*i], im = X[2*i+1];
+      for (size_t j=0, t=0; j<h; ++j) {
+        re += d[2*j]*tw[2*t] - d[2*j+1]*tw[2*t+1];
+        im += d[2*j]*tw[2*t+1] + d[2*j+1]*tw[2*t];
+        t += k; if (t >= N) t -= N;
+      }
+      const size_t t = (k * h) % N;
+      const double wr = tw[2*t], wi = -tw[2*t+1];
+      X[2*i] = re*wr - im*wi;
+      X[2*i+1] = re*wi + im*wr;
+    }
+  }
+
+  m_pending += h;
+  if (m_refresh_interval > 0 && m_pending >= m_refresh_interval) refresh();
+}
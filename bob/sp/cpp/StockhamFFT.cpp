@@ -0,0 +1,294 @@
+/**
+ * @date Fri Oct 16 23:05:19 CEST 2026
+ *
+ * @brief Native engine of the complex 1D Fast Fourier Transforms, based on
+ * the Stockham autosort algorithm
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/StockhamFFT.h>
+
+#include <algorithm>
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+
+namespace {
+
+  /**
+   * The passes read the k-th input of the butterfly (p, q) at x[q+s*(p+k*m)]
+   * and write its j-th output, multiplied by the j-th twiddle factor of p,
+   * at y[q+s*(r*p+j)] (in complex values), r being the radix of the pass.
+   * The q loop is the innermost: all its butterflies share the same twiddle
+   * factors, and read and write contiguous values. The inverse transforms
+   * use the conjugate twiddle factors and roots of unity.
+   */
+
+  /**
+   * Multiplies (re, im) by the twiddle factor (wr, wi), or by its conjugate
+   */
+  template <typename T, bool inverse>
+  inline void twiddle(T& re, T& im, const T wr, const T wi) {
+    const T r = re;
+    if (inverse) {
+      re = r*wr + im*wi;
+      im = im*wr - r*wi;
+    }
+    else {
+      re = r*wr - im*wi;
+      im = im*wr + r*wi;
+    }
+  }
+
+  template <typename T, bool inverse>
+  void pass2(const size_t m, const size_t s, const T* x, T* y, const T* tw) {
+    for (size_t p=0; p<m; ++p) {
+      const T wr = tw[2*p], wi = tw[2*p+1];
+      const T* x0 = x + 2*s*p;
+      const T* x1 = x + 2*s*(p+m);
+      T* y0 = y + 2*s*(2*p);
+      T* y1 = y0 + 2*s;
+      for (size_t q=0; q<s; ++q) {
+        const T ar = x0[2*q], ai = x0[2*q+1];
+        const T br = x1[2*q], bi = x1[2*q+1];
+        T cr = ar - br, ci = ai - bi;
+        twiddle<T,inverse>(cr, ci, wr, wi);
+        y0[2*q] = ar + br; y0[2*q+1] = ai + bi;
+        y1[2*q] = cr; y1[2*q+1] = ci;
+      }
+    }
+  }
+
+  template <typename T, bool inverse>
+  void pass3(const size_t m, const size_t s, const T* x, T* y, const T* tw) {
+    // sin(2*pi/3), with the sign of the direct transform
+    const T h = (inverse ? 1 : -1) * (T)0.86602540378443864676;
+    for (size_t p=0; p<m; ++p) {
+      const T* w = tw + 4*p;
+      const T* x0 = x + 2*s*p;
+      const T* x1 = x + 2*s*(p+m);
+      const T* x2 = x + 2*s*(p+2*m);
+      T* y0 = y + 2*s*(3*p);
+      T* y1 = y0 + 2*s;
+      T* y2 = y1 + 2*s;
+      for (size_t q=0; q<s; ++q) {
+        const T ar = x0[2*q], ai = x0[2*q+1];
+        const T tr = x1[2*q] + x2[2*q], ti = x1[2*q+1] + x2[2*q+1];
+        // d = i*h*(x1-x2)
+        const T dr = -h*(x1[2*q+1] - x2[2*q+1]), di = h*(x1[2*q] - x2[2*q]);
+        const T mr = ar - (T)0.5*tr, mi = ai - (T)0.5*ti;
+        T b1r = mr + dr, b1i = mi + di;
+        T b2r = mr - dr, b2i = mi - di;
+        twiddle<T,inverse>(b1r, b1i, w[0], w[1]);
+        twiddle<T,inverse>(b2r, b2i, w[2], w[3]);
+        y0[2*q] = ar + tr; y0[2*q+1] = ai + ti;
+        y1[2*q] = b1r; y1[2*q+1] = b1i;
+        y2[2*q] = b2r; y2[2*q+1] = b2i;
+      }
+    }
+  }
+
+  template <typename T, bool inverse>
+  void pass4(const size_t m, const size_t s, const T* x, T* y, const T* tw) {
+    for (size_t p=0; p<m; ++p) {
+      const T* w = tw + 6*p;
+      const T* x0 = x + 2*s*p;
+      const T* x1 = x + 2*s*(p+m);
+      const T* x2 = x + 2*s*(p+2*m);
+      const T* x3 = x + 2*s*(p+3*m);
+      T* y0 = y + 2*s*(4*p);
+      T* y1 = y0 + 2*s;
+      T* y2 = y1 + 2*s;
+      T* y3 = y2 + 2*s;
+      for (size_t q=0; q<s; ++q) {
+        const T t0r = x0[2*q] + x2[2*q], t0i = x0[2*q+1] + x2[2*q+1];
+        const T t1r = x0[2*q] - x2[2*q], t1i = x0[2*q+1] - x2[2*q+1];
+        const T t2r = x1[2*q] + x3[2*q], t2i = x1[2*q+1] + x3[2*q+1];
+        // t3 = -i*(x1-x3) for the direct transform, i*(x1-x3) for the
+        // inverse one
+        const T ur = x1[2*q] - x3[2*q], ui = x1[2*q+1] - x3[2*q+1];
+        const T t3r = (inverse ? -ui : ui), t3i = (inverse ? ur : -ur);
+        T b1r = t1r + t3r, b1i = t1i + t3i;
+        T b2r = t0r - t2r, b2i = t0i - t2i;
+        T b3r = t1r - t3r, b3i = t1i - t3i;
+        twiddle<T,inverse>(b1r, b1i, w[0], w[1]);
+        twiddle<T,inverse>(b2r, b2i, w[2], w[3]);
+        twiddle<T,inverse>(b3r, b3i, w[4], w[5]);
+        y0[2*q] = t0r + t2r; y0[2*q+1] = t0i + t2i;
+        y1[2*q] = b1r; y1[2*q+1] = b1i;
+        y2[2*q] = b2r; y2[2*q+1] = b2i;
+        y3[2*q] = b3r; y3[2*q+1] = b3i;
+      }
+    }
+  }
+
+  template <typename T, bool inverse>
+  void pass5(const size_t m, const size_t s, const T* x, T* y, const T* tw) {
+    // cos and sin of 2*pi/5 and 4*pi/5, the sines with the sign of the
+    // direct transform
+    const T c1 = (T)0.30901699437494742410, c2 = (T)-0.80901699437494742410;
+    const T s1 = (inverse ? 1 : -1) * (T)0.95105651629515357212;
+    const T s2 = (inverse ? 1 : -1) * (T)0.58778525229247312917;
+    for (size_t p=0; p<m; ++p) {
+      const T* w = tw + 8*p;
+      const T* x0 = x + 2*s*p;
+      const T* x1 = x + 2*s*(p+m);
+      const T* x2 = x + 2*s*(p+2*m);
+      const T* x3 = x + 2*s*(p+3*m);
+      const T* x4 = x + 2*s*(p+4*m);
+      T* y0 = y + 2*s*(5*p);
+      T* y1 = y0 + 2*s;
+      T* y2 = y1 + 2*s;
+      T* y3 = y2 + 2*s;
+      T* y4 = y3 + 2*s;
+      for (size_t q=0; q<s; ++q) {
+        const T ar = x0[2*q], ai = x0[2*q+1];
+        const T t1r = x1[2*q] + x4[2*q], t1i = x1[2*q+1] + x4[2*q+1];
+        const T t2r = x2[2*q] + x3[2*q], t2i = x2[2*q+1] + x3[2*q+1];
+        const T t3r = x1[2*q] - x4[2*q], t3i = x1[2*q+1] - x4[2*q+1];
+        const T t4r = x2[2*q] - x3[2*q], t4i = x2[2*q+1] - x3[2*q+1];
+        const T m1r = ar + c1*t1r + c2*t2r, m1i = ai + c1*t1i + c2*t2i;
+        const T m2r = ar + c2*t1r + c1*t2r, m2i = ai + c2*t1i + c1*t2i;
+        // d1 = i*(s1*t3 + s2*t4), d2 = i*(s2*t3 - s1*t4)
+        const T d1r = -(s1*t3i + s2*t4i), d1i = s1*t3r + s2*t4r;
+        const T d2r = -(s2*t3i - s1*t4i), d2i = s2*t3r - s1*t4r;
+        T b1r = m1r + d1r, b1i = m1i + d1i;
+        T b2r = m2r + d2r, b2i = m2i + d2i;
+        T b3r = m2r - d2r, b3i = m2i - d2i;
+        T b4r = m1r - d1r, b4i = m1i - d1i;
+        twiddle<T,inverse>(b1r, b1i, w[0], w[1]);
+        twiddle<T,inverse>(b2r, b2i, w[2], w[3]);
+        twiddle<T,inverse>(b3r, b3i, w[4], w[5]);
+        twiddle<T,inverse>(b4r, b4i, w[6], w[7]);
+        y0[2*q] = ar + t1r + t2r; y0[2*q+1] = ai + t1i + t2i;
+        y1[2*q] = b1r; y1[2*q+1] = b1i;
+        y2[2*q] = b2r; y2[2*q+1] = b2i;
+        y3[2*q] = b3r; y3[2*q+1] = b3i;
+        y4[2*q] = b4r; y4[2*q+1] = b4i;
+      }
+    }
+  }
+
+  /**
+   * Generic pass, quadratic in the radix r: the j-th output of a butterfly
+   * is the sum of its inputs multiplied by the roots of unity of r.
+   */
+  template <typename T, bool inverse>
+  void passGeneric(const size_t r, const size_t m, const size_t s, const T* x,
+    T* y, const T* tw, const T* roots) {
+    for (size_t p=0; p<m; ++p) {
+      const T* w = tw + 2*(r-1)*p;
+      for (size_t j=0; j<r; ++j) {
+        T* yj = y + 2*s*(r*p+j);
+        for (size_t q=0; q<s; ++q) {
+          T br = 0, bi = 0;
+          for (size_t k=0, jk=0; k<r; ++k, jk=(jk+j)%r) {
+            const T* xk = x + 2*(q + s*(p+k*m));
+            const T wr = roots[2*jk], wi = (inverse ? -1 : 1) * roots[2*jk+1];
+            br += xk[0]*wr - xk[1]*wi;
+            bi += xk[1]*wr + xk[0]*wi;
+          }
+          if (j) twiddle<T,inverse>(br, bi, w[2*(j-1)], w[2*(j-1)+1]);
+          yj[2*q] = br; yj[2*q+1] = bi;
+        }
+      }
+    }
+  }
+
+}
+
+template <typename T>
+bob::sp::detail::StockhamFFT<T>::StockhamFFT():
+  m_length(0)
+{
+}
+
+template <typename T>
+void bob::sp::detail::StockhamFFT<T>::init(const size_t length)
+{
+  m_length = length;
+  m_passes.clear();
+  m_twiddles.clear();
+  m_roots.clear();
+
+  std::vector<size_t> radices;
+  size_t n = length;
+  while (n % 4 == 0) { radices.push_back(4); n /= 4; }
+  for (size_t p=2; p*p<=n; ++p)
+    while (n % p == 0) { radices.push_back(p); n /= p; }
+  if (n > 1) radices.push_back(n);
+  // The other factors follow, in increasing order
+  std::sort(radices.begin() + std::count(radices.begin(), radices.end(), 4),
+      radices.end());
+
+  // The twiddle factors of the pass over a sub-transform of length l are
+  // the powers of exp(-2*i*pi/l)
+  const double PI = boost::math::constants::pi<double>();
+  size_t l = length;
+  size_t s = 1;
+  for (size_t i=0; i<radices.size(); ++i) {
+    Pass pass;
+    pass.radix = radices[i];
+    pass.m = l / pass.radix;
+    pass.stride = s;
+    pass.twiddles = m_twiddles.size();
+    pass.roots = m_roots.size();
+    for (size_t p=0; p<pass.m; ++p)
+      for (size_t j=1; j<pass.radix; ++j) {
+        const double arg = 2. * PI * (double)((j*p) % l) / (double)l;
+        m_twiddles.push_back((T)cos(arg));
+        m_twiddles.push_back((T)-sin(arg));
+      }
+    if (pass.radix > 5)
+      for (size_t k=0; k<pass.radix; ++k) {
+        const double arg = 2. * PI * (double)k / (double)pass.radix;
+        m_roots.push_back((T)cos(arg));
+        m_roots.push_back((T)-sin(arg));
+      }
+    m_passes.push_back(pass);
+    l = pass.m;
+    s *= pass.radix;
+  }
+}
+
+template <typename T>
+template <bool inverse>
+void bob::sp::detail::StockhamFFT<T>::transform(T* data, T* work) const
+{
+  const T* x = data;
+  T* y = work;
+  for (size_t i=0; i<m_passes.size(); ++i) {
+    const Pass& p = m_passes[i];
+    const T* tw = m_twiddles.data() + p.twiddles;
+    switch (p.radix) {
+      case 2: pass2<T,inverse>(p.m, p.stride, x, y, tw); break;
+      case 3: pass3<T,inverse>(p.m, p.stride, x, y, tw); break;
+      case 4: pass4<T,inverse>(p.m, p.stride, x, y, tw); break;
+      case 5: pass5<T,inverse>(p.m, p.stride, x, y, tw); break;
+      default:
+        passGeneric<T,inverse>(p.radix, p.m, p.stride, x, y, tw,
+            m_roots.data() + p.roots);
+    }
+    // The output of this pass is the input of the next one
+    T* z = const_cast<T*>(x);
+    x = y;
+    y = z;
+  }
+  if (x != data) std::copy(x, x + 2*m_length, data);
+}
+
+template <typename T>
+void bob::sp::detail::StockhamFFT<T>::forward(T* data, T* work) const
+{
+  transform<false>(data, work);
+}
+
+template <typename T>
+void bob::sp::detail::StockhamFFT<T>::backward(T* data, T* work) const
+{
+  transform<true>(data, work);
+}
+
+// Instantiations provided by the library
+template class bob::sp::detail::StockhamFFT<double>;
+template class bob::sp::detail::StockhamFFT<float>;
@@ -0,0 +1,186 @@
+/**
+ * @date Fri Oct 16 18:40:19 CEST 2026
+ *
+ * @brief Process-wide pool of worker threads for the signal processing
+ * transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+namespace {
+
+  /**
+   * A call to parallelFor(): the indices are handed out through next, and
+   * the caller waits until done reaches count
+   */
+  struct Job {
+    Job(const std::function<void(size_t)>& fn_, const size_t count_):
+      fn(fn_), count(count_), next(0), done(0) {}
+
+    const std::function<void(size_t)>& fn;
+    const size_t count;
+    std::atomic<size_t> next;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t done;
+    std::exception_ptr error;
+  };
+
+  /**
+   * Processes indices of the job until there is none left. Late threads,
+   * which find no index left, never touch fn, which may be out of scope.
+   */
+  void run(Job& job) {
+    size_t finished = 0;
+    for (size_t i = job.next++; i < job.count; i = job.next++) {
+      try {
+        job.fn(i);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (!job.error) job.error = std::current_exception();
+      }
+      ++finished;
+    }
+    if (finished) {
+      std::lock_guard<std::mutex> lock(job.mutex);
+      job.done += finished;
+      if (job.done == job.count) job.cv.notify_all();
+    }
+  }
+
+  /**
+   * Tells if the calling thread belongs to the pool
+   */
+  thread_local bool s_worker = false;
+
+  /**
+   * Worker threads, waiting for jobs. Each job is queued once per thread
+   * requested to help its caller.
+   */
+  class Pool {
+    public:
+      Pool(): m_stop(false) {}
+
+      ~Pool() {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_stop = true;
+        }
+        m_cv.notify_all();
+        for (size_t i=0; i<m_threads.size(); ++i) m_threads[i].join();
+      }
+
+      void submit(const boost::shared_ptr<Job>& job, const size_t helpers) {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          while (m_threads.size() < helpers)
+            m_threads.push_back(std::thread(&Pool::work, this));
+          for (size_t i=0; i<helpers; ++i) m_queue.push_back(job);
+        }
+        m_cv.notify_all();
+      }
+
+    private:
+      void work() {
+        s_worker = true;
+        while (true) {
+          boost::shared_ptr<Job> job;
+          {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_stop && m_queue.empty()) m_cv.wait(lock);
+            if (m_queue.empty()) return;
+            job = m_queue.front();
+            m_queue.pop_front();
+          }
+          run(*job);
+        }
+      }
+
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      std::deque<boost::shared_ptr<Job> > m_queue;
+      std::vector<std::thread> m_threads;
+      bool m_stop;
+  };
+
+  /**
+   * The pool of the process. A child process created by fork() has none of
+   * the threads of its parent's pool: it starts with a new pool instead,
+   * the old one being leaked, as its threads cannot be joined.
+   */
+  struct PoolHolder {
+    PoolHolder(): pool(new Pool) {
+#if !defined(_WIN32)
+      pthread_atfork(0, 0, &PoolHolder::reset);
+#endif
+    }
+
+    ~PoolHolder() { delete pool; }
+
+    static void reset();
+
+    Pool* pool;
+  };
+
+  PoolHolder& holder() {
+    static PoolHolder s_holder;
+    return s_holder;
+  }
+
+  void PoolHolder::reset() {
+    holder().pool = new Pool;
+  }
+
+  Pool& pool() {
+    return *holder().pool;
+  }
+
+}
+
+size_t bob::sp::detail::resolveThreads(const size_t threads)
+{
+  if (threads > 0) return threads;
+  const size_t hw = std::thread::hardware_concurrency();
+  return (hw > 0 ? hw : 1);
+}
+
+void bob::sp::detail::parallelFor(const size_t count, const size_t threads,
+  const std::function<void(size_t)>& fn)
+{
+  const size_t n = std::min(resolveThreads(threads), count);
+  if (n <= 1 || s_worker) {
+    for (size_t i=0; i<count; ++i) fn(i);
+    return;
+  }
+
+  // The calling thread takes its share of the calls, as a worker would, so
+  // that the calls it makes are not nested in parallel either. The pool has
+  // at most one worker per hardware thread: more would only take turns on
+  // the same cores.
+  boost::shared_ptr<Job> job = boost::make_shared<Job>(fn, count);
+  pool().submit(job, std::min(n-1, resolveThreads(0)));
+  s_worker = true;
+  run(*job);
+  s_worker = false;
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  while (job->done < job->count) job->cv.wait(lock);
+  if (job->error) std::rethrow_exception(job->error);
+}
@@ -0,0 +1,96 @@
+/**
+ * @date Fri Oct 16 11:03:27 CEST 2026
+ *
+ * @brief Per-thread scratch memory for the signal processing transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/Workspace.h>
+
+#include <algorithm>
+
+namespace {
+
+  /**
+   * Largest block (in doubles, 1 MB) kept by a pool once released: larger
+   * ones, for the transforms of huge signals, are freed right away, rather
+   * than staying resident on each thread which used them
+   */
+  const size_t MAX_KEPT_SIZE = (size_t)1 << 17;
+
+  /**
+   * Number of blocks kept by a pool at most
+   */
+  const size_t MAX_KEPT_BLOCKS = 8;
+
+  /**
+   * Blocks currently not in use by the owning thread. Blocks are released
+   * when the thread terminates, or right away if they are larger than
+   * MAX_KEPT_SIZE, or if the pool already holds MAX_KEPT_BLOCKS blocks.
+   * used is the size (in bytes) of the blocks in use, and peak its largest
+   * value since the last call to scratchPeak().
+   */
+  struct ScratchPool {
+    std::vector<std::vector<double>*> free;
+    size_t used;
+    size_t peak;
+
+    ScratchPool(): used(0), peak(0) {}
+
+    ~ScratchPool() {
+      for (size_t i=0; i<free.size(); ++i) delete free[i];
+    }
+  };
+
+  thread_local ScratchPool s_pool;
+
+}
+
+std::vector<double>* bob::sp::detail::acquireScratch(const size_t size)
+{
+  // The most recently released block large enough, if any, else the most
+  // recently released one (grown), unless the block will not be kept
+  size_t i = s_pool.free.size();
+  for (size_t j=s_pool.free.size(); j>0; --j)
+    if (s_pool.free[j-1]->size() >= size) {
+      i = j-1;
+      break;
+    }
+  std::vector<double>* block;
+  if (i == s_pool.free.size() && (i == 0 || size > MAX_KEPT_SIZE))
+    block = new std::vector<double>(size);
+  else {
+    if (i == s_pool.free.size()) --i;
+    block = s_pool.free[i];
+    s_pool.free.erase(s_pool.free.begin() + i);
+    if (block->size() < size) block->resize(size);
+  }
+  s_pool.used += block->size() * sizeof(double);
+  s_pool.peak = std::max(s_pool.peak, s_pool.used);
+  return block;
+}
+
+void bob::sp::detail::releaseScratch(std::vector<double>* block)
+{
+  s_pool.used -= block->size() * sizeof(double);
+  if (block->size() > MAX_KEPT_SIZE || s_pool.free.size() >= MAX_KEPT_BLOCKS)
+    delete block;
+  else
+    s_pool.free.push_back(block);
+}
+
+size_t bob::sp::detail::scratchBytes()
+{
+  size_t bytes = 0;
+  for (size_t i=0; i<s_pool.free.size(); ++i)
+    bytes += s_pool.free[i]->capacity() * sizeof(double);
+  return bytes;
+}
+
+size_t bob::sp::detail::scratchPeak()
+{
+  const size_t peak = s_pool.peak;
+  s_pool.peak = s_pool.used;
+  return peak;
+}
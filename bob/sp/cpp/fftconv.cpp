@@ -0,0 +1,228 @@
+/**
+ * @date Sat Oct 17 18:41:27 CEST 2026
+ *
+ * @brief Implement blitz-based convolution and correlation products computed
+ * with real FFTs, for large kernels
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/fftconv.h>
+#include <bob.sp/FFTPlan.h>
+#include <bob.sp/RFFT1D.h>
+#include <bob.sp/RFFT2D.h>
+#include <bob.sp/Workspace.h>
+#include <bob.core/assert.h>
+
+#include <algorithm>
+#include <list>
+
+namespace {
+
+  /**
+   * Number of shapes whose transforms are kept by each thread
+   */
+  const size_t RECENT_SHAPES = 4;
+
+  void resize(bob::sp::RFFT1DAbstract& transform, const size_t length,
+      const size_t) {
+    transform.setLength(length);
+  }
+
+  void resize(bob::sp::RFFT2DAbstract& transform, const size_t height,
+      const size_t width) {
+    transform.setShape(height, width);
+  }
+
+  /**
+   * Direct and inverse transforms of the given shape (width being 0 in 1D)
+   */
+  template <typename Forward, typename Inverse>
+  struct Transforms {
+    size_t height;
+    size_t width;
+    Forward forward;
+    Inverse inverse;
+  };
+
+  /**
+   * Transforms of the given shape, taken from the ones of the last shapes
+   * used by the calling thread: they hold their plans, which are then not
+   * built again by repeated products of the same sizes.
+   */
+  template <typename Forward, typename Inverse>
+  const Transforms<Forward,Inverse>& recentTransforms(const size_t height,
+      const size_t width) {
+    typedef Transforms<Forward,Inverse> transforms_t;
+    thread_local std::list<transforms_t> s_recent;
+
+    typename std::list<transforms_t>::iterator it;
+    for (it=s_recent.begin(); it!=s_recent.end(); ++it)
+      if (it->height == height && it->width == width) {
+        s_recent.splice(s_recent.begin(), s_recent, it);
+        return s_recent.front();
+      }
+
+    transforms_t transforms;
+    transforms.height = height;
+    transforms.width = width;
+    resize(transforms.forward, height, width);
+    resize(transforms.inverse, height, width);
+    s_recent.push_front(transforms);
+    if (s_recent.size() > RECENT_SHAPES) s_recent.pop_back();
+    return s_recent.front();
+  }
+
+  /**
+   * Offset in the full product of the part kept by the given size option,
+   * for a kernel of the given extent (same as conv())
+   */
+  int cropOffset(const int kernel, const bob::sp::Conv::SizeOption size_opt) {
+    if (size_opt == bob::sp::Conv::Full) return 0;
+    else if (size_opt == bob::sp::Conv::Same) return (kernel-1)/2;
+    else return kernel-1;
+  }
+
+  template <typename T>
+  void fftconvInternal(const blitz::Array<T,1>& a, const blitz::Array<T,1>& b,
+      blitz::Array<T,1>& c, const bob::sp::Conv::SizeOption size_opt,
+      const bool correlate)
+  {
+    bob::core::array::assertZeroBase(a);
+    bob::core::array::assertZeroBase(b);
+    bob::core::array::assertZeroBase(c);
+    const int M = a.extent(0);
+    const int N = b.extent(0);
+    bob::core::array::assertSameShape(c, blitz::TinyVector<int,1>(
+          (int)bob::sp::getConvOutputSize(M, N, size_opt)));
+
+    // Zero padding to a fast length, large enough for the product not to
+    // wrap around
+    const size_t L = bob::sp::FFTPlanBase::nextFastLength(M + N - 1);
+    const size_t S = L/2+1;
+    const Transforms<bob::sp::RFFT1D, bob::sp::IRFFT1D>& t =
+      recentTransforms<bob::sp::RFFT1D, bob::sp::IRFFT1D>(L, 0);
+    bob::sp::detail::Workspace<T> real(L);
+    bob::sp::detail::Workspace<std::complex<T> > spectra(2*S);
+    blitz::Array<T,1> x = real(0, L);
+    blitz::Array<std::complex<T>,1> X = spectra(0, S);
+    blitz::Array<std::complex<T>,1> Y = spectra(S, S);
+
+    // X = rfft([a 0]), Y = rfft([b 0])
+    std::fill(x.data(), x.data() + L, (T)0);
+    for (int i=0; i<M; ++i) x(i) = a(i);
+    t.forward(x, X);
+    std::fill(x.data(), x.data() + M, (T)0);
+    for (int j=0; j<N; ++j) x(j) = b(correlate ? N-1-j : j);
+    t.forward(x, Y);
+
+    // x = irfft(X * Y), cropped
+    std::complex<T>* X_ = X.data();
+    const std::complex<T>* Y_ = Y.data();
+    for (size_t k=0; k<S; ++k) X_[k] *= Y_[k];
+    t.inverse(X, x);
+    const int offset = cropOffset(N, size_opt);
+    for (int i=0; i<c.extent(0); ++i) c(i) = x(offset + i);
+  }
+
+  template <typename T>
+  void fftconvInternal(const blitz::Array<T,2>& A, const blitz::Array<T,2>& B,
+      blitz::Array<T,2>& C, const bob::sp::Conv::SizeOption size_opt,
+      const bool correlate)
+  {
+    bob::core::array::assertZeroBase(A);
+    bob::core::array::assertZeroBase(B);
+    bob::core::array::assertZeroBase(C);
+    bob::core::array::assertSameShape(C,
+        bob::sp::getConvOutputSize(A, B, size_opt));
+    const int M0 = A.extent(0), M1 = A.extent(1);
+    const int N0 = B.extent(0), N1 = B.extent(1);
+
+    const size_t L0 = bob::sp::FFTPlanBase::nextFastLength(M0 + N0 - 1);
+    const size_t L1 = bob::sp::FFTPlanBase::nextFastLength(M1 + N1 - 1);
+    const size_t S1 = L1/2+1;
+    const Transforms<bob::sp::RFFT2D, bob::sp::IRFFT2D>& t =
+      recentTransforms<bob::sp::RFFT2D, bob::sp::IRFFT2D>(L0, L1);
+    bob::sp::detail::Workspace<T> real(L0*L1);
+    bob::sp::detail::Workspace<std::complex<T> > spectra(2*L0*S1);
+    blitz::Array<T,2> x = real(0, L0, L1);
+    blitz::Array<std::complex<T>,2> X = spectra(0, L0, S1);
+    blitz::Array<std::complex<T>,2> Y = spectra(L0*S1, L0, S1);
+
+    std::fill(x.data(), x.data() + L0*L1, (T)0);
+    for (int i=0; i<M0; ++i)
+      for (int j=0; j<M1; ++j) x(i,j) = A(i,j);
+    t.forward(x, X);
+    std::fill(x.data(), x.data() + L0*L1, (T)0);
+    for (int i=0; i<N0; ++i)
+      for (int j=0; j<N1; ++j)
+        x(i,j) = (correlate ? B(N0-1-i, N1-1-j) : B(i,j));
+    t.forward(x, Y);
+
+    std::complex<T>* X_ = X.data();
+    const std::complex<T>* Y_ = Y.data();
+    for (size_t k=0; k<L0*S1; ++k) X_[k] *= Y_[k];
+    t.inverse(X, x);
+    const int offset0 = cropOffset(N0, size_opt);
+    const int offset1 = cropOffset(N1, size_opt);
+    for (int i=0; i<C.extent(0); ++i)
+      for (int j=0; j<C.extent(1); ++j) C(i,j) = x(offset0 + i, offset1 + j);
+  }
+
+}
+
+void bob::sp::fftconv(const blitz::Array<double,1>& a,
+  const blitz::Array<double,1>& b, blitz::Array<double,1>& c,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(a, b, c, size_opt, false);
+}
+
+void bob::sp::fftconv(const blitz::Array<float,1>& a,
+  const blitz::Array<float,1>& b, blitz::Array<float,1>& c,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(a, b, c, size_opt, false);
+}
+
+void bob::sp::fftconv(const blitz::Array<double,2>& A,
+  const blitz::Array<double,2>& B, blitz::Array<double,2>& C,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(A, B, C, size_opt, false);
+}
+
+void bob::sp::fftconv(const blitz::Array<float,2>& A,
+  const blitz::Array<float,2>& B, blitz::Array<float,2>& C,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(A, B, C, size_opt, false);
+}
+
+void bob::sp::fftcorr(const blitz::Array<double,1>& a,
+  const blitz::Array<double,1>& b, blitz::Array<double,1>& c,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(a, b, c, size_opt, true);
+}
+
+void bob::sp::fftcorr(const blitz::Array<float,1>& a,
+  const blitz::Array<float,1>& b, blitz::Array<float,1>& c,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(a, b, c, size_opt, true);
+}
+
+void bob::sp::fftcorr(const blitz::Array<double,2>& A,
+  const blitz::Array<double,2>& B, blitz::Array<double,2>& C,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(A, B, C, size_opt, true);
+}
+
+void bob::sp::fftcorr(const blitz::Array<float,2>& A,
+  const blitz::Array<float,2>& B, blitz::Array<float,2>& C,
+  const bob::sp::Conv::SizeOption size_opt)
+{
+  fftconvInternal(A, B, C, size_opt, true);
+}
@@ -41,7 +41,11 @@
 
 #include <math.h>
 #include <stdio.h>
+
+/* fftpack_float.c compiles this file again in single precision */
+#ifndef FFTPACK_FLOAT
 #define DOUBLE
+#endif
 
 #ifdef DOUBLE
 #define Treal double
@@ -64,11 +68,24 @@ extern "C" {
    passf2, passf3, passf4, passf5, passf. Complex FFT passes fwd and bwd.
 ---------------------------------------------------------------------- */
 
+/* Vectorized versions of the radix 2, 3, 4 and 5 passes (fftpack_simd.c),
+ * which return 0 when they do not apply to the CPU or to ido */
+extern int fftpack_simd_passf2(int ido, int l1, const Treal cc[], Treal ch[],
+    const Treal wa1[], int isign);
+extern int fftpack_simd_passf3(int ido, int l1, const Treal cc[], Treal ch[],
+    const Treal wa1[], const Treal wa2[], int isign);
+extern int fftpack_simd_passf4(int ido, int l1, const Treal cc[], Treal ch[],
+    const Treal wa1[], const Treal wa2[], const Treal wa3[], int isign);
+extern int fftpack_simd_passf5(int ido, int l1, const Treal cc[], Treal ch[],
+    const Treal wa1[], const Treal wa2[], const Treal wa3[],
+    const Treal wa4[], int isign);
+
 static void passf2(int ido, int l1, const Treal cc[], Treal ch[], const Treal wa1[], int isign)
   /* isign==+1 for backward transform */
   {
     int i, k, ah, ac;
     Treal ti2, tr2;
+    if (fftpack_simd_passf2(ido, l1, cc, ch, wa1, isign)) return;
     if (ido <= 2) {
       for (k=0; k<l1; k++) {
         ah = k*ido;
@@ -103,6 +120,7 @@ static void passf3(int ido, int l1, const Treal cc[], Treal ch[],
     static const Treal taui = 0.866025403784439;
     int i, k, ac, ah;
     Treal ci2, ci3, di2, di3, cr2, cr3, dr2, dr3, ti2, tr2;
+    if (fftpack_simd_passf3(ido, l1, cc, ch, wa1, wa2, isign)) return;
     if (ido == 2) {
       for (k=1; k<=l1; k++) {
         ac = (3*k - 2)*ido;
@@ -155,6 +173,7 @@ static void passf4(int ido, int l1, const Treal cc[], Treal ch[],
   {
     int i, k, ac, ah;
     Treal ci2, ci3, ci4, cr2, cr3, cr4, ti1, ti2, ti3, ti4, tr1, tr2, tr3, tr4;
+    if (fftpack_simd_passf4(ido, l1, cc, ch, wa1, wa2, wa3, isign)) return;
     if (ido == 2) {
       for (k=0; k<l1; k++) {
         ac = 4*k*ido + 1;
@@ -220,6 +239,7 @@ static void passf5(int ido, int l1, const Treal cc[], Treal ch[],
     int i, k, ac, ah;
     Treal ci2, ci3, ci4, ci5, di3, di4, di5, di2, cr2, cr3, cr5, cr4, ti2, ti3,
         ti4, ti5, dr3, dr4, dr5, dr2, tr2, tr3, tr4, tr5;
+    if (fftpack_simd_passf5(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign)) return;
     if (ido == 2) {
       for (k = 1; k <= l1; ++k) {
         ac = (5*k - 4)*ido + 1;
@@ -834,9 +854,10 @@ static void radb5(int ido, int l1, const Treal cc[], Treal ch[],
 static void radfg(int ido, int ip, int l1, int idl1,
       Treal cc[], Treal ch[], const Treal wa[])
   {
-    static const Treal twopi = 6.28318530717959;
+    /* The rotations are computed by recurrence, in double precision */
+    static const double twopi = 6.28318530717959;
     int idij, ipph, i, j, k, l, j2, ic, jc, lc, ik, is, nbd;
-    Treal dc2, ai1, ai2, ar1, ar2, ds2, dcp, arg, dsp, ar1h, ar2h;
+    double dc2, ai1, ai2, ar1, ar2, ds2, dcp, arg, dsp, ar1h, ar2h;
     arg = twopi / ip;
     dcp = cos(arg);
     dsp = sin(arg);
@@ -1004,11 +1025,12 @@ static void radfg(int ido, int ip, int l1, int idl1,
 static void radbg(int ido, int ip, int l1, int idl1,
       Treal cc[], Treal ch[], const Treal wa[])
   {
-    static const Treal twopi = 6.28318530717959;
+    /* The rotations are computed by recurrence, in double precision */
+    static const double twopi = 6.28318530717959;
     int idij, ipph, i, j, k, l, j2, ic, jc, lc, ik, is;
-    Treal dc2, ai1, ai2, ar1, ar2, ds2;
+    double dc2, ai1, ai2, ar1, ar2, ds2;
     int nbd;
-    Treal dcp, arg, dsp, ar1h, ar2h;
+    double dcp, arg, dsp, ar1h, ar2h;
     arg = twopi / ip;
     dcp = cos(arg);
     dsp = sin(arg);
@@ -1289,21 +1311,19 @@ startloop:
   }
 
 
-static void cffti1(int n, Treal wa[], int ifac[MAXFAC+2])
+static void cffti1_twiddles(int n, Treal wa[], const int ifac[MAXFAC+2])
+  /* Twiddle factors of the factorization of n in ifac */
   {
-    static const Treal twopi = 6.28318530717959;
-    Treal arg, argh, argld, fi;
+    /* The twiddle factors are always computed in double precision */
+    static const double twopi = 6.28318530717959;
+    double arg, argh, argld, fi;
     int idot, i, j;
     int i1, k1, l1, l2;
     int ld, ii, nf, ip;
     int ido, ipm;
 
-    static const int ntryh[NSPECIAL] = {
-      3,4,2,5    }; /* Do not change the order of these. */
-
-    factorize(n,ifac,ntryh);
     nf = ifac[1];
-    argh = twopi/(Treal)n;
+    argh = twopi/(double)n;
     i = 1;
     l1 = 1;
     for (k1=1; k1<=nf; k1++) {
@@ -1334,6 +1354,16 @@ static void cffti1(int n, Treal wa[], int ifac[MAXFAC+2])
       }
       l1 = l2;
     }
+  } /* cffti1_twiddles */
+
+
+static void cffti1(int n, Treal wa[], int ifac[MAXFAC+2])
+  {
+    static const int ntryh[NSPECIAL] = {
+      3,4,2,5    }; /* Do not change the order of these. */
+
+    factorize(n,ifac,ntryh);
+    cffti1_twiddles(n, wa, ifac);
   } /* cffti1 */
 
 
@@ -1346,6 +1376,52 @@ void cffti(int n, Treal wsave[])
     cffti1(n, wsave+iw1, (int*)(wsave+iw2));
   } /* cffti */
 
+  /* ----------------------------------------------------------------------
+cfftf_plan, cfftb_plan, cffti_plan. Complex FFTs with the work array kept
+apart from the twiddle factors and the factorization (the "plan", 2*n+15
+values), so that a single plan can be shared by concurrent callers. The
+work array must hold 2*n values.
+---------------------------------------------------------------------- */
+
+void cfftf_plan(int n, Treal c[], Treal work[], const Treal plan[])
+  {
+    if (n == 1) return;
+    cfftf1(n, c, work, plan, (const int*)(plan+2*n), -1);
+  } /* cfftf_plan */
+
+
+void cfftb_plan(int n, Treal c[], Treal work[], const Treal plan[])
+  {
+    if (n == 1) return;
+    cfftf1(n, c, work, plan, (const int*)(plan+2*n), +1);
+  } /* cfftb_plan */
+
+
+void cffti_plan(int n, Treal plan[])
+  {
+    if (n == 1) return;
+    cffti1(n, plan, (int*)(plan+2*n));
+  } /* cffti_plan */
+
+
+int cffti_plan_factors(int n, Treal plan[], int nf, const int factors[])
+  {
+    int i, m = 1;
+    int *ifac = (int*)(plan+2*n);
+    if (nf > MAXFAC) return -1;
+    for (i=0; i<nf; i++) {
+      if (factors[i] < 2) return -1;
+      m *= factors[i];
+    }
+    if (m != n) return -1;
+    if (n == 1) return 0;
+    ifac[0] = n;
+    ifac[1] = nf;
+    for (i=0; i<nf; i++) ifac[i+2] = factors[i];
+    cffti1_twiddles(n, plan, ifac);
+    return 0;
+  } /* cffti_plan_factors */
+
   /* ----------------------------------------------------------------------
 rfftf1, rfftb1, rfftf, rfftb, rffti1, rffti. Treal FFTs.
 ---------------------------------------------------------------------- */
@@ -1483,8 +1559,9 @@ void rfftb(int n, Treal r[], Treal wsave[])
 
 static void rffti1(int n, Treal wa[], int ifac[MAXFAC+2])
   {
-    static const Treal twopi = 6.28318530717959;
-    Treal arg, argh, argld, fi;
+    /* The twiddle factors are always computed in double precision */
+    static const double twopi = 6.28318530717959;
+    double arg, argh, argld, fi;
     int i, j;
     int k1, l1, l2;
     int ld, ii, nf, ip, is;
@@ -1507,7 +1584,7 @@ static void rffti1(int n, Treal wa[], int ifac[MAXFAC+2])
       for (j = 1; j <= ipm; ++j) {
         ld += l1;
         i = is;
-        argld = (Treal) ld*argh;
+        argld = (double) ld*argh;
         fi = 0;
         for (ii = 3; ii <= ido; ii += 2) {
           i += 2;
@@ -1529,6 +1606,33 @@ void rffti(int n, Treal wsave[])
     rffti1(n, wsave+n, (int*)(wsave+2*n));
   } /* rffti */
 
+  /* ----------------------------------------------------------------------
+rfftf_plan, rfftb_plan, rffti_plan. Treal FFTs with the work array kept
+apart from the twiddle factors and the factorization (the "plan", n+15
+values), so that a single plan can be shared by concurrent callers. The
+work array must hold n values.
+---------------------------------------------------------------------- */
+
+void rfftf_plan(int n, Treal r[], Treal work[], const Treal plan[])
+  {
+    if (n == 1) return;
+    rfftf1(n, r, work, plan, (const int*)(plan+n));
+  } /* rfftf_plan */
+
+
+void rfftb_plan(int n, Treal r[], Treal work[], const Treal plan[])
+  {
+    if (n == 1) return;
+    rfftb1(n, r, work, plan, (const int*)(plan+n));
+  } /* rfftb_plan */
+
+
+void rffti_plan(int n, Treal plan[])
+  {
+    if (n == 1) return;
+    rffti1(n, plan, (int*)(plan+n));
+  } /* rffti_plan */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,200 @@
+/**
+ * @date Fri Oct 16 18:12:36 CEST 2026
+ *
+ * @brief Stages of the batched complex FFT, in scalar, SSE2, AVX2 and
+ * AVX-512 versions, selected at runtime with the same instruction set as
+ * the vectorized fftpack passes (see fftpack_simd.c).
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/fftpack.h>
+
+/* Scalar versions, used on other platforms or if the SIMD level is set to
+ * FFTPACK_SIMD_NONE */
+#define VR double
+#define VT double
+#define VN 1
+#define VFN(name) name##_scalar
+#define VLOAD(p) (*(p))
+#define VSTORE(p, a) (*(p) = (a))
+#define VADD(a, b) ((a) + (b))
+#define VSUB(a, b) ((a) - (b))
+#define VMUL(a, b) ((a) * (b))
+#define VSET1(x) ((double)(x))
+#include "fftpack_batch_stages.h"
+
+#define VR float
+#define VT float
+#define VN 1
+#define VFN(name) name##_scalar_float
+#define VLOAD(p) (*(p))
+#define VSTORE(p, a) (*(p) = (a))
+#define VADD(a, b) ((a) + (b))
+#define VSUB(a, b) ((a) - (b))
+#define VMUL(a, b) ((a) * (b))
+#define VSET1(x) ((float)(x))
+#include "fftpack_batch_stages.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+/* Double precision: two (SSE2), four (AVX2) and eight (AVX-512) signals
+ * per vector */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define VR double
+#define VT __m128d
+#define VN 2
+#define VFN(name) name##_sse2
+#define VLOAD(p) _mm_loadu_pd(p)
+#define VSTORE(p, a) _mm_storeu_pd(p, a)
+#define VADD(a, b) _mm_add_pd(a, b)
+#define VSUB(a, b) _mm_sub_pd(a, b)
+#define VMUL(a, b) _mm_mul_pd(a, b)
+#define VSET1(x) _mm_set1_pd(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define VR double
+#define VT __m256d
+#define VN 4
+#define VFN(name) name##_avx2
+#define VLOAD(p) _mm256_loadu_pd(p)
+#define VSTORE(p, a) _mm256_storeu_pd(p, a)
+#define VADD(a, b) _mm256_add_pd(a, b)
+#define VSUB(a, b) _mm256_sub_pd(a, b)
+#define VMUL(a, b) _mm256_mul_pd(a, b)
+#define VSET1(x) _mm256_set1_pd(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define VR double
+#define VT __m512d
+#define VN 8
+#define VFN(name) name##_avx512
+#define VLOAD(p) _mm512_loadu_pd(p)
+#define VSTORE(p, a) _mm512_storeu_pd(p, a)
+#define VADD(a, b) _mm512_add_pd(a, b)
+#define VSUB(a, b) _mm512_sub_pd(a, b)
+#define VMUL(a, b) _mm512_mul_pd(a, b)
+#define VSET1(x) _mm512_set1_pd(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+/* Single precision: four, eight and sixteen signals per vector */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define VR float
+#define VT __m128
+#define VN 4
+#define VFN(name) name##_sse2_float
+#define VLOAD(p) _mm_loadu_ps(p)
+#define VSTORE(p, a) _mm_storeu_ps(p, a)
+#define VADD(a, b) _mm_add_ps(a, b)
+#define VSUB(a, b) _mm_sub_ps(a, b)
+#define VMUL(a, b) _mm_mul_ps(a, b)
+#define VSET1(x) _mm_set1_ps(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define VR float
+#define VT __m256
+#define VN 8
+#define VFN(name) name##_avx2_float
+#define VLOAD(p) _mm256_loadu_ps(p)
+#define VSTORE(p, a) _mm256_storeu_ps(p, a)
+#define VADD(a, b) _mm256_add_ps(a, b)
+#define VSUB(a, b) _mm256_sub_ps(a, b)
+#define VMUL(a, b) _mm256_mul_ps(a, b)
+#define VSET1(x) _mm256_set1_ps(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define VR float
+#define VT __m512
+#define VN 16
+#define VFN(name) name##_avx512_float
+#define VLOAD(p) _mm512_loadu_ps(p)
+#define VSTORE(p, a) _mm512_storeu_ps(p, a)
+#define VADD(a, b) _mm512_add_ps(a, b)
+#define VSUB(a, b) _mm512_sub_ps(a, b)
+#define VMUL(a, b) _mm512_mul_ps(a, b)
+#define VSET1(x) _mm512_set1_ps(x)
+#include "fftpack_batch_stages.h"
+#pragma GCC pop_options
+
+void fftpack_batch_stage(int p, int m, int sl, const double xr[],
+    const double xi[], double yr[], double yi[], const double twr[],
+    const double twi[], const double rootr[], const double rooti[], int isign)
+{
+  switch (fftpack_simd_level()) {
+    case FFTPACK_SIMD_AVX512:
+      batch_stage_avx512(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+          isign);
+      break;
+    case FFTPACK_SIMD_AVX2:
+      batch_stage_avx2(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+          isign);
+      break;
+    case FFTPACK_SIMD_SSE2:
+      batch_stage_sse2(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+          isign);
+      break;
+    default:
+      batch_stage_scalar(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+          isign);
+  }
+}
+
+void fftpack_batch_stage_float(int p, int m, int sl, const float xr[],
+    const float xi[], float yr[], float yi[], const float twr[],
+    const float twi[], const float rootr[], const float rooti[], int isign)
+{
+  switch (fftpack_simd_level()) {
+    case FFTPACK_SIMD_AVX512:
+      batch_stage_avx512_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr,
+          rooti, isign);
+      break;
+    case FFTPACK_SIMD_AVX2:
+      batch_stage_avx2_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr,
+          rooti, isign);
+      break;
+    case FFTPACK_SIMD_SSE2:
+      batch_stage_sse2_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr,
+          rooti, isign);
+      break;
+    default:
+      batch_stage_scalar_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr,
+          rooti, isign);
+  }
+}
+
+#else
+
+void fftpack_batch_stage(int p, int m, int sl, const double xr[],
+    const double xi[], double yr[], double yi[], const double twr[],
+    const double twi[], const double rootr[], const double rooti[], int isign)
+{
+  batch_stage_scalar(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+      isign);
+}
+
+void fftpack_batch_stage_float(int p, int m, int sl, const float xr[],
+    const float xi[], float yr[], float yi[], const float twr[],
+    const float twi[], const float rootr[], const float rooti[], int isign)
+{
+  batch_stage_scalar_float(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti,
+      isign);
+}
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @date Fri Oct 16 18:12:36 CEST 2026
+ *
+ * @brief Radix 2, 3, 4, 5 and generic stages of the batched (Stockham)
+ * complex FFT, written once in terms of the vector primitives defined by
+ * fftpack_batch.c, and included once per instruction set.
+ *
+ * The data of a batch is stored in split format (real and imaginary parts
+ * in separate arrays), the signals being interleaved: a vector of type VT
+ * holds VN values of type VR, which belong to VN different signals at the
+ * same position. The runs of sl values processed by a stage are hence
+ * always a multiple of VN long, and no shuffle is ever required. The
+ * vector primitives are undefined at the end of this file.
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+/* Stores a*w into (br, bi), a being twiddled if tw is not 0 */
+static inline void VFN(store_tw)(VR* br, VR* bi, VT ar, VT ai, VT wr, VT wi,
+    int tw)
+{
+  if (tw) {
+    VSTORE(br, VSUB(VMUL(ar, wr), VMUL(ai, wi)));
+    VSTORE(bi, VADD(VMUL(ar, wi), VMUL(ai, wr)));
+  }
+  else {
+    VSTORE(br, ar);
+    VSTORE(bi, ai);
+  }
+}
+
+static void VFN(batch2)(int m, int sl, const VR xr[], const VR xi[],
+    VR yr[], VR yi[], const VR twr[], const VR twi[], int isign)
+{
+  int i, q;
+  for (i=0; i<m; i++) {
+    const VR* ar = xr + i*sl;
+    const VR* ai = xi + i*sl;
+    VR* br = yr + 2*i*sl;
+    VR* bi = yi + 2*i*sl;
+    const VT w1r = VSET1(twr[i]), w1i = VSET1(isign*twi[i]);
+    for (q=0; q<sl; q+=VN) {
+      const VT a0r = VLOAD(ar + q), a0i = VLOAD(ai + q);
+      const VT a1r = VLOAD(ar + m*sl + q), a1i = VLOAD(ai + m*sl + q);
+      VSTORE(br + q, VADD(a0r, a1r));
+      VSTORE(bi + q, VADD(a0i, a1i));
+      VFN(store_tw)(br + sl + q, bi + sl + q, VSUB(a0r, a1r), VSUB(a0i, a1i),
+          w1r, w1i, i);
+    }
+  }
+}
+
+static void VFN(batch3)(int m, int sl, const VR xr[], const VR xi[],
+    VR yr[], VR yi[], const VR twr[], const VR twi[], int isign)
+{
+  const VT taur = VSET1(-0.5);
+  const VT taui = VSET1(isign*0.866025403784439);
+  int i, q;
+  for (i=0; i<m; i++) {
+    const VR* ar = xr + i*sl;
+    const VR* ai = xi + i*sl;
+    VR* br = yr + 3*i*sl;
+    VR* bi = yi + 3*i*sl;
+    const VT w1r = VSET1(twr[2*i]), w1i = VSET1(isign*twi[2*i]);
+    const VT w2r = VSET1(twr[2*i+1]), w2i = VSET1(isign*twi[2*i+1]);
+    for (q=0; q<sl; q+=VN) {
+      const VT a0r = VLOAD(ar + q), a0i = VLOAD(ai + q);
+      const VT a1r = VLOAD(ar + m*sl + q), a1i = VLOAD(ai + m*sl + q);
+      const VT a2r = VLOAD(ar + 2*m*sl + q), a2i = VLOAD(ai + 2*m*sl + q);
+      const VT tr = VADD(a1r, a2r), ti = VADD(a1i, a2i);
+      const VT cr = VADD(a0r, VMUL(taur, tr)), ci = VADD(a0i, VMUL(taur, ti));
+      const VT dr = VMUL(taui, VSUB(a1r, a2r)), di = VMUL(taui, VSUB(a1i, a2i));
+      VSTORE(br + q, VADD(a0r, tr));
+      VSTORE(bi + q, VADD(a0i, ti));
+      VFN(store_tw)(br + sl + q, bi + sl + q, VSUB(cr, di), VADD(ci, dr),
+          w1r, w1i, i);
+      VFN(store_tw)(br + 2*sl + q, bi + 2*sl + q, VADD(cr, di), VSUB(ci, dr),
+          w2r, w2i, i);
+    }
+  }
+}
+
+static void VFN(batch4)(int m, int sl, const VR xr[], const VR xi[],
+    VR yr[], VR yi[], const VR twr[], const VR twi[], int isign)
+{
+  const VT sign = VSET1(isign);
+  int i, q;
+  for (i=0; i<m; i++) {
+    const VR* ar = xr + i*sl;
+    const VR* ai = xi + i*sl;
+    VR* br = yr + 4*i*sl;
+    VR* bi = yi + 4*i*sl;
+    const VT w1r = VSET1(twr[3*i]), w1i = VSET1(isign*twi[3*i]);
+    const VT w2r = VSET1(twr[3*i+1]), w2i = VSET1(isign*twi[3*i+1]);
+    const VT w3r = VSET1(twr[3*i+2]), w3i = VSET1(isign*twi[3*i+2]);
+    for (q=0; q<sl; q+=VN) {
+      const VT a0r = VLOAD(ar + q), a0i = VLOAD(ai + q);
+      const VT a1r = VLOAD(ar + m*sl + q), a1i = VLOAD(ai + m*sl + q);
+      const VT a2r = VLOAD(ar + 2*m*sl + q), a2i = VLOAD(ai + 2*m*sl + q);
+      const VT a3r = VLOAD(ar + 3*m*sl + q), a3i = VLOAD(ai + 3*m*sl + q);
+      const VT t0r = VADD(a0r, a2r), t0i = VADD(a0i, a2i);
+      const VT t1r = VSUB(a0r, a2r), t1i = VSUB(a0i, a2i);
+      const VT t2r = VADD(a1r, a3r), t2i = VADD(a1i, a3i);
+      /* isign*i*(a1-a3) = (-ur, ui) */
+      const VT ur = VMUL(sign, VSUB(a1i, a3i)), ui = VMUL(sign, VSUB(a1r, a3r));
+      VSTORE(br + q, VADD(t0r, t2r));
+      VSTORE(bi + q, VADD(t0i, t2i));
+      VFN(store_tw)(br + sl + q, bi + sl + q, VSUB(t1r, ur), VADD(t1i, ui),
+          w1r, w1i, i);
+      VFN(store_tw)(br + 2*sl + q, bi + 2*sl + q, VSUB(t0r, t2r),
+          VSUB(t0i, t2i), w2r, w2i, i);
+      VFN(store_tw)(br + 3*sl + q, bi + 3*sl + q, VADD(t1r, ur), VSUB(t1i, ui),
+          w3r, w3i, i);
+    }
+  }
+}
+
+static void VFN(batch5)(int m, int sl, const VR xr[], const VR xi[],
+    VR yr[], VR yi[], const VR twr[], const VR twi[], int isign)
+{
+  const VT tr11 = VSET1(0.309016994374947);
+  const VT ti11 = VSET1(isign*0.951056516295154);
+  const VT tr12 = VSET1(-0.809016994374947);
+  const VT ti12 = VSET1(isign*0.587785252292473);
+  int i, q;
+  for (i=0; i<m; i++) {
+    const VR* ar = xr + i*sl;
+    const VR* ai = xi + i*sl;
+    VR* br = yr + 5*i*sl;
+    VR* bi = yi + 5*i*sl;
+    const VT w1r = VSET1(twr[4*i]), w1i = VSET1(isign*twi[4*i]);
+    const VT w2r = VSET1(twr[4*i+1]), w2i = VSET1(isign*twi[4*i+1]);
+    const VT w3r = VSET1(twr[4*i+2]), w3i = VSET1(isign*twi[4*i+2]);
+    const VT w4r = VSET1(twr[4*i+3]), w4i = VSET1(isign*twi[4*i+3]);
+    for (q=0; q<sl; q+=VN) {
+      const VT a0r = VLOAD(ar + q), a0i = VLOAD(ai + q);
+      const VT a1r = VLOAD(ar + m*sl + q), a1i = VLOAD(ai + m*sl + q);
+      const VT a2r = VLOAD(ar + 2*m*sl + q), a2i = VLOAD(ai + 2*m*sl + q);
+      const VT a3r = VLOAD(ar + 3*m*sl + q), a3i = VLOAD(ai + 3*m*sl + q);
+      const VT a4r = VLOAD(ar + 4*m*sl + q), a4i = VLOAD(ai + 4*m*sl + q);
+      const VT t2r = VADD(a1r, a4r), t2i = VADD(a1i, a4i);
+      const VT t5r = VSUB(a1r, a4r), t5i = VSUB(a1i, a4i);
+      const VT t3r = VADD(a2r, a3r), t3i = VADD(a2i, a3i);
+      const VT t4r = VSUB(a2r, a3r), t4i = VSUB(a2i, a3i);
+      const VT c1r = VADD(a0r, VADD(VMUL(tr11, t2r), VMUL(tr12, t3r)));
+      const VT c1i = VADD(a0i, VADD(VMUL(tr11, t2i), VMUL(tr12, t3i)));
+      const VT c2r = VADD(a0r, VADD(VMUL(tr12, t2r), VMUL(tr11, t3r)));
+      const VT c2i = VADD(a0i, VADD(VMUL(tr12, t2i), VMUL(tr11, t3i)));
+      const VT s1r = VADD(VMUL(ti11, t5r), VMUL(ti12, t4r));
+      const VT s1i = VADD(VMUL(ti11, t5i), VMUL(ti12, t4i));
+      const VT s2r = VSUB(VMUL(ti12, t5r), VMUL(ti11, t4r));
+      const VT s2i = VSUB(VMUL(ti12, t5i), VMUL(ti11, t4i));
+      VSTORE(br + q, VADD(a0r, VADD(t2r, t3r)));
+      VSTORE(bi + q, VADD(a0i, VADD(t2i, t3i)));
+      VFN(store_tw)(br + sl + q, bi + sl + q, VSUB(c1r, s1i), VADD(c1i, s1r),
+          w1r, w1i, i);
+      VFN(store_tw)(br + 2*sl + q, bi + 2*sl + q, VSUB(c2r, s2i),
+          VADD(c2i, s2r), w2r, w2i, i);
+      VFN(store_tw)(br + 3*sl + q, bi + 3*sl + q, VADD(c2r, s2i),
+          VSUB(c2i, s2r), w3r, w3i, i);
+      VFN(store_tw)(br + 4*sl + q, bi + 4*sl + q, VADD(c1r, s1i),
+          VSUB(c1i, s1r), w4r, w4i, i);
+    }
+  }
+}
+
+/* Generic (odd) radix p, quadratic in p: rootr and rooti hold the cosines
+ * and sines of 2*pi*k/p */
+static void VFN(batchg)(int p, int m, int sl, const VR xr[], const VR xi[],
+    VR yr[], VR yi[], const VR twr[], const VR twi[], const VR rootr[],
+    const VR rooti[], int isign)
+{
+  int i, q, r, t;
+  for (i=0; i<m; i++) {
+    const VR* ar = xr + i*sl;
+    const VR* ai = xi + i*sl;
+    for (t=0; t<p; t++) {
+      VR* br = yr + (p*i+t)*sl;
+      VR* bi = yi + (p*i+t)*sl;
+      const VT wr = VSET1(t ? twr[(p-1)*i+t-1] : 1);
+      const VT wi = VSET1(t ? isign*twi[(p-1)*i+t-1] : 0);
+      for (q=0; q<sl; q+=VN) {
+        VT sr = VLOAD(ar + q), si = VLOAD(ai + q);
+        for (r=1; r<p; r++) {
+          const int k = (r*t) % p;
+          const VT cr = VSET1(rootr[k]), ci = VSET1(isign*rooti[k]);
+          const VT er = VLOAD(ar + r*m*sl + q), ei = VLOAD(ai + r*m*sl + q);
+          sr = VADD(sr, VSUB(VMUL(er, cr), VMUL(ei, ci)));
+          si = VADD(si, VADD(VMUL(er, ci), VMUL(ei, cr)));
+        }
+        VFN(store_tw)(br + q, bi + q, sr, si, wr, wi, i && t);
+      }
+    }
+  }
+}
+
+static void VFN(batch_stage)(int p, int m, int sl, const VR xr[],
+    const VR xi[], VR yr[], VR yi[], const VR twr[], const VR twi[],
+    const VR rootr[], const VR rooti[], int isign)
+{
+  switch (p) {
+    case 2: VFN(batch2)(m, sl, xr, xi, yr, yi, twr, twi, isign); break;
+    case 3: VFN(batch3)(m, sl, xr, xi, yr, yi, twr, twi, isign); break;
+    case 4: VFN(batch4)(m, sl, xr, xi, yr, yi, twr, twi, isign); break;
+    case 5: VFN(batch5)(m, sl, xr, xi, yr, yi, twr, twi, isign); break;
+    default:
+      VFN(batchg)(p, m, sl, xr, xi, yr, yi, twr, twi, rootr, rooti, isign);
+  }
+}
+
+#undef VR
+#undef VT
+#undef VN
+#undef VFN
+#undef VLOAD
+#undef VSTORE
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSET1
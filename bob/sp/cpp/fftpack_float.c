@@ -0,0 +1,31 @@
+/**
+ * @date Fri Oct 16 17:20:44 CEST 2026
+ *
+ * @brief Single precision build of fftpack: fftpack.c is compiled again
+ * with Treal being float, and all its external symbols suffixed by _float
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#define FFTPACK_FLOAT
+
+#define cfftf cfftf_float
+#define cfftb cfftb_float
+#define cffti cffti_float
+#define cfftf_plan cfftf_plan_float
+#define cfftb_plan cfftb_plan_float
+#define cffti_plan cffti_plan_float
+#define cffti_plan_factors cffti_plan_factors_float
+#define rfftf rfftf_float
+#define rfftb rfftb_float
+#define rffti rffti_float
+#define rfftb1 rfftb1_float
+#define rfftf_plan rfftf_plan_float
+#define rfftb_plan rfftb_plan_float
+#define rffti_plan rffti_plan_float
+#define fftpack_simd_passf2 fftpack_simd_passf2_float
+#define fftpack_simd_passf3 fftpack_simd_passf3_float
+#define fftpack_simd_passf4 fftpack_simd_passf4_float
+#define fftpack_simd_passf5 fftpack_simd_passf5_float
+
+#include "fftpack.c"
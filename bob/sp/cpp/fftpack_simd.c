@@ -0,0 +1,388 @@
+/**
+ * @date Fri Oct 16 16:05:12 CEST 2026
+ *
+ * @brief SSE2, AVX2 and AVX-512 versions of the fftpack complex radix 2, 3,
+ * 4 and 5 passes, selected at runtime according to the CPU features.
+ *
+ * Each instruction set gets its own copy of the passes (see
+ * fftpack_simd_passes.h), compiled with the matching target attribute, so
+ * that the library itself does not require any specific compiler flag and
+ * still runs on CPUs without these extensions.
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/fftpack.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+/* Double precision: one (SSE2), two (AVX2) and four (AVX-512) complex
+ * values per vector */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define VR double
+#define VT __m128d
+#define VW 1
+#define VFN(name) name##_sse2
+#define VLOAD(p) _mm_loadu_pd(p)
+#define VSTORE(p, a) _mm_storeu_pd(p, a)
+#define VADD(a, b) _mm_add_pd(a, b)
+#define VSUB(a, b) _mm_sub_pd(a, b)
+#define VMUL(a, b) _mm_mul_pd(a, b)
+#define VSET1(x) _mm_set1_pd(x)
+#define VPAIR(re, im) _mm_setr_pd(re, im)
+#define VSWAP(a) _mm_shuffle_pd(a, a, 1)
+#define VDUPRE(a) _mm_unpacklo_pd(a, a)
+#define VDUPIM(a) _mm_unpackhi_pd(a, a)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+/* With FMA, that the compiler uses to fuse the multiply-adds */
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define VR double
+#define VT __m256d
+#define VW 2
+#define VFN(name) name##_avx2
+#define VLOAD(p) _mm256_loadu_pd(p)
+#define VSTORE(p, a) _mm256_storeu_pd(p, a)
+#define VADD(a, b) _mm256_add_pd(a, b)
+#define VSUB(a, b) _mm256_sub_pd(a, b)
+#define VMUL(a, b) _mm256_mul_pd(a, b)
+#define VSET1(x) _mm256_set1_pd(x)
+#define VPAIR(re, im) _mm256_setr_pd(re, im, re, im)
+#define VSWAP(a) _mm256_permute_pd(a, 0x5)
+#define VDUPRE(a) _mm256_movedup_pd(a)
+#define VDUPIM(a) _mm256_permute_pd(a, 0xF)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define VR double
+#define VT __m512d
+#define VW 4
+#define VFN(name) name##_avx512
+#define VLOAD(p) _mm512_loadu_pd(p)
+#define VSTORE(p, a) _mm512_storeu_pd(p, a)
+#define VADD(a, b) _mm512_add_pd(a, b)
+#define VSUB(a, b) _mm512_sub_pd(a, b)
+#define VMUL(a, b) _mm512_mul_pd(a, b)
+#define VSET1(x) _mm512_set1_pd(x)
+#define VPAIR(re, im) _mm512_setr_pd(re, im, re, im, re, im, re, im)
+#define VSWAP(a) _mm512_permute_pd(a, 0x55)
+#define VDUPRE(a) _mm512_movedup_pd(a)
+#define VDUPIM(a) _mm512_permute_pd(a, 0xFF)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+/* Single precision: two, four and eight complex values per vector */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define VR float
+#define VT __m128
+#define VW 2
+#define VFN(name) name##_sse2_float
+#define VLOAD(p) _mm_loadu_ps(p)
+#define VSTORE(p, a) _mm_storeu_ps(p, a)
+#define VADD(a, b) _mm_add_ps(a, b)
+#define VSUB(a, b) _mm_sub_ps(a, b)
+#define VMUL(a, b) _mm_mul_ps(a, b)
+#define VSET1(x) _mm_set1_ps(x)
+#define VPAIR(re, im) _mm_setr_ps(re, im, re, im)
+#define VSWAP(a) _mm_shuffle_ps(a, a, 0xB1)
+#define VDUPRE(a) _mm_shuffle_ps(a, a, 0xA0)
+#define VDUPIM(a) _mm_shuffle_ps(a, a, 0xF5)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define VR float
+#define VT __m256
+#define VW 4
+#define VFN(name) name##_avx2_float
+#define VLOAD(p) _mm256_loadu_ps(p)
+#define VSTORE(p, a) _mm256_storeu_ps(p, a)
+#define VADD(a, b) _mm256_add_ps(a, b)
+#define VSUB(a, b) _mm256_sub_ps(a, b)
+#define VMUL(a, b) _mm256_mul_ps(a, b)
+#define VSET1(x) _mm256_set1_ps(x)
+#define VPAIR(re, im) _mm256_setr_ps(re, im, re, im, re, im, re, im)
+#define VSWAP(a) _mm256_permute_ps(a, 0xB1)
+#define VDUPRE(a) _mm256_moveldup_ps(a)
+#define VDUPIM(a) _mm256_movehdup_ps(a)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define VR float
+#define VT __m512
+#define VW 8
+#define VFN(name) name##_avx512_float
+#define VLOAD(p) _mm512_loadu_ps(p)
+#define VSTORE(p, a) _mm512_storeu_ps(p, a)
+#define VADD(a, b) _mm512_add_ps(a, b)
+#define VSUB(a, b) _mm512_sub_ps(a, b)
+#define VMUL(a, b) _mm512_mul_ps(a, b)
+#define VSET1(x) _mm512_set1_ps(x)
+#define VPAIR(re, im) _mm512_setr_ps(re, im, re, im, re, im, re, im, \
+    re, im, re, im, re, im, re, im)
+#define VSWAP(a) _mm512_permute_ps(a, 0xB1)
+#define VDUPRE(a) _mm512_moveldup_ps(a)
+#define VDUPIM(a) _mm512_movehdup_ps(a)
+#include "fftpack_simd_passes.h"
+#pragma GCC pop_options
+
+/* Best level supported by the CPU, and level currently in use (-1 until
+ * first detected). They are read and written atomically, as the passes of
+ * several threads read them, while fftpack_set_simd_level() may change the
+ * level: each pass then uses either the old or the new one, which give the
+ * same results. Concurrent first calls all compute the same value. */
+static int simd_cpu_level = -1;
+static int simd_level = -1;
+
+#define SIMD_LOAD(v) __atomic_load_n(&(v), __ATOMIC_RELAXED)
+#define SIMD_STORE(v, x) __atomic_store_n(&(v), (x), __ATOMIC_RELAXED)
+
+static int detect_simd_level(void)
+{
+  int level = SIMD_LOAD(simd_cpu_level);
+  if (level < 0) {
+    level = FFTPACK_SIMD_NONE;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) level = FFTPACK_SIMD_SSE2;
+    if (level == FFTPACK_SIMD_SSE2 && __builtin_cpu_supports("avx2") &&
+        __builtin_cpu_supports("fma")) level = FFTPACK_SIMD_AVX2;
+    if (level == FFTPACK_SIMD_AVX2 && __builtin_cpu_supports("avx512f"))
+      level = FFTPACK_SIMD_AVX512;
+    SIMD_STORE(simd_cpu_level, level);
+  }
+  return level;
+}
+
+int fftpack_simd_level(void)
+{
+  int level = SIMD_LOAD(simd_level);
+  if (level < 0) {
+    level = detect_simd_level();
+    SIMD_STORE(simd_level, level);
+  }
+  return level;
+}
+
+int fftpack_set_simd_level(int level)
+{
+  const int cpu = detect_simd_level();
+  if (level < FFTPACK_SIMD_NONE || level > cpu) level = cpu;
+  SIMD_STORE(simd_level, level);
+  return level;
+}
+
+/* Returns the widest level usable for a pass with the given ido, where ido
+ * is twice the number of complex values per block, and scale the number of
+ * complex values of a SSE2 vector (1 in double, 2 in single precision) */
+static int pass_level(int ido, int scale)
+{
+  const int level = fftpack_simd_level();
+  const int n = ido / 2;
+  if (level >= FFTPACK_SIMD_AVX512 && n % (4*scale) == 0)
+    return FFTPACK_SIMD_AVX512;
+  if (level >= FFTPACK_SIMD_AVX2 && n % (2*scale) == 0) return FFTPACK_SIMD_AVX2;
+  if (level >= FFTPACK_SIMD_SSE2 && n % scale == 0) return FFTPACK_SIMD_SSE2;
+  return FFTPACK_SIMD_NONE;
+}
+
+int fftpack_simd_passf2(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], int isign)
+{
+  switch (pass_level(ido, 1)) {
+    case FFTPACK_SIMD_AVX512:
+      passf2_avx512(ido, l1, cc, ch, wa1, isign); return 1;
+    case FFTPACK_SIMD_AVX2: passf2_avx2(ido, l1, cc, ch, wa1, isign); return 1;
+    case FFTPACK_SIMD_SSE2: passf2_sse2(ido, l1, cc, ch, wa1, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf3(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], int isign)
+{
+  switch (pass_level(ido, 1)) {
+    case FFTPACK_SIMD_AVX512:
+      passf3_avx512(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf3_avx2(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf3_sse2(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf4(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], const double wa3[], int isign)
+{
+  switch (pass_level(ido, 1)) {
+    case FFTPACK_SIMD_AVX512:
+      passf4_avx512(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf4_avx2(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf4_sse2(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf5(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], const double wa3[],
+    const double wa4[], int isign)
+{
+  switch (pass_level(ido, 1)) {
+    case FFTPACK_SIMD_AVX512:
+      passf5_avx512(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf5_avx2(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf5_sse2(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf2_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], int isign)
+{
+  switch (pass_level(ido, 2)) {
+    case FFTPACK_SIMD_AVX512:
+      passf2_avx512_float(ido, l1, cc, ch, wa1, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf2_avx2_float(ido, l1, cc, ch, wa1, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf2_sse2_float(ido, l1, cc, ch, wa1, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf3_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], int isign)
+{
+  switch (pass_level(ido, 2)) {
+    case FFTPACK_SIMD_AVX512:
+      passf3_avx512_float(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf3_avx2_float(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf3_sse2_float(ido, l1, cc, ch, wa1, wa2, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf4_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], const float wa3[], int isign)
+{
+  switch (pass_level(ido, 2)) {
+    case FFTPACK_SIMD_AVX512:
+      passf4_avx512_float(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf4_avx2_float(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf4_sse2_float(ido, l1, cc, ch, wa1, wa2, wa3, isign); return 1;
+    default: return 0;
+  }
+}
+
+int fftpack_simd_passf5_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], const float wa3[],
+    const float wa4[], int isign)
+{
+  switch (pass_level(ido, 2)) {
+    case FFTPACK_SIMD_AVX512:
+      passf5_avx512_float(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    case FFTPACK_SIMD_AVX2:
+      passf5_avx2_float(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    case FFTPACK_SIMD_SSE2:
+      passf5_sse2_float(ido, l1, cc, ch, wa1, wa2, wa3, wa4, isign); return 1;
+    default: return 0;
+  }
+}
+
+#else
+
+/* No vectorized passes on this platform: fftpack uses its scalar ones */
+
+int fftpack_simd_level(void)
+{
+  return FFTPACK_SIMD_NONE;
+}
+
+int fftpack_set_simd_level(int level)
+{
+  (void)level;
+  return FFTPACK_SIMD_NONE;
+}
+
+int fftpack_simd_passf2(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf3(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf4(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], const double wa3[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)wa3;
+  (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf5(int ido, int l1, const double cc[], double ch[],
+    const double wa1[], const double wa2[], const double wa3[],
+    const double wa4[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)wa3;
+  (void)wa4; (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf2_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf3_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf4_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], const float wa3[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)wa3;
+  (void)isign;
+  return 0;
+}
+
+int fftpack_simd_passf5_float(int ido, int l1, const float cc[], float ch[],
+    const float wa1[], const float wa2[], const float wa3[],
+    const float wa4[], int isign)
+{
+  (void)ido; (void)l1; (void)cc; (void)ch; (void)wa1; (void)wa2; (void)wa3;
+  (void)wa4; (void)isign;
+  return 0;
+}
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @date Fri Oct 16 16:05:12 CEST 2026
+ *
+ * @brief Vectorized fftpack complex radix 2, 3, 4 and 5 passes, written
+ * once in terms of the vector primitives defined by fftpack_simd.c, and
+ * included once per instruction set.
+ *
+ * The passes compute the same butterflies as passf2, passf3, passf4 and
+ * passf5 in fftpack.c, written with complex values: each vector of type VT
+ * holds VW consecutive complex values of type VR (interleaved real and
+ * imaginary parts) along the i index, so that they require ido/2 to be a
+ * multiple of VW. The vector primitives are undefined at the end of this
+ * file.
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+/* Multiplies the complex values of a by isign*i, rot being [-isign, isign] */
+#define VMULI(a) VMUL(VSWAP(a), rot)
+/* Multiplies the complex values of a by the twiddles in w (by their
+ * conjugate for the forward transform) */
+#define VTWIDDLE(a, w) VADD(VMUL(a, VDUPRE(w)), VMUL(VMUL(VSWAP(a), VDUPIM(w)), rot))
+
+static void VFN(passf2)(int ido, int l1, const VR cc[], VR ch[],
+    const VR wa1[], int isign)
+{
+  const VT rot = VPAIR(-isign, isign);
+  int i, k;
+  for (k=0; k<l1; k++) {
+    for (i=0; i<ido; i+=2*VW) {
+      const VR* in = cc + i + 2*k*ido;
+      VR* out = ch + i + k*ido;
+      const VT c0 = VLOAD(in);
+      const VT c1 = VLOAD(in + ido);
+      VSTORE(out, VADD(c0, c1));
+      if (ido == 2) VSTORE(out + l1*ido, VSUB(c0, c1));
+      else VSTORE(out + l1*ido, VTWIDDLE(VSUB(c0, c1), VLOAD(wa1 + i)));
+    }
+  }
+}
+
+static void VFN(passf3)(int ido, int l1, const VR cc[], VR ch[],
+    const VR wa1[], const VR wa2[], int isign)
+{
+  const VT rot = VPAIR(-isign, isign);
+  const VT taur = VSET1(-0.5);
+  const VT taui = VSET1(0.866025403784439);
+  int i, k;
+  for (k=0; k<l1; k++) {
+    for (i=0; i<ido; i+=2*VW) {
+      const VR* in = cc + i + 3*k*ido;
+      VR* out = ch + i + k*ido;
+      const VT c0 = VLOAD(in);
+      const VT c1 = VLOAD(in + ido);
+      const VT c2 = VLOAD(in + 2*ido);
+      const VT t2 = VADD(c1, c2);
+      const VT c = VADD(c0, VMUL(taur, t2));
+      const VT d = VMULI(VMUL(taui, VSUB(c1, c2)));
+      VSTORE(out, VADD(c0, t2));
+      if (ido == 2) {
+        VSTORE(out + l1*ido, VADD(c, d));
+        VSTORE(out + 2*l1*ido, VSUB(c, d));
+      }
+      else {
+        VSTORE(out + l1*ido, VTWIDDLE(VADD(c, d), VLOAD(wa1 + i)));
+        VSTORE(out + 2*l1*ido, VTWIDDLE(VSUB(c, d), VLOAD(wa2 + i)));
+      }
+    }
+  }
+}
+
+static void VFN(passf4)(int ido, int l1, const VR cc[], VR ch[],
+    const VR wa1[], const VR wa2[], const VR wa3[], int isign)
+{
+  const VT rot = VPAIR(-isign, isign);
+  int i, k;
+  for (k=0; k<l1; k++) {
+    for (i=0; i<ido; i+=2*VW) {
+      const VR* in = cc + i + 4*k*ido;
+      VR* out = ch + i + k*ido;
+      const VT c0 = VLOAD(in);
+      const VT c1 = VLOAD(in + ido);
+      const VT c2 = VLOAD(in + 2*ido);
+      const VT c3 = VLOAD(in + 3*ido);
+      const VT t1 = VSUB(c0, c2);
+      const VT t2 = VADD(c0, c2);
+      const VT t3 = VADD(c1, c3);
+      const VT t4 = VMULI(VSUB(c1, c3));
+      VSTORE(out, VADD(t2, t3));
+      if (ido == 2) {
+        VSTORE(out + l1*ido, VADD(t1, t4));
+        VSTORE(out + 2*l1*ido, VSUB(t2, t3));
+        VSTORE(out + 3*l1*ido, VSUB(t1, t4));
+      }
+      else {
+        VSTORE(out + l1*ido, VTWIDDLE(VADD(t1, t4), VLOAD(wa1 + i)));
+        VSTORE(out + 2*l1*ido, VTWIDDLE(VSUB(t2, t3), VLOAD(wa2 + i)));
+        VSTORE(out + 3*l1*ido, VTWIDDLE(VSUB(t1, t4), VLOAD(wa3 + i)));
+      }
+    }
+  }
+}
+
+static void VFN(passf5)(int ido, int l1, const VR cc[], VR ch[],
+    const VR wa1[], const VR wa2[], const VR wa3[],
+    const VR wa4[], int isign)
+{
+  const VT rot = VPAIR(-isign, isign);
+  const VT tr11 = VSET1(0.309016994374947);
+  const VT ti11 = VSET1(0.951056516295154);
+  const VT tr12 = VSET1(-0.809016994374947);
+  const VT ti12 = VSET1(0.587785252292473);
+  int i, k;
+  for (k=0; k<l1; k++) {
+    for (i=0; i<ido; i+=2*VW) {
+      const VR* in = cc + i + 5*k*ido;
+      VR* out = ch + i + k*ido;
+      const VT c0 = VLOAD(in);
+      const VT c1 = VLOAD(in + ido);
+      const VT c2 = VLOAD(in + 2*ido);
+      const VT c3 = VLOAD(in + 3*ido);
+      const VT c4 = VLOAD(in + 4*ido);
+      const VT t2 = VADD(c1, c4);
+      const VT t5 = VSUB(c1, c4);
+      const VT t3 = VADD(c2, c3);
+      const VT t4 = VSUB(c2, c3);
+      const VT a2 = VADD(c0, VADD(VMUL(tr11, t2), VMUL(tr12, t3)));
+      const VT a3 = VADD(c0, VADD(VMUL(tr12, t2), VMUL(tr11, t3)));
+      const VT b5 = VMULI(VADD(VMUL(ti11, t5), VMUL(ti12, t4)));
+      const VT b4 = VMULI(VSUB(VMUL(ti12, t5), VMUL(ti11, t4)));
+      VSTORE(out, VADD(c0, VADD(t2, t3)));
+      if (ido == 2) {
+        VSTORE(out + l1*ido, VADD(a2, b5));
+        VSTORE(out + 2*l1*ido, VADD(a3, b4));
+        VSTORE(out + 3*l1*ido, VSUB(a3, b4));
+        VSTORE(out + 4*l1*ido, VSUB(a2, b5));
+      }
+      else {
+        VSTORE(out + l1*ido, VTWIDDLE(VADD(a2, b5), VLOAD(wa1 + i)));
+        VSTORE(out + 2*l1*ido, VTWIDDLE(VADD(a3, b4), VLOAD(wa2 + i)));
+        VSTORE(out + 3*l1*ido, VTWIDDLE(VSUB(a3, b4), VLOAD(wa3 + i)));
+        VSTORE(out + 4*l1*ido, VTWIDDLE(VSUB(a2, b5), VLOAD(wa4 + i)));
+      }
+    }
+  }
+}
+
+#undef VMULI
+#undef VTWIDDLE
+#undef VR
+#undef VT
+#undef VW
+#undef VFN
+#undef VLOAD
+#undef VSTORE
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSET1
+#undef VPAIR
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
@@ -0,0 +1,95 @@
+/**
+ * @date Sat Oct 17 15:48:10 CEST 2026
+ *
+ * @brief Goertzel recurrences of several bins at once, in scalar, SSE2,
+ * AVX2 and AVX-512 versions, selected at runtime with the same instruction
+ * set as the vectorized fftpack passes (see fftpack_simd.c).
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.sp/fftpack.h>
+
+/* Scalar version, used on other platforms or if the SIMD level is set to
+ * FFTPACK_SIMD_NONE */
+#define VT double
+#define VN 1
+#define VFN(name) name##_scalar
+#define VLOAD(p) (*(p))
+#define VSTORE(p, a) (*(p) = (a))
+#define VADD(a, b) ((a) + (b))
+#define VSUB(a, b) ((a) - (b))
+#define VMUL(a, b) ((a) * (b))
+#define VSET1(x) ((double)(x))
+#include "goertzel_kernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+/* Two (SSE2), four (AVX2) and eight (AVX-512) bins per vector */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define VT __m128d
+#define VN 2
+#define VFN(name) name##_sse2
+#define VLOAD(p) _mm_loadu_pd(p)
+#define VSTORE(p, a) _mm_storeu_pd(p, a)
+#define VADD(a, b) _mm_add_pd(a, b)
+#define VSUB(a, b) _mm_sub_pd(a, b)
+#define VMUL(a, b) _mm_mul_pd(a, b)
+#define VSET1(x) _mm_set1_pd(x)
+#include "goertzel_kernel.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define VT __m256d
+#define VN 4
+#define VFN(name) name##_avx2
+#define VLOAD(p) _mm256_loadu_pd(p)
+#define VSTORE(p, a) _mm256_storeu_pd(p, a)
+#define VADD(a, b) _mm256_add_pd(a, b)
+#define VSUB(a, b) _mm256_sub_pd(a, b)
+#define VMUL(a, b) _mm256_mul_pd(a, b)
+#define VSET1(x) _mm256_set1_pd(x)
+#include "goertzel_kernel.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define VT __m512d
+#define VN 8
+#define VFN(name) name##_avx512
+#define VLOAD(p) _mm512_loadu_pd(p)
+#define VSTORE(p, a) _mm512_storeu_pd(p, a)
+#define VADD(a, b) _mm512_add_pd(a, b)
+#define VSUB(a, b) _mm512_sub_pd(a, b)
+#define VMUL(a, b) _mm512_mul_pd(a, b)
+#define VSET1(x) _mm512_set1_pd(x)
+#include "goertzel_kernel.h"
+#pragma GCC pop_options
+
+void goertzel_run(int length, const double x[], int segments, int bins,
+    const double c[], double s1[], double s2[])
+{
+  switch (fftpack_simd_level()) {
+    case FFTPACK_SIMD_AVX512:
+      goertzel_avx512(length, x, segments, bins, c, s1, s2); break;
+    case FFTPACK_SIMD_AVX2:
+      goertzel_avx2(length, x, segments, bins, c, s1, s2); break;
+    case FFTPACK_SIMD_SSE2:
+      goertzel_sse2(length, x, segments, bins, c, s1, s2); break;
+    default: goertzel_scalar(length, x, segments, bins, c, s1, s2);
+  }
+}
+
+#else
+
+void goertzel_run(int length, const double x[], int segments, int bins,
+    const double c[], double s1[], double s2[])
+{
+  goertzel_scalar(length, x, segments, bins, c, s1, s2);
+}
+
+#endif
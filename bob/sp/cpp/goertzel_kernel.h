@@ -0,0 +1,69 @@
+/**
+ * @date Sat Oct 17 15:48:10 CEST 2026
+ *
+ * @brief Goertzel recurrences of several bins at once, written once in
+ * terms of the vector primitives defined by goertzel.c, and included once
+ * per instruction set.
+ *
+ * Each lane of a vector of type VT holds the state of one bin: a chain
+ * runs the recurrences of VN bins on one segment of the signal. Up to four
+ * chains are run side by side, so that the latency of each recurrence is
+ * hidden by the other ones. The vector primitives are undefined at the end
+ * of this file.
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+/* Runs the recurrence of one chain (a vector of bins on a segment), with
+ * the index of the chain in the (segments, groups) grid */
+#define GOERTZEL_CHAIN(i) \
+  const double* x##i = x + (ch+i)/groups*length; \
+  const int o##i = (ch+i)/groups*ld + (ch+i)%groups*VN; \
+  const VT c##i = VLOAD(c + (ch+i)%groups*VN); \
+  VT p##i = VSET1(0.), q##i = VSET1(0.)
+#define GOERTZEL_STEP(i) \
+  { const VT r = VADD(VSUB(VSET1(x##i[n]), q##i), VMUL(c##i, p##i)); \
+    q##i = p##i; p##i = r; }
+#define GOERTZEL_STORE(i) \
+  VSTORE(s1 + o##i, p##i); VSTORE(s2 + o##i, q##i)
+
+static void VFN(goertzel)(int length, const double x[], int segments,
+    int bins, const double c[], double s1[], double s2[])
+{
+  const int groups = (bins+VN-1)/VN;
+  const int chains = groups*segments;
+  const int ld = (bins+7)/8*8;
+  int ch = 0, n;
+  for (; ch+4<=chains; ch+=4) {
+    GOERTZEL_CHAIN(0); GOERTZEL_CHAIN(1); GOERTZEL_CHAIN(2); GOERTZEL_CHAIN(3);
+    for (n=0; n<length; n++) {
+      GOERTZEL_STEP(0); GOERTZEL_STEP(1); GOERTZEL_STEP(2); GOERTZEL_STEP(3);
+    }
+    GOERTZEL_STORE(0); GOERTZEL_STORE(1); GOERTZEL_STORE(2); GOERTZEL_STORE(3);
+  }
+  for (; ch+2<=chains; ch+=2) {
+    GOERTZEL_CHAIN(0); GOERTZEL_CHAIN(1);
+    for (n=0; n<length; n++) {
+      GOERTZEL_STEP(0); GOERTZEL_STEP(1);
+    }
+    GOERTZEL_STORE(0); GOERTZEL_STORE(1);
+  }
+  for (; ch<chains; ch++) {
+    GOERTZEL_CHAIN(0);
+    for (n=0; n<length; n++) GOERTZEL_STEP(0);
+    GOERTZEL_STORE(0);
+  }
+}
+
+#undef GOERTZEL_CHAIN
+#undef GOERTZEL_STEP
+#undef GOERTZEL_STORE
+#undef VT
+#undef VN
+#undef VFN
+#undef VLOAD
+#undef VSTORE
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSET1
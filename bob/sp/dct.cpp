@@ -9,22 +9,26 @@
 #include <bob.blitz/cleanup.h>
 #include <bob.sp/DCT1D.h>
 #include <bob.sp/DCT2D.h>
+#include <bob.sp/DCTND.h>
 
 static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
     boost::shared_ptr<PyBlitzArrayObject>& output) {
 
-  if (input->type_num != NPY_FLOAT64) {
-    PyErr_SetString(PyExc_TypeError, "method only supports 64-bit float arrays for input array `input'");
+  if (input->type_num != NPY_FLOAT64 && input->type_num != NPY_FLOAT32) {
+    PyErr_SetString(PyExc_TypeError, "method only supports 64-bit float or 32-bit float arrays for input array `input'");
     return 0;
   }
 
-  if (output && output->type_num != NPY_FLOAT64) {
-    PyErr_SetString(PyExc_TypeError, "method only supports 64-bit float arrays for output array `output'");
+  if (output && output->type_num != input->type_num) {
+    if (input->type_num == NPY_FLOAT32)
+      PyErr_SetString(PyExc_TypeError, "method only supports 32-bit float arrays for output array `output', as input array `input' is of this type");
+    else
+      PyErr_SetString(PyExc_TypeError, "method only supports 64-bit float arrays for output array `output'");
     return 0;
   }
 
-  if (input->ndim != 1 and input->ndim != 2) {
-    PyErr_Format(PyExc_TypeError, "method only accepts 1 or 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", input->ndim);
+  if (input->ndim < 1 || input->ndim > BOB_BLITZ_MAXDIMS) {
+    PyErr_Format(PyExc_TypeError, "method only accepts 1 to %d-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", BOB_BLITZ_MAXDIMS, input->ndim);
     return 0;
   }
 
@@ -41,7 +45,7 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
         return 0;
       }
     }
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       if (output->shape[0] != input->shape[0]) {
         PyErr_Format(PyExc_RuntimeError, "2D `output' array should have %" PY_FORMAT_SIZE_T "d rows matching input size, not %" PY_FORMAT_SIZE_T "d rows", input->shape[0], output->shape[0]);
         return 0;
@@ -51,11 +55,18 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
         return 0;
       }
     }
+    else {
+      for (Py_ssize_t i=0; i<input->ndim; ++i)
+        if (output->shape[i] != input->shape[i]) {
+          PyErr_Format(PyExc_RuntimeError, "%" PY_FORMAT_SIZE_T "dD `output' array should have %" PY_FORMAT_SIZE_T "d elements along dimension %" PY_FORMAT_SIZE_T "d matching input size, not %" PY_FORMAT_SIZE_T "d elements", input->ndim, input->shape[i], i, output->shape[i]);
+          return 0;
+        }
+    }
   }
 
   else {
 
-    auto tmp = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_FLOAT64, input->ndim, input->shape);
+    auto tmp = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(input->type_num, input->ndim, input->shape);
     if (!tmp) return 0;
     output = make_safe(tmp);
 
@@ -65,6 +76,22 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
 
 }
 
+/**
+ * Applies a N-dimensional transform to arrays of 3 or more dimensions
+ */
+template <typename T, typename Op>
+static void call_nd(const Op& op, PyBlitzArrayObject* input,
+    PyBlitzArrayObject* output) {
+  switch (input->ndim) {
+    case 3:
+      op(*PyBlitzArrayCxx_AsBlitz<T,3>(input), *PyBlitzArrayCxx_AsBlitz<T,3>(output));
+      break;
+    case 4:
+      op(*PyBlitzArrayCxx_AsBlitz<T,4>(input), *PyBlitzArrayCxx_AsBlitz<T,4>(output));
+      break;
+  }
+}
+
 PyObject* dct(PyObject*, PyObject* args, PyObject* kwds) {
 
   static const char* const_kwlist[] = {"input", "output", 0};
@@ -82,7 +109,8 @@ PyObject* dct(PyObject*, PyObject* args, PyObject* kwds) {
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  check_and_allocate(input_, output_);
+  if (!check_and_allocate(input_, output_))
+    return 0;
 
   output = output_.get();
 
@@ -91,14 +119,30 @@ PyObject* dct(PyObject*, PyObject* args, PyObject* kwds) {
 
     if (input->ndim == 1) {
       bob::sp::DCT1D op(input->shape[0]);
-      op(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<double,1>(output));
+      if (input->type_num == NPY_FLOAT32)
+        op(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,1>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,1>(output));
     }
 
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       bob::sp::DCT2D op(input->shape[0], input->shape[1]);
-      op(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+      if (input->type_num == NPY_FLOAT32)
+        op(*PyBlitzArrayCxx_AsBlitz<float,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,2>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+    }
+
+    else { // input->ndim > 2
+      bob::sp::DCTND op(std::vector<size_t>(input->shape, input->shape + input->ndim));
+      if (input->type_num == NPY_FLOAT32)
+        call_nd<float>(op, input, output);
+      else
+        call_nd<double>(op, input, output);
     }
 
   }
@@ -132,7 +176,8 @@ PyObject* idct(PyObject*, PyObject* args, PyObject* kwds) {
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  check_and_allocate(input_, output_);
+  if (!check_and_allocate(input_, output_))
+    return 0;
 
   output = output_.get();
 
@@ -141,14 +186,30 @@ PyObject* idct(PyObject*, PyObject* args, PyObject* kwds) {
 
     if (input->ndim == 1) {
       bob::sp::IDCT1D op(input->shape[0]);
-      op(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<double,1>(output));
+      if (input->type_num == NPY_FLOAT32)
+        op(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,1>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,1>(output));
     }
 
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       bob::sp::IDCT2D op(input->shape[0], input->shape[1]);
-      op(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+      if (input->type_num == NPY_FLOAT32)
+        op(*PyBlitzArrayCxx_AsBlitz<float,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,2>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+    }
+
+    else { // input->ndim > 2
+      bob::sp::IDCTND op(std::vector<size_t>(input->shape, input->shape + input->ndim));
+      if (input->type_num == NPY_FLOAT32)
+        call_nd<float>(op, input, output);
+      else
+        call_nd<double>(op, input, output);
     }
 
   }
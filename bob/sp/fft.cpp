@@ -9,22 +9,43 @@
 #include <bob.blitz/cleanup.h>
 #include <bob.sp/FFT1D.h>
 #include <bob.sp/FFT2D.h>
+#include <bob.sp/FFTND.h>
 #include <bob.sp/fftshift.h>
+#include <bob.sp/Workspace.h>
 
+/**
+ * Checks the input and output arrays, allocating the output if required.
+ * If ``allow_single`` is set, 64-bit complex (2x32-bit float) inputs are also
+ * accepted, in which case the output must be of the same type. If
+ * ``allow_nd`` is set, arrays of more than 2 dimensions are also accepted.
+ */
 static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
-    boost::shared_ptr<PyBlitzArrayObject>& output) {
+    boost::shared_ptr<PyBlitzArrayObject>& output, bool allow_single=false,
+    bool allow_nd=false) {
+
+  if (input->type_num != NPY_COMPLEX128 &&
+      !(allow_single && input->type_num == NPY_COMPLEX64)) {
+    if (allow_single)
+      PyErr_SetString(PyExc_TypeError, "method only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'");
+    else
+      PyErr_SetString(PyExc_TypeError, "method only supports 128-bit complex (2x64-bit float) arrays for input array `input'");
+    return 0;
+  }
 
-  if (input->type_num != NPY_COMPLEX128) {
-    PyErr_SetString(PyExc_TypeError, "method only supports 128-bit complex (2x64-bit float) arrays for input array `input'");
+  if (output && output->type_num != input->type_num) {
+    if (input->type_num == NPY_COMPLEX64)
+      PyErr_SetString(PyExc_TypeError, "method only supports 64-bit complex (2x32-bit float) arrays for output array `output', as input array `input' is of this type");
+    else
+      PyErr_SetString(PyExc_TypeError, "method only supports 128-bit complex (2x64-bit float) arrays for output array `output'");
     return 0;
   }
 
-  if (output && output->type_num != NPY_COMPLEX128) {
-    PyErr_SetString(PyExc_TypeError, "method only supports 128-bit complex (2x64-bit float) arrays for output array `output'");
+  if (allow_nd && (input->ndim < 1 || input->ndim > BOB_BLITZ_MAXDIMS)) {
+    PyErr_Format(PyExc_TypeError, "method only accepts 1 to %d-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", BOB_BLITZ_MAXDIMS, input->ndim);
     return 0;
   }
 
-  if (input->ndim != 1 and input->ndim != 2) {
+  if (!allow_nd && input->ndim != 1 and input->ndim != 2) {
     PyErr_Format(PyExc_TypeError, "method only accepts 1 or 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", input->ndim);
     return 0;
   }
@@ -42,7 +63,7 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
         return 0;
       }
     }
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       if (output->shape[0] != input->shape[0]) {
         PyErr_Format(PyExc_RuntimeError, "2D `output' array should have %" PY_FORMAT_SIZE_T "d rows matching input size, not %" PY_FORMAT_SIZE_T "d rows", input->shape[0], output->shape[0]);
         return 0;
@@ -52,11 +73,18 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
         return 0;
       }
     }
+    else {
+      for (Py_ssize_t i=0; i<input->ndim; ++i)
+        if (output->shape[i] != input->shape[i]) {
+          PyErr_Format(PyExc_RuntimeError, "%" PY_FORMAT_SIZE_T "dD `output' array should have %" PY_FORMAT_SIZE_T "d elements along dimension %" PY_FORMAT_SIZE_T "d matching input size, not %" PY_FORMAT_SIZE_T "d elements", input->ndim, input->shape[i], i, output->shape[i]);
+          return 0;
+        }
+    }
   }
 
   else {
 
-    auto tmp = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_COMPLEX128, input->ndim, input->shape);
+    auto tmp = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(input->type_num, input->ndim, input->shape);
     if (!tmp) return 0;
     output = make_safe(tmp);
 
@@ -66,6 +94,22 @@ static int check_and_allocate(boost::shared_ptr<PyBlitzArrayObject>& input,
 
 }
 
+/**
+ * Applies a N-dimensional transform to arrays of 3 or more dimensions
+ */
+template <typename T, typename Op>
+static void call_nd(const Op& op, PyBlitzArrayObject* input,
+    PyBlitzArrayObject* output) {
+  switch (input->ndim) {
+    case 3:
+      op(*PyBlitzArrayCxx_AsBlitz<T,3>(input), *PyBlitzArrayCxx_AsBlitz<T,3>(output));
+      break;
+    case 4:
+      op(*PyBlitzArrayCxx_AsBlitz<T,4>(input), *PyBlitzArrayCxx_AsBlitz<T,4>(output));
+      break;
+  }
+}
+
 PyObject* fft(PyObject*, PyObject* args, PyObject* kwds) {
 
   static const char* const_kwlist[] = {"input", "output", 0};
@@ -83,7 +127,7 @@ PyObject* fft(PyObject*, PyObject* args, PyObject* kwds) {
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (!check_and_allocate(input_, output_))
+  if (!check_and_allocate(input_, output_, true, true))
     return 0;
 
   output = output_.get();
@@ -93,14 +137,30 @@ PyObject* fft(PyObject*, PyObject* args, PyObject* kwds) {
 
     if (input->ndim == 1) {
       bob::sp::FFT1D op(input->shape[0]);
-      op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+      if (input->type_num == NPY_COMPLEX64)
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
     }
 
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       bob::sp::FFT2D op(input->shape[0], input->shape[1]);
-      op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+      if (input->type_num == NPY_COMPLEX64)
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+    }
+
+    else { // input->ndim > 2
+      bob::sp::FFTND op(std::vector<size_t>(input->shape, input->shape + input->ndim));
+      if (input->type_num == NPY_COMPLEX64)
+        call_nd<std::complex<float> >(op, input, output);
+      else
+        call_nd<std::complex<double> >(op, input, output);
     }
 
   }
@@ -134,7 +194,7 @@ PyObject* ifft(PyObject*, PyObject* args, PyObject* kwds) {
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (!check_and_allocate(input_, output_))
+  if (!check_and_allocate(input_, output_, true, true))
     return 0;
 
   output = output_.get();
@@ -144,14 +204,30 @@ PyObject* ifft(PyObject*, PyObject* args, PyObject* kwds) {
 
     if (input->ndim == 1) {
       bob::sp::IFFT1D op(input->shape[0]);
-      op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+      if (input->type_num == NPY_COMPLEX64)
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
     }
 
-    else { // input->ndim == 2
+    else if (input->ndim == 2) {
       bob::sp::IFFT2D op(input->shape[0], input->shape[1]);
-      op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+      if (input->type_num == NPY_COMPLEX64)
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output));
+      else
+        op(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+    }
+
+    else { // input->ndim > 2
+      bob::sp::IFFTND op(std::vector<size_t>(input->shape, input->shape + input->ndim));
+      if (input->type_num == NPY_COMPLEX64)
+        call_nd<std::complex<float> >(op, input, output);
+      else
+        call_nd<std::complex<double> >(op, input, output);
     }
 
   }
@@ -168,7 +244,64 @@ PyObject* ifft(PyObject*, PyObject* args, PyObject* kwds) {
 
 }
 
-PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds) {
+/**
+ * Copies the input into the output, unless they are the same view of the
+ * same data, through a temporary if they overlap otherwise
+ */
+template <typename T, int N>
+static void copy_for_shift(const blitz::Array<T,N>& src,
+    blitz::Array<T,N>& dst) {
+  if (bob::sp::detail::isSameView(src, dst)) return;
+  if (bob::sp::detail::overlap(src, dst)) dst = blitz::Array<T,N>(src.copy());
+  else dst = src;
+}
+
+/**
+ * Shifts the input into the output, which may be the input itself, in which
+ * case the shift is done in place. The arrays of 3 or more dimensions are
+ * copied first, then shifted in place.
+ */
+template <typename T>
+static void call_shift(PyBlitzArrayObject* input, PyBlitzArrayObject* output,
+    const bool inverse) {
+  switch (input->ndim) {
+    case 1:
+      {
+        blitz::Array<T,1>& dst = *PyBlitzArrayCxx_AsBlitz<T,1>(output);
+        if (inverse) bob::sp::ifftshift(*PyBlitzArrayCxx_AsBlitz<T,1>(input), dst);
+        else bob::sp::fftshift(*PyBlitzArrayCxx_AsBlitz<T,1>(input), dst);
+      }
+      break;
+    case 2:
+      {
+        blitz::Array<T,2>& dst = *PyBlitzArrayCxx_AsBlitz<T,2>(output);
+        if (inverse) bob::sp::ifftshift(*PyBlitzArrayCxx_AsBlitz<T,2>(input), dst);
+        else bob::sp::fftshift(*PyBlitzArrayCxx_AsBlitz<T,2>(input), dst);
+      }
+      break;
+    case 3:
+      {
+        blitz::Array<T,3>& dst = *PyBlitzArrayCxx_AsBlitz<T,3>(output);
+        copy_for_shift(*PyBlitzArrayCxx_AsBlitz<T,3>(input), dst);
+        if (inverse) bob::sp::ifftshift(dst);
+        else bob::sp::fftshift(dst);
+      }
+      break;
+    case 4:
+      {
+        blitz::Array<T,4>& dst = *PyBlitzArrayCxx_AsBlitz<T,4>(output);
+        copy_for_shift(*PyBlitzArrayCxx_AsBlitz<T,4>(input), dst);
+        if (inverse) bob::sp::ifftshift(dst);
+        else bob::sp::fftshift(dst);
+      }
+      break;
+  }
+}
+
+/**
+ * Implements fftshift and ifftshift
+ */
+static PyObject* shift(PyObject* args, PyObject* kwds, const bool inverse) {
 
   static const char* const_kwlist[] = {"input", "output", 0};
   static char** kwlist = const_cast<char**>(const_kwlist);
@@ -185,7 +318,7 @@ PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds) {
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (!check_and_allocate(input_, output_))
+  if (!check_and_allocate(input_, output_, true, true))
     return 0;
 
   output = output_.get();
@@ -193,19 +326,10 @@ PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds) {
   /** all basic checks are done, can call the operator now **/
   try {
 
-    if (input->ndim == 1) {
-      bob::sp::fftshift(
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output)
-          );
-    }
-
-    else { // input->ndim == 2
-      bob::sp::fftshift(
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output)
-          );
-    }
+    if (input->type_num == NPY_COMPLEX64)
+      call_shift<std::complex<float> >(input, output, inverse);
+    else
+      call_shift<std::complex<double> >(input, output, inverse);
 
   }
   catch (std::exception& e) {
@@ -221,55 +345,141 @@ PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds) {
 
 }
 
+PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds) {
+  return shift(args, kwds, false);
+}
+
 PyObject* ifftshift(PyObject*, PyObject* args, PyObject* kwds) {
+  return shift(args, kwds, true);
+}
 
-  static const char* const_kwlist[] = {"input", "output", 0};
+/**
+ * Names of the engines of the transforms, as used by their ``engine``
+ * attribute
+ */
+static const char* s_engine_names[] = {"fftpack", "stockham", "fftw", "tuned"};
+
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine) {
+  return Py_BuildValue("s", s_engine_names[engine]);
+}
+
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine) {
+
+  const char* name = 0;
+  if (!PyArg_Parse(o, "s", &name)) return -1;
+
+  for (int i=0; i<4; ++i) {
+    if (std::string(name) == s_engine_names[i]) {
+      *engine = (bob::sp::FFTPlanBase::Engine)i;
+      return 0;
+    }
+  }
+
+  PyErr_Format(PyExc_ValueError, "engine can only be 'fftpack', 'stockham', 'fftw' or 'tuned', not '%s'", name);
+  return -1;
+
+}
+
+PyObject* available_engines(PyObject*) {
+
+  PyObject* retval = PyList_New(0);
+  if (!retval) return 0;
+
+  for (int i=0; i<4; ++i) {
+    if (!bob::sp::FFTPlanBase::isAvailable((bob::sp::FFTPlanBase::Engine)i))
+      continue;
+    PyObject* name = PyBobSpEngine_AsString((bob::sp::FFTPlanBase::Engine)i);
+    if (!name || PyList_Append(retval, name) < 0) {
+      Py_XDECREF(name);
+      Py_DECREF(retval);
+      return 0;
+    }
+    Py_DECREF(name);
+  }
+
+  return retval;
+
+}
+
+PyObject* next_fast_length(PyObject*, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"n", "engine", 0};
   static char** kwlist = const_cast<char**>(const_kwlist);
 
-  PyBlitzArrayObject* input = 0;
-  PyBlitzArrayObject* output = 0;
+  Py_ssize_t n = 0;
+  PyObject* engine_name = 0;
 
-  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
-        &PyBlitzArray_Converter, &input,
-        &PyBlitzArray_OutputConverter, &output
-        )) return 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|O", kwlist, &n,
+        &engine_name)) return 0;
 
-  //protects acquired resources through this scope
-  auto input_ = make_safe(input);
-  auto output_ = make_xsafe(output);
+  if (n < 1) {
+    PyErr_Format(PyExc_ValueError, "length should be at least 1, not %" PY_FORMAT_SIZE_T "d", n);
+    return 0;
+  }
 
-  if (!check_and_allocate(input_, output_))
+  bob::sp::FFTPlanBase::Engine engine = bob::sp::FFTPlanBase::Fftpack;
+  if (engine_name && PyBobSpEngine_FromString(engine_name, &engine) < 0)
     return 0;
 
-  output = output_.get();
+  return Py_BuildValue("n", bob::sp::FFTPlanBase::nextFastLength(n, engine));
 
-  /** all basic checks are done, can call the operator now **/
-  try {
+}
 
-    if (input->ndim == 1) {
-      bob::sp::ifftshift(
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output)
-          );
-    }
+PyObject* scratch_bytes(PyObject*) {
 
-    else { // input->ndim == 2
-      bob::sp::ifftshift(
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
-          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output)
-          );
-    }
+  return Py_BuildValue("n", bob::sp::detail::scratchBytes());
+
+}
+
+PyObject* scratch_peak(PyObject*) {
+
+  return Py_BuildValue("n", bob::sp::detail::scratchPeak());
+
+}
+
+/**
+ * Imports or exports the FFTW wisdom or the FFT tuning, using the given
+ * method
+ */
+static PyObject* plan_file(PyObject* args, PyObject* kwds,
+    void (*method)(const std::string&), const char* what) {
+
+  static const char* const_kwlist[] = {"filename", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  const char* filename = 0;
 
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "s", kwlist, &filename))
+    return 0;
+
+  try {
+    method(filename);
   }
   catch (std::exception& e) {
     PyErr_SetString(PyExc_RuntimeError, e.what());
     return 0;
   }
   catch (...) {
-    PyErr_SetString(PyExc_RuntimeError, "cannot operate on data: unknown exception caught");
+    PyErr_Format(PyExc_RuntimeError, "cannot handle the %s: unknown exception caught", what);
     return 0;
   }
 
-  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+  Py_RETURN_NONE;
+
+}
+
+PyObject* import_fftw_wisdom(PyObject*, PyObject* args, PyObject* kwds) {
+  return plan_file(args, kwds, &bob::sp::FFTPlanBase::importWisdom, "FFTW wisdom");
+}
+
+PyObject* export_fftw_wisdom(PyObject*, PyObject* args, PyObject* kwds) {
+  return plan_file(args, kwds, &bob::sp::FFTPlanBase::exportWisdom, "FFTW wisdom");
+}
+
+PyObject* import_fft_tuning(PyObject*, PyObject* args, PyObject* kwds) {
+  return plan_file(args, kwds, &bob::sp::FFTPlanBase::importTuning, "FFT tuning");
+}
 
+PyObject* export_fft_tuning(PyObject*, PyObject* args, PyObject* kwds) {
+  return plan_file(args, kwds, &bob::sp::FFTPlanBase::exportTuning, "FFT tuning");
 }
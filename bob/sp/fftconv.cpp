@@ -0,0 +1,146 @@
+/**
+ * @date Sat Oct 17 23:12:44 CEST 2026
+ *
+ * @brief Python bindings to the convolutions and correlations computed
+ * with FFTs
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/fftconv.h>
+
+#include <string>
+
+/**
+ * Converts the name of a size option ('full', 'same' or 'valid')
+ */
+static int size_option_from_string(PyObject* o,
+    bob::sp::Conv::SizeOption* size_opt) {
+
+  const char* name = 0;
+  if (!PyArg_Parse(o, "s", &name)) return -1;
+
+  if (std::string(name) == "full") *size_opt = bob::sp::Conv::Full;
+  else if (std::string(name) == "same") *size_opt = bob::sp::Conv::Same;
+  else if (std::string(name) == "valid") *size_opt = bob::sp::Conv::Valid;
+  else {
+    PyErr_Format(PyExc_ValueError, "size can only be 'full', 'same' or 'valid', not '%s'", name);
+    return -1;
+  }
+  return 0;
+
+}
+
+template <typename T>
+static void call(PyBlitzArrayObject* a, PyBlitzArrayObject* b,
+    PyBlitzArrayObject* c, const bob::sp::Conv::SizeOption size_opt,
+    const bool correlate) {
+  if (a->ndim == 1) {
+    blitz::Array<T,1> c_ = *PyBlitzArrayCxx_AsBlitz<T,1>(c);
+    if (correlate) bob::sp::fftcorr(*PyBlitzArrayCxx_AsBlitz<T,1>(a),
+        *PyBlitzArrayCxx_AsBlitz<T,1>(b), c_, size_opt);
+    else bob::sp::fftconv(*PyBlitzArrayCxx_AsBlitz<T,1>(a),
+        *PyBlitzArrayCxx_AsBlitz<T,1>(b), c_, size_opt);
+  }
+  else {
+    blitz::Array<T,2> c_ = *PyBlitzArrayCxx_AsBlitz<T,2>(c);
+    if (correlate) bob::sp::fftcorr(*PyBlitzArrayCxx_AsBlitz<T,2>(a),
+        *PyBlitzArrayCxx_AsBlitz<T,2>(b), c_, size_opt);
+    else bob::sp::fftconv(*PyBlitzArrayCxx_AsBlitz<T,2>(a),
+        *PyBlitzArrayCxx_AsBlitz<T,2>(b), c_, size_opt);
+  }
+}
+
+/**
+ * Implementation of fftconv() and fftcorr()
+ */
+static PyObject* fftconv_impl(PyObject* args, PyObject* kwds,
+    const bool correlate) {
+
+  static const char* const_kwlist[] = {"a", "b", "c", "size", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* a = 0;
+  PyBlitzArrayObject* b = 0;
+  PyBlitzArrayObject* c = 0;
+  PyObject* size_name = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&O&|O&O", kwlist,
+        &PyBlitzArray_Converter, &a,
+        &PyBlitzArray_Converter, &b,
+        &PyBlitzArray_OutputConverter, &c,
+        &size_name
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto a_ = make_safe(a);
+  auto b_ = make_safe(b);
+  auto c_ = make_xsafe(c);
+
+  bob::sp::Conv::SizeOption size_opt = bob::sp::Conv::Full;
+  if (size_name && size_option_from_string(size_name, &size_opt) < 0)
+    return 0;
+
+  if (a->type_num != NPY_FLOAT64 && a->type_num != NPY_FLOAT32) {
+    PyErr_SetString(PyExc_TypeError, "method only supports 64-bit or 32-bit float arrays for input array `a'");
+    return 0;
+  }
+
+  if (b->type_num != a->type_num || (c && c->type_num != a->type_num)) {
+    PyErr_SetString(PyExc_TypeError, "arrays `b' and `c' should be of the same type as array `a'");
+    return 0;
+  }
+
+  if ((a->ndim != 1 && a->ndim != 2) || b->ndim != a->ndim ||
+      (c && c->ndim != a->ndim)) {
+    PyErr_Format(PyExc_TypeError, "method only accepts 1 or 2-dimensional arrays, all of the same number of dimensions (not %" PY_FORMAT_SIZE_T "dD and %" PY_FORMAT_SIZE_T "dD arrays)", a->ndim, b->ndim);
+    return 0;
+  }
+
+  try {
+
+    Py_ssize_t shape[2];
+    for (Py_ssize_t i=0; i<a->ndim; ++i)
+      shape[i] = bob::sp::getConvOutputSize(a->shape[i], b->shape[i],
+          size_opt);
+
+    if (c) {
+      for (Py_ssize_t i=0; i<a->ndim; ++i)
+        if (c->shape[i] != shape[i]) {
+          PyErr_Format(PyExc_RuntimeError, "`c' array should have %" PY_FORMAT_SIZE_T "d elements along dimension %" PY_FORMAT_SIZE_T "d, not %" PY_FORMAT_SIZE_T "d", shape[i], i, c->shape[i]);
+          return 0;
+        }
+    }
+    else {
+      c = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(a->type_num, a->ndim, shape);
+      if (!c) return 0;
+      c_ = make_safe(c);
+    }
+
+    if (a->type_num == NPY_FLOAT32) call<float>(a, b, c, size_opt, correlate);
+    else call<double>(a, b, c, size_opt, correlate);
+
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_SetString(PyExc_RuntimeError, "cannot operate on data: unknown exception caught");
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", c));
+
+}
+
+PyObject* fftconv(PyObject*, PyObject* args, PyObject* kwds) {
+  return fftconv_impl(args, kwds, false);
+}
+
+PyObject* fftcorr(PyObject*, PyObject* args, PyObject* kwds) {
+  return fftconv_impl(args, kwds, true);
+}
@@ -0,0 +1,512 @@
+/**
+ * @date Fri Oct 16 22:20:37 CEST 2026
+ *
+ * @brief Python bindings to the N-dimensional FFT
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/FFTND.h>
+
+#include <sstream>
+
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
+PyDoc_STRVAR(s_fftnd_str, BOB_EXT_MODULE_PREFIX ".FFTND");
+
+PyDoc_STRVAR(s_fftnd_doc,
+"FFTND(shape) -> new FFTND operator\n\
+\n\
+Calculates the direct FFT of a N-dimensional array/signal, where N\n\
+is the length of ``shape``. Input and output arrays are NumPy arrays\n\
+of type ``complex128`` and of the given shape. The output array may\n\
+be the input array itself, in which case the transform is computed\n\
+in-place, without any temporary of its size.\n\
+\n\
+Single precision arrays (of type ``complex64``) are also accepted,\n\
+in which case the transform is computed in single precision.\n\
+\n\
+The last dimension is transformed first, then each other one, from\n\
+the last to the first, by :py:attr:`threads` threads. Arrays of up\n\
+to 4 dimensions are supported.\n\
+"
+);
+
+/**
+ * Represents an FFTND
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::FFTND* cxx;
+} PyBobSpFFTNDObject;
+
+extern PyTypeObject PyBobSpFFTND_Type; //forward declaration
+
+int PyBobSpFFTND_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpFFTND_Type));
+}
+
+/**
+ * Converts a sequence of positive integers into a shape, returns false and
+ * sets a Python exception otherwise
+ */
+static bool PyBobSpFFTND_AsShape(PyObject* self, PyObject* o,
+    std::vector<size_t>& shape) {
+
+  if (!PySequence_Check(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' shape can only be set using tuples (or sequences), not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return false;
+  }
+
+  PyObject* tuple = PySequence_Tuple(o);
+  if (!tuple) return false;
+  auto tuple_ = make_safe(tuple);
+
+  shape.clear();
+  for (Py_ssize_t i=0; i<PyTuple_GET_SIZE(tuple); ++i) {
+    Py_ssize_t v = PyNumber_AsSsize_t(PyTuple_GET_ITEM(tuple, i), PyExc_OverflowError);
+    if (PyErr_Occurred()) return false;
+    if (v < 0) {
+      PyErr_Format(PyExc_ValueError, "`%s' shape cannot hold negative sizes", Py_TYPE(self)->tp_name);
+      return false;
+    }
+    shape.push_back(v);
+  }
+
+  return true;
+
+}
+
+static void PyBobSpFFTND_Delete (PyBobSpFFTNDObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpFFTND_InitCopy
+(PyBobSpFFTNDObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpFFTND_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpFFTNDObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::FFTND(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpFFTND_InitShape(PyBobSpFFTNDObject* self, PyObject *args,
+    PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"shape", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* o = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &o)) return -1;
+
+  std::vector<size_t> shape;
+  if (!PyBobSpFFTND_AsShape((PyObject*)self, o, shape)) return -1;
+
+  try {
+    self->cxx = new bob::sp::FFTND(shape);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpFFTND_Init(PyBobSpFFTNDObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  if (nargs != 1) {
+    PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 argument, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+    return -1;
+  }
+
+  PyObject* arg = 0; ///< borrowed (don't delete)
+  if (PyTuple_Size(args)) arg = PyTuple_GET_ITEM(args, 0);
+  else {
+    PyObject* tmp = PyDict_Values(kwds);
+    auto tmp_ = make_safe(tmp);
+    arg = PyList_GET_ITEM(tmp, 0);
+  }
+
+  if (PyBobSpFFTND_Check(arg)) return PyBobSpFFTND_InitCopy(self, args, kwds);
+  return PyBobSpFFTND_InitShape(self, args, kwds);
+
+}
+
+static PyObject* PyBobSpFFTND_Repr(PyBobSpFFTNDObject* self) {
+  const std::vector<size_t>& shape = self->cxx->getShape();
+  std::ostringstream s;
+  s << "(";
+  for (size_t i=0; i<shape.size(); ++i) s << (i ? ", " : "") << shape[i];
+  s << (shape.size() == 1 ? ",)" : ")");
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(shape=%s)", Py_TYPE(self)->tp_name, s.str().c_str());
+}
+
+static PyObject* PyBobSpFFTND_RichCompare (PyBobSpFFTNDObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpFFTND_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpFFTNDObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_shape_str, "shape");
+PyDoc_STRVAR(s_shape_doc,
+"A tuple that represents the shape of the input and output arrays\n\
+");
+
+static PyObject* PyBobSpFFTND_GetShape
+(PyBobSpFFTNDObject* self, void* /*closure*/) {
+
+  const std::vector<size_t>& shape = self->cxx->getShape();
+  PyObject* retval = PyTuple_New(shape.size());
+  if (!retval) return 0;
+  for (size_t i=0; i<shape.size(); ++i)
+    PyTuple_SET_ITEM(retval, i, Py_BuildValue("n", shape[i]));
+  return retval;
+
+}
+
+static int PyBobSpFFTND_SetShape
+(PyBobSpFFTNDObject* self, PyObject* o, void* /*closure*/) {
+
+  std::vector<size_t> shape;
+  if (!PyBobSpFFTND_AsShape((PyObject*)self, o, shape)) return -1;
+
+  try {
+    self->cxx->setShape(shape);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `shape' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_rank_str, "rank");
+PyDoc_STRVAR(s_rank_doc,
+"The number of dimensions of the input and output arrays\n\
+");
+
+static PyObject* PyBobSpFFTND_GetRank
+(PyBobSpFFTNDObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getRank());
+}
+
+PyDoc_STRVAR(s_threads_str, "threads");
+PyDoc_STRVAR(s_threads_doc,
+"The number of threads over which the transforms along each\n\
+dimension are spread, 0 standing for the number of hardware\n\
+threads\n\
+");
+
+static PyObject* PyBobSpFFTND_GetThreads
+(PyBobSpFFTNDObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getThreads());
+}
+
+static int PyBobSpFFTND_SetThreads
+(PyBobSpFFTNDObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' threads can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t threads = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (threads < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' threads cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  self->cxx->setThreads(threads);
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the 1D FFTs this transform is made\n\
+of: ``'fftpack'`` (default), ``'stockham'``, ``'tuned'`` (the\n\
+fastest of the two, measured) or ``'fftw'``, if the library was\n\
+compiled with FFTW3 (see :py:func:`available_engines`).\n\
+");
+
+static PyObject* PyBobSpFFTND_GetEngine
+(PyBobSpFFTNDObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpFFTND_SetEngine
+(PyBobSpFFTNDObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static PyGetSetDef PyBobSpFFTND_getseters[] = {
+    {
+      s_shape_str,
+      (getter)PyBobSpFFTND_GetShape,
+      (setter)PyBobSpFFTND_SetShape,
+      s_shape_doc,
+      0
+    },
+    {
+      s_rank_str,
+      (getter)PyBobSpFFTND_GetRank,
+      0,
+      s_rank_doc,
+      0
+    },
+    {
+      s_threads_str,
+      (getter)PyBobSpFFTND_GetThreads,
+      (setter)PyBobSpFFTND_SetThreads,
+      s_threads_doc,
+      0
+    },
+    {
+      s_engine_str,
+      (getter)PyBobSpFFTND_GetEngine,
+      (setter)PyBobSpFFTND_SetEngine,
+      s_engine_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+template <typename T, int N>
+static void call(const bob::sp::FFTND& op, PyBlitzArrayObject* input,
+    PyBlitzArrayObject* output) {
+  op(*PyBlitzArrayCxx_AsBlitz<T,N>(input), *PyBlitzArrayCxx_AsBlitz<T,N>(output));
+}
+
+template <typename T>
+static void call(const bob::sp::FFTND& op, PyBlitzArrayObject* input,
+    PyBlitzArrayObject* output) {
+  switch (input->ndim) {
+    case 1: call<T,1>(op, input, output); break;
+    case 2: call<T,2>(op, input, output); break;
+    case 3: call<T,3>(op, input, output); break;
+    case 4: call<T,4>(op, input, output); break;
+  }
+}
+
+static PyObject* PyBobSpFFTND_Call
+(PyBobSpFFTNDObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_COMPLEX64);
+  const int output_type = (single ? NPY_COMPLEX64 : NPY_COMPLEX128);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)", single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)");
+    return 0;
+  }
+
+  const std::vector<size_t>& shape = self->cxx->getShape();
+
+  if (input->ndim != (Py_ssize_t)shape.size()) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts %" PY_FORMAT_SIZE_T "d-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, shape.size(), input->ndim);
+    return 0;
+  }
+
+  if (input->ndim > 4) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts arrays of up to 4 dimensions (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && input->ndim != output->ndim) {
+    PyErr_Format(PyExc_RuntimeError, "Input and output arrays should have matching number of dimensions, but input array `input' has %" PY_FORMAT_SIZE_T "d dimensions while output array `output' has %" PY_FORMAT_SIZE_T "d dimensions", input->ndim, output->ndim);
+    return 0;
+  }
+
+  if (output) {
+    for (Py_ssize_t i=0; i<output->ndim; ++i)
+      if (output->shape[i] != (Py_ssize_t)shape[i]) {
+        PyErr_Format(PyExc_RuntimeError, "`output' array should have %" PY_FORMAT_SIZE_T "d elements along dimension %" PY_FORMAT_SIZE_T "d matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", shape[i], i, Py_TYPE(self)->tp_name, output->shape[i]);
+        return 0;
+      }
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    Py_ssize_t size[4];
+    for (size_t i=0; i<shape.size(); ++i) size[i] = shape[i];
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, input->ndim, size);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (single) call<std::complex<float> >(*self->cxx, input, output);
+    else call<std::complex<double> >(*self->cxx, input, output);
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpFFTND_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_fftnd_str,                              /*tp_name*/
+    sizeof(PyBobSpFFTNDObject),               /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpFFTND_Delete,          /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpFFTND_Repr,              /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpFFTND_Call,           /* tp_call */
+    (reprfunc)PyBobSpFFTND_Repr,              /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_fftnd_doc,                              /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpFFTND_RichCompare,    /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    0,                                        /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpFFTND_getseters,                   /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpFFTND_Init,              /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
@@ -0,0 +1,518 @@
+/**
+ * @date Sat Oct 17 16:41:27 CEST 2026
+ *
+ * @brief Python bindings to the Goertzel evaluation of a few bins of the DFT
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/Goertzel.h>
+
+PyDoc_STRVAR(s_goertzel_str, BOB_EXT_MODULE_PREFIX ".Goertzel");
+
+PyDoc_STRVAR(s_goertzel_doc,
+"Goertzel(length, frequencies) -> new Goertzel operator\n\
+\n\
+Evaluates the DFT of real signals of the given ``length`` at a\n\
+few ``frequencies`` only (in bins, that is ``f/length`` cycles\n\
+per sample, and possibly fractional), with the Goertzel\n\
+algorithm. This costs about ``length`` multiply-adds per\n\
+frequency, against ``length*log2(length)`` for a full FFT, hence\n\
+is faster when there are fewer frequencies than ``log2(length)``,\n\
+or a few times more, as the recurrences of several frequencies\n\
+run side by side in SIMD registers.\n\
+\n\
+The operator accepts 1D NumPy arrays of type ``float64`` or\n\
+``float32`` (of the given ``length``), and 2D arrays of such\n\
+signals (a batch, one signal per row). It returns the values of\n\
+the transform at the :py:attr:`frequencies`, in their order, as\n\
+arrays of type ``complex128`` or ``complex64`` respectively,\n\
+with one row per signal for 2D arrays. :py:meth:`power` returns\n\
+their squared magnitudes, which are cheaper to compute. The\n\
+computations are done in double precision in any case.\n\
+"
+);
+
+/**
+ * Represents a Goertzel
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::Goertzel* cxx;
+} PyBobSpGoertzelObject;
+
+extern PyTypeObject PyBobSpGoertzel_Type; //forward declaration
+
+int PyBobSpGoertzel_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpGoertzel_Type));
+}
+
+/**
+ * Converts a sequence of frequencies
+ */
+static bool PyBobSpGoertzel_AsFrequencies(PyObject* self, PyObject* o,
+    std::vector<double>& frequencies) {
+
+  if (!PySequence_Check(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' frequencies can only be set using tuples (or sequences), not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return false;
+  }
+
+  PyObject* tuple = PySequence_Tuple(o);
+  if (!tuple) return false;
+  auto tuple_ = make_safe(tuple);
+
+  frequencies.clear();
+  for (Py_ssize_t i=0; i<PyTuple_GET_SIZE(tuple); ++i) {
+    double v = PyFloat_AsDouble(PyTuple_GET_ITEM(tuple, i));
+    if (PyErr_Occurred()) return false;
+    frequencies.push_back(v);
+  }
+
+  return true;
+
+}
+
+static void PyBobSpGoertzel_Delete (PyBobSpGoertzelObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpGoertzel_InitCopy
+(PyBobSpGoertzelObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpGoertzel_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpGoertzelObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::Goertzel(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpGoertzel_InitLength(PyBobSpGoertzelObject* self,
+    PyObject *args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"length", "frequencies", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t length = 0;
+  PyObject* o = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "nO", kwlist, &length, &o))
+    return -1;
+
+  if (length < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  std::vector<double> frequencies;
+  if (!PyBobSpGoertzel_AsFrequencies((PyObject*)self, o, frequencies))
+    return -1;
+
+  try {
+    self->cxx = new bob::sp::Goertzel(length, frequencies);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpGoertzel_Init(PyBobSpGoertzelObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+
+      return PyBobSpGoertzel_InitCopy(self, args, kwds);
+
+    case 2:
+
+      return PyBobSpGoertzel_InitLength(self, args, kwds);
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 or 2 arguments, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpGoertzel_Repr(PyBobSpGoertzelObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(length=%zu, frequencies=%zu)", Py_TYPE(self)->tp_name,
+   self->cxx->getLength(), self->cxx->getFrequencies().size());
+}
+
+static PyObject* PyBobSpGoertzel_RichCompare (PyBobSpGoertzelObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpGoertzel_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpGoertzelObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_length_str, "length");
+PyDoc_STRVAR(s_length_doc,
+"The length of the signals\n\
+");
+
+static PyObject* PyBobSpGoertzel_GetLength
+(PyBobSpGoertzelObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getLength());
+}
+
+static int PyBobSpGoertzel_SetLength
+(PyBobSpGoertzelObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' length can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (len < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  try {
+    self->cxx->setLength(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `length' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_frequencies_str, "frequencies");
+PyDoc_STRVAR(s_frequencies_doc,
+"A tuple with the frequencies at which the transform is\n\
+evaluated, in bins (``f/length`` cycles per sample), in the\n\
+order of the results. They may be fractional, negative or larger\n\
+than :py:attr:`length`.\n\
+");
+
+static PyObject* PyBobSpGoertzel_GetFrequencies
+(PyBobSpGoertzelObject* self, void* /*closure*/) {
+
+  const std::vector<double>& frequencies = self->cxx->getFrequencies();
+  PyObject* retval = PyTuple_New(frequencies.size());
+  if (!retval) return 0;
+  auto retval_ = make_safe(retval);
+
+  for (size_t i=0; i<frequencies.size(); ++i) {
+    PyObject* v = Py_BuildValue("d", frequencies[i]);
+    if (!v) return 0;
+    PyTuple_SET_ITEM(retval, i, v);
+  }
+
+  Py_INCREF(retval);
+  return retval;
+
+}
+
+static int PyBobSpGoertzel_SetFrequencies
+(PyBobSpGoertzelObject* self, PyObject* o, void* /*closure*/) {
+
+  std::vector<double> frequencies;
+  if (!PyBobSpGoertzel_AsFrequencies((PyObject*)self, o, frequencies))
+    return -1;
+
+  try {
+    self->cxx->setFrequencies(frequencies);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `frequencies' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static PyGetSetDef PyBobSpGoertzel_getseters[] = {
+    {
+      s_length_str,
+      (getter)PyBobSpGoertzel_GetLength,
+      (setter)PyBobSpGoertzel_SetLength,
+      s_length_doc,
+      0
+    },
+    {
+      s_frequencies_str,
+      (getter)PyBobSpGoertzel_GetFrequencies,
+      (setter)PyBobSpGoertzel_SetFrequencies,
+      s_frequencies_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+/**
+ * Evaluates the transform (or its power) of the input signals
+ */
+static PyObject* PyBobSpGoertzel_Evaluate
+(PyBobSpGoertzelObject* self, PyObject* args, PyObject* kwds, bool power) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_FLOAT64 && input->type_num != NPY_FLOAT32) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit or 32-bit float arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  const bool single = (input->type_num == NPY_FLOAT32);
+  int type_num;
+  if (power) type_num = single ? NPY_FLOAT32 : NPY_FLOAT64;
+  else type_num = single ? NPY_COMPLEX64 : NPY_COMPLEX128;
+
+  if (output && output->type_num != type_num) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports arrays of type `%s' for output array `output' (matching the input)", Py_TYPE(self)->tp_name, PyBlitzArray_TypenumAsString(type_num));
+    return 0;
+  }
+
+  if (input->ndim != 1 && input->ndim != 2) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1 or 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && output->ndim != input->ndim) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts %" PY_FORMAT_SIZE_T "d-dimensional output arrays (matching the input), not %" PY_FORMAT_SIZE_T "dD arrays", Py_TYPE(self)->tp_name, input->ndim, output->ndim);
+    return 0;
+  }
+
+  Py_ssize_t length = self->cxx->getLength();
+  if (input->shape[input->ndim-1] != length) {
+    PyErr_Format(PyExc_RuntimeError, "`input' signals should have %" PY_FORMAT_SIZE_T "d elements matching `%s' length, not %" PY_FORMAT_SIZE_T "d elements", length, Py_TYPE(self)->tp_name, input->shape[input->ndim-1]);
+    return 0;
+  }
+
+  Py_ssize_t shape[2];
+  if (input->ndim == 1) shape[0] = self->cxx->getFrequencies().size();
+  else {
+    shape[0] = input->shape[0];
+    shape[1] = self->cxx->getFrequencies().size();
+  }
+
+  if (output && (output->shape[0] != shape[0] ||
+        (input->ndim == 2 && output->shape[1] != shape[1]))) {
+    PyErr_Format(PyExc_RuntimeError, "`output' array should have one row per signal and %" PY_FORMAT_SIZE_T "d columns matching `%s' number of frequencies", shape[input->ndim-1], Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(type_num, input->ndim, shape);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (input->ndim == 1) {
+      if (single && power)
+        self->cxx->power(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,1>(output));
+      else if (single)
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+      else if (power)
+        self->cxx->power(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,1>(output));
+      else
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+    }
+    else {
+      if (single && power)
+        self->cxx->power(*PyBlitzArrayCxx_AsBlitz<float,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<float,2>(output));
+      else if (single)
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<float,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output));
+      else if (power)
+        self->cxx->power(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+      else
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+    }
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyDoc_STRVAR(s_power_str, "power");
+PyDoc_STRVAR(s_power_doc,
+"power(input, [output]) -> array\n\
+\n\
+Computes the power (squared magnitude) of the transform of the\n\
+input signals at the :py:attr:`frequencies`, as arrays of type\n\
+``float64`` or ``float32`` (matching the input), with the same\n\
+shapes as the ones returned by the operator.\n\
+");
+
+static PyObject* PyBobSpGoertzel_Power
+(PyBobSpGoertzelObject* self, PyObject* args, PyObject* kwds) {
+  return PyBobSpGoertzel_Evaluate(self, args, kwds, true);
+}
+
+static PyMethodDef PyBobSpGoertzel_methods[] = {
+  {
+    s_power_str,
+    (PyCFunction)PyBobSpGoertzel_Power,
+    METH_VARARGS|METH_KEYWORDS,
+    s_power_doc,
+  },
+  {0} /* Sentinel */
+};
+
+static PyObject* PyBobSpGoertzel_Call
+(PyBobSpGoertzelObject* self, PyObject* args, PyObject* kwds) {
+  return PyBobSpGoertzel_Evaluate(self, args, kwds, false);
+}
+
+PyTypeObject PyBobSpGoertzel_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_goertzel_str,                           /*tp_name*/
+    sizeof(PyBobSpGoertzelObject),            /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpGoertzel_Delete,       /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpGoertzel_Repr,           /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpGoertzel_Call,        /* tp_call */
+    (reprfunc)PyBobSpGoertzel_Repr,           /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_goertzel_doc,                           /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpGoertzel_RichCompare, /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    PyBobSpGoertzel_methods,                  /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpGoertzel_getseters,                /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpGoertzel_Init,           /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
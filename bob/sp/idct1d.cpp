@@ -12,6 +12,10 @@
 #include <bob.extension/defines.h>
 #include <bob.sp/DCT1D.h>
 
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
 PyDoc_STRVAR(s_fft1d_str, BOB_EXT_MODULE_PREFIX ".IDCT1D");
 
 PyDoc_STRVAR(s_fft1d_doc,
@@ -19,6 +23,12 @@ PyDoc_STRVAR(s_fft1d_doc,
 \n\
 Calculates the inverse DCT of a 1D array/signal. Input and output\n\
 arrays are 1D NumPy arrays of type ``float64``.\n\
+The output array may be the input array itself, in which case\n\
+the transform is computed in-place. The transform still uses\n\
+complex working arrays, larger than the signal.\n\
+\n\
+Single precision arrays (of type ``float32``) are also accepted,\n\
+in which case the transform is computed in single precision.\n\
 "
 );
 
@@ -269,6 +279,41 @@ static int PyBobSpIDCT1D_SetShape
 
 }
 
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the 1D FFTs this transform is made\n\
+of: ``'fftpack'`` (default), ``'stockham'``, ``'tuned'`` (the\n\
+fastest of the two, measured) or ``'fftw'``, if the library was\n\
+compiled with FFTW3 (see :py:func:`available_engines`).\n\
+");
+
+static PyObject* PyBobSpIDCT1D_GetEngine
+(PyBobSpIDCT1DObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpIDCT1D_SetEngine
+(PyBobSpIDCT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
 static PyGetSetDef PyBobSpIDCT1D_getseters[] = {
     {
       s_length_str,
@@ -284,6 +329,13 @@ static PyGetSetDef PyBobSpIDCT1D_getseters[] = {
       s_shape_doc,
       0
     },
+    {
+      s_engine_str,
+      (getter)PyBobSpIDCT1D_GetEngine,
+      (setter)PyBobSpIDCT1D_SetEngine,
+      s_engine_doc,
+      0
+    },
     {0}  /* Sentinel */
 };
 
@@ -305,13 +357,17 @@ static PyObject* PyBobSpIDCT1D_Call
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (input->type_num != NPY_FLOAT64) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit float arrays for input array `input'", Py_TYPE(self)->tp_name);
+  if (input->type_num != NPY_FLOAT64 && input->type_num != NPY_FLOAT32) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit float or 32-bit float arrays for input array `input'", Py_TYPE(self)->tp_name);
     return 0;
   }
 
-  if (output && output->type_num != NPY_FLOAT64) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit float arrays for output array `output'", Py_TYPE(self)->tp_name);
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_FLOAT32);
+  const int output_type = (single ? NPY_FLOAT32 : NPY_FLOAT64);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "32-bit float" : "64-bit float", single ? "32-bit float" : "64-bit float");
     return 0;
   }
 
@@ -333,14 +389,18 @@ static PyObject* PyBobSpIDCT1D_Call
   /** if ``output`` was not pre-allocated, do it now **/
   if (!output) {
     Py_ssize_t length = self->cxx->getLength();
-    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_FLOAT64, 1, &length);
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, 1, &length);
     output_ = make_safe(output);
   }
 
   /** all basic checks are done, can call the operator now **/
   try {
-    self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
-        *PyBlitzArrayCxx_AsBlitz<double,1>(output));
+    if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<float,1>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<double,1>(output));
   }
   catch (std::exception& e) {
     PyErr_SetString(PyExc_RuntimeError, e.what());
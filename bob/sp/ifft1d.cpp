@@ -12,6 +12,10 @@
 #include <bob.extension/defines.h>
 #include <bob.sp/FFT1D.h>
 
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
 PyDoc_STRVAR(s_fft1d_str, BOB_EXT_MODULE_PREFIX ".IFFT1D");
 
 PyDoc_STRVAR(s_fft1d_doc,
@@ -19,6 +23,20 @@ PyDoc_STRVAR(s_fft1d_doc,
 \n\
 Calculates the inverse FFT of a 1D array/signal. Input and output\n\
 arrays are 1D NumPy arrays of type ``complex128``.\n\
+The output array may be the input array itself, in which case\n\
+the transform is computed in-place, without a copy of the\n\
+signal. The transform still uses a working array of the size of\n\
+the signal (more for the lengths with large prime factors).\n\
+\n\
+Single precision arrays (of type ``complex64``) are also accepted,\n\
+in which case the transform is computed in single precision.\n\
+\n\
+A batch of signals may be transformed in a single call, by\n\
+passing a 2D array: the transform is then applied to each of its\n\
+1D slices along ``axis`` (the last one by default), which must\n\
+have the length of this operator, using :py:attr:`threads`\n\
+threads. A batch without any signal (of shape ``(N, 0)`` along\n\
+axis 0, or ``(0, N)`` along axis 1) is returned unchanged.\n\
 "
 );
 
@@ -269,6 +287,115 @@ static int PyBobSpIFFT1D_SetShape
 
 }
 
+PyDoc_STRVAR(s_threads_str, "threads");
+PyDoc_STRVAR(s_threads_doc,
+"The number of threads used to transform batches of signals (2D\n\
+arrays), 0 standing for the number of hardware threads. When 3 of\n\
+them at least may run in parallel, on as many hardware threads, the\n\
+single signals too large for the caches (from 2**20 values, whose\n\
+length has balanced factors) are spread over the threads too, with\n\
+the four-step algorithm, which is slower on fewer threads\n\
+");
+
+static PyObject* PyBobSpIFFT1D_GetThreads
+(PyBobSpIFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getThreads());
+}
+
+static int PyBobSpIFFT1D_SetThreads
+(PyBobSpIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' threads can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t threads = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (threads < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' threads cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  self->cxx->setThreads(threads);
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the transform: ``'fftpack'`` (default),\n\
+``'stockham'``, a native Stockham autosort engine, ``'tuned'``,\n\
+which times fftpack with several orders of the factors of the\n\
+length and the Stockham engine when the length is first planned,\n\
+and keeps the fastest, or ``'fftw'``, if the library was compiled\n\
+with FFTW3 (see :py:func:`available_engines`). Which one is\n\
+faster depends on the length and on the machine.\n\
+");
+
+static PyObject* PyBobSpIFFT1D_GetEngine
+(PyBobSpIFFT1DObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpIFFT1D_SetEngine
+(PyBobSpIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_centered_str, "centered");
+PyDoc_STRVAR(s_centered_doc,
+"If ``True``, the input spectrum is expected to be centered,\n\
+with the zero frequency at index ``length//2``, as the output of\n\
+:py:func:`fftshift`: the shift is undone by the transform, which\n\
+avoids calling :py:func:`ifftshift` first (``False`` by default)\n\
+");
+
+static PyObject* PyBobSpIFFT1D_GetCentered
+(PyBobSpIFFT1DObject* self, void* /*closure*/) {
+  return PyBool_FromLong(self->cxx->getCentered());
+}
+
+static int PyBobSpIFFT1D_SetCentered
+(PyBobSpIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  int centered = PyObject_IsTrue(o);
+  if (centered < 0) return -1;
+
+  try {
+    self->cxx->setCentered(centered);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `centered' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
 static PyGetSetDef PyBobSpIFFT1D_getseters[] = {
     {
       s_length_str,
@@ -284,39 +411,66 @@ static PyGetSetDef PyBobSpIFFT1D_getseters[] = {
       s_shape_doc,
       0
     },
+    {
+      s_threads_str,
+      (getter)PyBobSpIFFT1D_GetThreads,
+      (setter)PyBobSpIFFT1D_SetThreads,
+      s_threads_doc,
+      0
+    },
+    {
+      s_engine_str,
+      (getter)PyBobSpIFFT1D_GetEngine,
+      (setter)PyBobSpIFFT1D_SetEngine,
+      s_engine_doc,
+      0
+    },
+    {
+      s_centered_str,
+      (getter)PyBobSpIFFT1D_GetCentered,
+      (setter)PyBobSpIFFT1D_SetCentered,
+      s_centered_doc,
+      0
+    },
     {0}  /* Sentinel */
 };
 
 static PyObject* PyBobSpIFFT1D_Call
 (PyBobSpIFFT1DObject* self, PyObject* args, PyObject* kwds) {
 
-  static const char* const_kwlist[] = {"input", "output", 0};
+  static const char* const_kwlist[] = {"input", "output", "axis", 0};
   static char** kwlist = const_cast<char**>(const_kwlist);
 
   PyBlitzArrayObject* input = 0;
   PyBlitzArrayObject* output = 0;
+  int axis = -1;
 
-  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&i", kwlist,
         &PyBlitzArray_Converter, &input,
-        &PyBlitzArray_OutputConverter, &output
+        &PyBlitzArray_OutputConverter, &output,
+        &axis
         )) return 0;
 
   //protects acquired resources through this scope
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (input->type_num != NPY_COMPLEX128) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
     return 0;
   }
 
-  if (output && output->type_num != NPY_COMPLEX128) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) arrays for output array `output'", Py_TYPE(self)->tp_name);
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_COMPLEX64);
+  const int output_type = (single ? NPY_COMPLEX64 : NPY_COMPLEX128);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)", single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)");
     return 0;
   }
 
-  if (input->ndim != 1) {
-    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+  if (input->ndim != 1 && input->ndim != 2) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1 or 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
     return 0;
   }
 
@@ -325,22 +479,50 @@ static PyObject* PyBobSpIFFT1D_Call
     return 0;
   }
 
-  if (output && output->shape[0] != (Py_ssize_t)self->cxx->getLength()) {
-    PyErr_Format(PyExc_RuntimeError, "1D `output' array should have %" PY_FORMAT_SIZE_T "d elements matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getLength(), Py_TYPE(self)->tp_name, output->shape[0]);
-    return 0;
+  if (input->ndim == 1) {
+    if (output && output->shape[0] != (Py_ssize_t)self->cxx->getLength()) {
+      PyErr_Format(PyExc_RuntimeError, "1D `output' array should have %" PY_FORMAT_SIZE_T "d elements matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getLength(), Py_TYPE(self)->tp_name, output->shape[0]);
+      return 0;
+    }
+  }
+  else { // input->ndim == 2, a batch of signals along axis
+    if (axis < 0) axis += 2;
+    if (axis != 0 && axis != 1) {
+      PyErr_Format(PyExc_RuntimeError, "`%s' can only transform 2D arrays along axis 0 or 1 (or -1)", Py_TYPE(self)->tp_name);
+      return 0;
+    }
+    if (input->shape[axis] != (Py_ssize_t)self->cxx->getLength()) {
+      PyErr_Format(PyExc_RuntimeError, "2D `input' array should have %" PY_FORMAT_SIZE_T "d elements along axis %d matching `%s' input size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getLength(), axis, Py_TYPE(self)->tp_name, input->shape[axis]);
+      return 0;
+    }
+    if (output && (output->shape[0] != input->shape[0] || output->shape[1] != input->shape[1])) {
+      PyErr_Format(PyExc_RuntimeError, "2D `output' array should have the shape of the `input' array, (%" PY_FORMAT_SIZE_T "d, %" PY_FORMAT_SIZE_T "d), not (%" PY_FORMAT_SIZE_T "d, %" PY_FORMAT_SIZE_T "d)", input->shape[0], input->shape[1], output->shape[0], output->shape[1]);
+      return 0;
+    }
   }
 
   /** if ``output`` was not pre-allocated, do it now **/
   if (!output) {
-    Py_ssize_t length = self->cxx->getLength();
-    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_COMPLEX128, 1, &length);
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, input->ndim, input->shape);
     output_ = make_safe(output);
   }
 
   /** all basic checks are done, can call the operator now **/
   try {
-    self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
-        *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+    if (input->ndim == 2) {
+      if (single)
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output), axis);
+      else
+        self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+            *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output), axis);
+    }
+    else if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
   }
   catch (std::exception& e) {
     PyErr_SetString(PyExc_RuntimeError, e.what());
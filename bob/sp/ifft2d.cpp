@@ -12,6 +12,10 @@
 #include <bob.extension/defines.h>
 #include <bob.sp/FFT2D.h>
 
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
 PyDoc_STRVAR(s_fft2d_str, BOB_EXT_MODULE_PREFIX ".IFFT2D");
 
 PyDoc_STRVAR(s_fft2d_doc,
@@ -19,6 +23,15 @@ PyDoc_STRVAR(s_fft2d_doc,
 \n\
 Calculates the inverse FFT of a 2D array/signal. Input and output\n\
 arrays are 2D NumPy arrays of type ``complex128``.\n\
+The output array may be the input array itself, in which case\n\
+the transform is computed in-place, without any temporary of\n\
+its size.\n\
+\n\
+Single precision arrays (of type ``complex64``) are also accepted,\n\
+in which case the transform is computed in single precision.\n\
+\n\
+The rows, then the columns, are transformed by :py:attr:`threads`\n\
+threads.\n\
 "
 );
 
@@ -291,6 +304,110 @@ static int PyBobSpIFFT2D_SetShape
 
 }
 
+PyDoc_STRVAR(s_threads_str, "threads");
+PyDoc_STRVAR(s_threads_doc,
+"The number of threads over which the transforms of the rows, then\n\
+of the columns, are spread, 0 standing for the number of hardware\n\
+threads\n\
+");
+
+static PyObject* PyBobSpIFFT2D_GetThreads
+(PyBobSpIFFT2DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getThreads());
+}
+
+static int PyBobSpIFFT2D_SetThreads
+(PyBobSpIFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' threads can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t threads = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (threads < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' threads cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  self->cxx->setThreads(threads);
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the 1D FFTs this transform is made\n\
+of: ``'fftpack'`` (default), ``'stockham'``, ``'tuned'`` (the\n\
+fastest of the two, measured) or ``'fftw'``, if the library was\n\
+compiled with FFTW3 (see :py:func:`available_engines`).\n\
+");
+
+static PyObject* PyBobSpIFFT2D_GetEngine
+(PyBobSpIFFT2DObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpIFFT2D_SetEngine
+(PyBobSpIFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_centered_str, "centered");
+PyDoc_STRVAR(s_centered_doc,
+"If ``True``, the input spectrum is expected to be centered along\n\
+both dimensions, with the zero frequency at index\n\
+``(height//2, width//2)``, as the output of :py:func:`fftshift`:\n\
+the shift is undone by the transform, which avoids calling\n\
+:py:func:`ifftshift` first (``False`` by default)\n\
+");
+
+static PyObject* PyBobSpIFFT2D_GetCentered
+(PyBobSpIFFT2DObject* self, void* /*closure*/) {
+  return PyBool_FromLong(self->cxx->getCentered());
+}
+
+static int PyBobSpIFFT2D_SetCentered
+(PyBobSpIFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  int centered = PyObject_IsTrue(o);
+  if (centered < 0) return -1;
+
+  try {
+    self->cxx->setCentered(centered);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `centered' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
 static PyGetSetDef PyBobSpIFFT2D_getseters[] = {
     {
       s_height_str,
@@ -313,6 +430,27 @@ static PyGetSetDef PyBobSpIFFT2D_getseters[] = {
       s_shape_doc,
       0
     },
+    {
+      s_threads_str,
+      (getter)PyBobSpIFFT2D_GetThreads,
+      (setter)PyBobSpIFFT2D_SetThreads,
+      s_threads_doc,
+      0
+    },
+    {
+      s_engine_str,
+      (getter)PyBobSpIFFT2D_GetEngine,
+      (setter)PyBobSpIFFT2D_SetEngine,
+      s_engine_doc,
+      0
+    },
+    {
+      s_centered_str,
+      (getter)PyBobSpIFFT2D_GetCentered,
+      (setter)PyBobSpIFFT2D_SetCentered,
+      s_centered_doc,
+      0
+    },
     {0}  /* Sentinel */
 };
 
@@ -334,13 +472,17 @@ static PyObject* PyBobSpIFFT2D_Call
   auto input_ = make_safe(input);
   auto output_ = make_xsafe(output);
 
-  if (input->type_num != NPY_COMPLEX128) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
     return 0;
   }
 
-  if (output && output->type_num != NPY_COMPLEX128) {
-    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) arrays for output array `output'", Py_TYPE(self)->tp_name);
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_COMPLEX64);
+  const int output_type = (single ? NPY_COMPLEX64 : NPY_COMPLEX128);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)", single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)");
     return 0;
   }
 
@@ -369,14 +511,18 @@ static PyObject* PyBobSpIFFT2D_Call
     Py_ssize_t size[2];
     size[0] = self->cxx->getHeight();
     size[1] = self->cxx->getWidth();
-    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_COMPLEX128, 2, size);
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, 2, size);
     output_ = make_safe(output);
   }
 
   /** all basic checks are done, can call the operator now **/
   try {
-    self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
-        *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
+    if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(output));
   }
   catch (std::exception& e) {
     PyErr_SetString(PyExc_RuntimeError, e.what());
@@ -0,0 +1,170 @@
+/**
+ * @date Sat Oct 17 17:26:03 CEST 2026
+ *
+ * @brief Implement a blitz-based chirp-z transform, which evaluates the
+ * z-transform of a signal at points of a spiral arc of the z-plane (such as
+ * a narrow band of frequencies)
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_CHIRPZ_H
+#define BOB_SP_CHIRPZ_H
+
+#include <complex>
+#include <vector>
+#include <blitz/array.h>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements the chirp-z transform of signals of a
+   * given length N: the z-transform of the signal is evaluated at M points
+   * z_k = A * W^(-k) of a spiral arc of the z-plane,
+   *   X_k = sum_{n<N} x_n * A^(-n) * W^(n*k),  for k < M
+   * A being the starting point of the arc and W the ratio between two of
+   * its points. As n*k = (n^2 + k^2 - (k-n)^2) / 2, the transform is a
+   * linear convolution of the chirped signal x_n * A^(-n) * W^(n^2/2) with
+   * the chirp W^(-j^2/2), which is computed with two FFTs of a fast length
+   * L >= N+M-1 (see FFTPlanBase::nextFastLength()), the transform of the
+   * chirp being computed once. This costs O((N+M)*log(N+M)), whatever the arc.
+   *
+   * When A and W are on the unit circle, the points are frequencies: a
+   * narrow band is then resolved finely without zero padding the signal to
+   * a huge length (see setFrequencyRange()). By default, the points are M
+   * equally spaced points of the unit circle, which gives the DFT of the
+   * signal if M = N.
+   *
+   * The chirps are computed in double precision. As their magnitudes grow
+   * (or decay) exponentially with n^2 when W is not on the unit circle, the
+   * transform is only accurate on arcs which stay close to it.
+   */
+  class ChirpZ
+  {
+    public:
+      /**
+       * @brief Constructor: one point, for signals of length 1
+       */
+      ChirpZ();
+
+      /**
+       * @brief Constructor: the given number of equally spaced points of the
+       * unit circle, for signals of the given length
+       */
+      ChirpZ(const size_t length, const size_t points);
+
+      /**
+       * @brief Constructor: the given number of points of the arc starting
+       * at a with ratio w, for signals of the given length
+       */
+      ChirpZ(const size_t length, const size_t points,
+          const std::complex<double>& w, const std::complex<double>& a);
+
+      /**
+       * @brief Copy constructor
+       */
+      ChirpZ(const ChirpZ& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~ChirpZ();
+
+      /**
+       * @brief Assignment operator
+       */
+      ChirpZ& operator=(const ChirpZ& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const ChirpZ& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const ChirpZ& other) const;
+
+      /**
+       * @brief Computes the transform of the signal src (of the given
+       * length) at the points of the arc, into dst (of the given number of
+       * points)
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<std::complex<double>,1>& src,
+          blitz::Array<std::complex<double>,1>& dst) const;
+      void operator()(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+
+      /**
+       * @brief Same as above, for each row of src (a batch of signals)
+       */
+      void operator()(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<std::complex<double>,2>& dst) const;
+      void operator()(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+
+      /**
+       * @brief Getters
+       * getW() is the ratio between two points of the arc, and getA() its
+       * starting point. getEngine() is the backend of the FFTs of the
+       * convolution (see FFTPlanBase::Engine).
+       */
+      size_t getLength() const { return m_length; }
+      size_t getPoints() const { return m_points; }
+      const std::complex<double>& getW() const { return m_w; }
+      const std::complex<double>& getA() const { return m_a; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+      /**
+       * @brief Setters
+       * w and a should be non-zero. setFrequencyRange() sets the points to
+       * the frequencies start + k*(stop-start)/M, in bins of the current
+       * length (f/N cycles per sample), stop being excluded: the points do
+       * not follow a later change of the length.
+       */
+      void setLength(const size_t length);
+      void setPoints(const size_t points);
+      void setW(const std::complex<double>& w);
+      void setA(const std::complex<double>& a);
+      void setFrequencyRange(const double start, const double stop);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    private:
+      /**
+       * @brief Computes the transforms of the rows of src (contiguous) into
+       * the rows of dst (contiguous)
+       */
+      template <typename T>
+      void process(const std::complex<T>* src, const size_t rows,
+          std::complex<T>* dst) const;
+
+      /**
+       * @brief Initialize working array: chirps, transform of the
+       * convolution kernel and (shared) plan of the FFTs
+       */
+      void initWorkingArray();
+
+      /**
+       * Private attributes. m_input_chirp are the factors A^(-n)*W^(n^2/2)
+       * of the signal, m_output_chirp the factors W^(k^2/2) of the
+       * transform, and m_kernel the transform of the chirp W^(-j^2/2),
+       * wrapped around to the length L of the convolution, and normalized
+       * by 1/L.
+       */
+      size_t m_length;
+      size_t m_points;
+      std::complex<double> m_w;
+      std::complex<double> m_a;
+      FFTPlanBase::Engine m_engine;
+      std::vector<std::complex<double> > m_input_chirp;
+      std::vector<std::complex<double> > m_output_chirp;
+      std::vector<std::complex<double> > m_kernel;
+      bob::sp::detail::FFTPlans m_plans;
+  };
+
+}}
+
+#endif /* BOB_SP_CHIRPZ_H */
@@ -0,0 +1,160 @@
+/**
+ * @date Fri Oct 16 20:05:41 CEST 2026
+ *
+ * @brief Blocked column passes of the multidimensional transforms: the
+ * columns of a C-ordered array are transformed by tiles, gathered into a
+ * contiguous buffer
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_COLUMNTILES_H
+#define BOB_SP_COLUMNTILES_H
+
+#include <algorithm>
+#include "Workspace.h"
+#include "ThreadPool.h"
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief Number of columns of the tiles, for columns of the given length
+   * and elements of the given size (in bytes).
+   *
+   * The wider the tile, the longer the contiguous runs read and written in
+   * each row, and the fewer the TLB misses, while the tile should stay
+   * within the L2 cache. The width is a multiple of align (and at least
+   * align), and does not exceed count rounded up to it.
+   */
+  inline size_t tileWidth(const size_t length, const size_t size,
+    const size_t count, const size_t align)
+  {
+    const size_t budget = 256*1024;
+    size_t width = budget / (length*size) / align * align;
+    if (width < align) width = align;
+    const size_t max = (count + align - 1) / align * align;
+    return std::min(width, max);
+  }
+
+  /**
+   * @brief Hints the processor to fetch the given bytes into the cache
+   */
+  inline void prefetch(const void* data, const size_t bytes)
+  {
+#if defined(__GNUC__)
+    const char* p = static_cast<const char*>(data);
+    for (size_t i=0; i<bytes; i+=64) __builtin_prefetch(p + i);
+#endif
+  }
+
+  /**
+   * @brief Transforms the count columns (of the given length) of a
+   * C-ordered array by tiles of width columns.
+   *
+   * The three steps of a tile are provided by the caller, on a buffer of
+   * size T:
+   *   - gather(buffer, j0, nb, k) copies the values of the row k of the
+   *     columns [j0, j0+nb[ into the buffer,
+   *   - transform(buffer, nb, work) transforms the nb columns of the
+   *     buffer, using a work array of work T,
+   *   - scatter(buffer, j0, nb, k) copies the values of the row k back.
+   *
+   * Each thread processes a range of consecutive tiles with two buffers:
+   * the rows of the next tile are gathered while those of the current one
+   * are scattered back, so that each row (a different page for large
+   * arrays) is visited once for both, and rows are prefetched a few
+   * iterations ahead. src and dst are the first values of the array read by
+   * gather() and written by scatter() (which may be the same), each row
+   * holding stride bytes, and each value size bytes. dst may be null if
+   * scatter() writes elsewhere, in which case it is not prefetched.
+   * Nothing is done if there are no columns.
+   */
+  template <typename T, typename Gather, typename Transform, typename Scatter>
+  void processColumnTiles(const void* src, const void* dst,
+    const size_t stride, const size_t size, const size_t length,
+    const size_t count, const size_t width, const size_t threads,
+    const size_t tile, const size_t work, const Gather& gather,
+    const Transform& transform, const Scatter& scatter)
+  {
+    if (count == 0) return;
+    const size_t distance = 8;
+    const size_t tiles = (count + width - 1) / width;
+    const size_t chunks = std::min(resolveThreads(threads), tiles);
+    const size_t per_chunk = (tiles + chunks - 1) / chunks;
+    const char* s = static_cast<const char*>(src);
+    const char* d = static_cast<const char*>(dst);
+
+    parallelFor(chunks, threads, [&](size_t c) {
+      const size_t t0 = c*per_chunk;
+      const size_t t1 = std::min(tiles, t0 + per_chunk);
+      if (t0 >= t1) return;
+      Workspace<T> ws(2*tile + work);
+      T* cur = ws.data();
+      T* next = cur + tile;
+      T* w = next + tile;
+
+      size_t j0 = t0*width;
+      size_t nb = std::min(width, count - j0);
+      for (size_t k=0; k<length; ++k) {
+        if (k + distance < length)
+          prefetch(s + (k+distance)*stride + j0*size, nb*size);
+        gather(cur, j0, nb, k);
+      }
+      for (size_t t=t0; t<t1; ++t) {
+        transform(cur, nb, w);
+        const size_t j1 = j0 + nb;
+        const size_t nn = (t+1 < t1 ? std::min(width, count - j1) : 0);
+        for (size_t k=0; k<length; ++k) {
+          if (k + distance < length) {
+            if (d) prefetch(d + (k+distance)*stride + j0*size, nb*size);
+            if (nn) prefetch(s + (k+distance)*stride + j1*size, nn*size);
+          }
+          scatter(cur, j0, nb, k);
+          if (nn) gather(next, j1, nn, k);
+        }
+        std::swap(cur, next);
+        j0 = j1;
+        nb = nn;
+      }
+    });
+  }
+
+  /**
+   * @brief Transforms in place the columns of the C-ordered (height, width)
+   * array at data, with op, an in-place 1D transform of blitz::Array<T,1>.
+   *
+   * The columns of a tile are one after the other in the buffer, padded by
+   * 64 bytes against cache set conflicts. Tiles are spread over the given
+   * number of threads.
+   */
+  template <typename T, typename Op>
+  void transformColumns(const Op& op, T* data, const size_t height,
+    const size_t width, const size_t threads)
+  {
+    const size_t n = resolveThreads(threads);
+    const size_t B = tileWidth(height, sizeof(T), (width + n - 1) / n, 1);
+    const size_t ld = height + 64/sizeof(T);
+
+    processColumnTiles<T>(data, data, width*sizeof(T), sizeof(T), height,
+        width, B, threads, B*ld, 0,
+      [&](T* buf, size_t j0, size_t nb, size_t k) {
+        const T* x = data + j0 + k*width;
+        for (size_t l=0; l<nb; ++l) buf[l*ld+k] = x[l];
+      },
+      [&](T* buf, size_t nb, T*) {
+        for (size_t l=0; l<nb; ++l) {
+          blitz::Array<T,1> column(buf + l*ld,
+              blitz::TinyVector<int,1>(height), blitz::neverDeleteData);
+          op(column);
+        }
+      },
+      [&](const T* buf, size_t j0, size_t nb, size_t k) {
+        T* y = data + j0 + k*width;
+        for (size_t l=0; l<nb; ++l) y[l] = buf[l*ld+k];
+      });
+  }
+
+}}}
+
+#endif /* BOB_SP_COLUMNTILES_H */
@@ -28,6 +28,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include "FFT1D.h"
+#include "PrunedFFT1D.h"
 
 
 namespace bob { namespace sp {
@@ -62,18 +63,40 @@ namespace bob { namespace sp {
 
       /**
        * @brief process an array by applying the DCT
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
        */
       virtual void operator()(const blitz::Array<double,1>& src,
           blitz::Array<double,1>& dst) const;
 
+      /**
+       * @brief process an array in-place by applying the DCT: src_dst is
+       * overwritten by its transform. The DCT goes through complex buffers
+       * taken from the per-thread pool (see Workspace), as the out-of-place
+       * one does, which are larger than the signal. This is equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      virtual void operator()(blitz::Array<double,1>& src_dst) const;
+
+      /**
+       * @brief Single precision versions of the above operators
+       */
+      virtual void operator()(const blitz::Array<float,1>& src,
+          blitz::Array<float,1>& dst) const;
+      virtual void operator()(blitz::Array<float,1>& src_dst) const;
+
       /**
        * @brief Getters
+       * getEngine() is the backend of the underlying FFT (see
+       * FFTPlanBase::Engine)
        */
       size_t getLength() const { return m_length; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
       /**
        * @brief Setters
        */
       virtual void setLength(const size_t length);
+      virtual void setEngine(const FFTPlanBase::Engine engine);
 
     protected:
       /**
@@ -96,6 +119,8 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,1>& src,
           blitz::Array<double,1>& dst) const = 0;
+      virtual void processNoCheck(const blitz::Array<float,1>& src,
+          blitz::Array<float,1>& dst) const = 0;
       /**
        * @brief Initialize the normalization factors
        */
@@ -109,6 +134,7 @@ namespace bob { namespace sp {
        * Private attributes
        */
       size_t m_length;
+      FFTPlanBase::Engine m_engine;
       double m_sqrt_1byl;
       double m_sqrt_2byl;
       blitz::Array<std::complex<double>,1> m_working_array;
@@ -151,6 +177,7 @@ namespace bob { namespace sp {
        * @brief Setters
        */
       virtual void setLength(const size_t length);
+      virtual void setEngine(const FFTPlanBase::Engine engine);
 
     private:
       /**
@@ -163,13 +190,21 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,1>& src,
           blitz::Array<double,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<float,1>& src,
+          blitz::Array<float,1>& dst) const;
 
       /**
-       * Private attributes
+       * @brief Implementation of processNoCheck() for both precisions
        */
-      bob::sp::FFT1D m_fft;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_1;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_2;
+      template <typename T>
+      void process(const blitz::Array<T,1>& src,
+          blitz::Array<T,1>& dst) const;
+
+      /**
+       * Private attributes: the FFT of length 2*length of the zero-padded
+       * signal, of which only the first length values are computed
+       */
+      bob::sp::PrunedFFT1D m_fft;
   };
 
 
@@ -209,6 +244,7 @@ namespace bob { namespace sp {
        * @brief Setters
        */
       virtual void setLength(const size_t length);
+      virtual void setEngine(const FFTPlanBase::Engine engine);
 
     private:
       /**
@@ -221,13 +257,20 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,1>& src,
           blitz::Array<double,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<float,1>& src,
+          blitz::Array<float,1>& dst) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<T,1>& src,
+          blitz::Array<T,1>& dst) const;
 
       /**
        * Private attributes
        */
       bob::sp::IFFT1D m_ifft;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_1;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_2;
   };
 
 }}
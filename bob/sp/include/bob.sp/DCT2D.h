@@ -59,15 +59,38 @@ namespace bob { namespace sp {
 
       /**
        * @brief process an array by applying the DCT
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
        */
       virtual void operator()(const blitz::Array<double,2>& src,
           blitz::Array<double,2>& dst) const;
 
+      /**
+       * @brief process an array in-place by applying the DCT: src_dst is
+       * overwritten by its transform, without any temporary of its size.
+       * This is equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      virtual void operator()(blitz::Array<double,2>& src_dst) const;
+
+      /**
+       * @brief Single precision versions of the above operators
+       */
+      virtual void operator()(const blitz::Array<float,2>& src,
+          blitz::Array<float,2>& dst) const;
+      virtual void operator()(blitz::Array<float,2>& src_dst) const;
+
       /**
        * @brief Getters
+       * getThreads() is the number of threads over which the rows, then the
+       * columns, are spread (0 standing for the number of hardware threads)
+       * getEngine() is the backend of the 1D transforms (see
+       * FFTPlanBase::Engine)
        */
       size_t getHeight() const { return m_height; }
       size_t getWidth() const { return m_width; }
+      size_t getThreads() const { return m_threads; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
 
       /**
        * @brief Setters
@@ -75,6 +98,8 @@ namespace bob { namespace sp {
       virtual void setHeight(const size_t height);
       virtual void setWidth(const size_t width);
       virtual void setShape(const size_t height, const size_t width);
+      void setThreads(const size_t threads) { m_threads = threads; }
+      virtual void setEngine(const FFTPlanBase::Engine engine);
 
     protected:
       /**
@@ -97,15 +122,16 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,2>& src,
           blitz::Array<double,2>& dst) const = 0;
+      virtual void processNoCheck(const blitz::Array<float,2>& src,
+          blitz::Array<float,2>& dst) const = 0;
 
       /**
        * Private attributes
        */
       size_t m_height;
       size_t m_width;
-      mutable blitz::Array<double,2> m_buffer_hw;
-      mutable blitz::Array<double,1> m_buffer_h;
-      mutable blitz::Array<double,1> m_buffer_h2;
+      size_t m_threads;
+      FFTPlanBase::Engine m_engine;
   };
 
 
@@ -147,6 +173,7 @@ namespace bob { namespace sp {
       void setHeight(const size_t height);
       void setWidth(const size_t width);
       void setShape(const size_t height, const size_t width);
+      void setEngine(const FFTPlanBase::Engine engine);
 
     private:
       /**
@@ -154,6 +181,15 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,2>& src,
           blitz::Array<double,2>& dst) const;
+      virtual void processNoCheck(const blitz::Array<float,2>& src,
+          blitz::Array<float,2>& dst) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<T,2>& src,
+          blitz::Array<T,2>& dst) const;
 
       /**
        * @brief DCT1D instances
@@ -201,6 +237,7 @@ namespace bob { namespace sp {
       void setHeight(const size_t height);
       void setWidth(const size_t width);
       void setShape(const size_t height, const size_t width);
+      void setEngine(const FFTPlanBase::Engine engine);
 
     private:
       /**
@@ -208,6 +245,15 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<double,2>& src,
           blitz::Array<double,2>& dst) const;
+      virtual void processNoCheck(const blitz::Array<float,2>& src,
+          blitz::Array<float,2>& dst) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<T,2>& src,
+          blitz::Array<T,2>& dst) const;
 
       /**
        * @brief IDCT1D instances
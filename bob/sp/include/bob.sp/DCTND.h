@@ -0,0 +1,270 @@
+/**
+ * @date Fri Oct 16 21:52:08 CEST 2026
+ *
+ * @brief N-dimensional Discrete Cosine Transforms, computed as a sequence of
+ * 1D transforms, one per dimension
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_DCTND_H
+#define BOB_SP_DCTND_H
+
+#include <vector>
+#include <blitz/array.h>
+#include <bob.core/assert.h>
+#include "DCT1D.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a N-dimensional Discrete Cosine Transform
+   * using DCT1D implementations. It is used as a base class for DCTND and
+   * IDCTND classes.
+   *
+   * Arrays of any rank (the number of dimensions of the shape) are
+   * supported. The last (contiguous) dimension is transformed first, one
+   * row at a time, then each other dimension in place, from the last to the
+   * first one, by tiles of columns of the C-ordered 2D arrays found at each
+   * index along the preceding dimensions.
+   */
+  class DCTNDAbstract
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~DCTNDAbstract();
+
+      /**
+       * @brief Assignment operator
+       */
+      DCTNDAbstract& operator=(const DCTNDAbstract& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const DCTNDAbstract& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const DCTNDAbstract& other) const;
+
+      /**
+       * @brief process an array by applying the DCT, in double or single
+       * precision. The rank N of the arrays should be the one of the shape.
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      template <typename T, int N>
+      void operator()(const blitz::Array<T,N>& src,
+          blitz::Array<T,N>& dst) const
+      {
+        bob::core::array::assertCZeroBaseContiguous(src);
+        checkShape(src.shape().data(), N);
+        bob::core::array::assertCZeroBaseContiguous(dst);
+        bob::core::array::assertSameShape(dst, src);
+        processNoCheck(src.data(), dst.data());
+      }
+
+      /**
+       * @brief process an array in-place by applying the DCT: src_dst is
+       * overwritten by its transform, without any temporary of its size.
+       * This is equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      template <typename T, int N>
+      void operator()(blitz::Array<T,N>& src_dst) const
+      {
+        bob::core::array::assertCZeroBaseContiguous(src_dst);
+        checkShape(src_dst.shape().data(), N);
+        processNoCheck(src_dst.data(), src_dst.data());
+      }
+
+      /**
+       * @brief Getters
+       * getThreads() is the number of threads over which each dimension is
+       * transformed (0 standing for the number of hardware threads)
+       * getEngine() is the backend of the 1D transforms (see
+       * FFTPlanBase::Engine)
+       */
+      const std::vector<size_t>& getShape() const { return m_shape; }
+      size_t getRank() const { return m_shape.size(); }
+      size_t getThreads() const { return m_threads; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+
+      /**
+       * @brief Setters
+       */
+      virtual void setShape(const std::vector<size_t>& shape);
+      void setThreads(const size_t threads) { m_threads = threads; }
+      virtual void setEngine(const FFTPlanBase::Engine engine);
+
+    protected:
+      /**
+       * @brief Constructor
+       */
+      DCTNDAbstract();
+
+      /**
+       * @brief Constructor
+       */
+      DCTNDAbstract(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      DCTNDAbstract(const DCTNDAbstract& other);
+
+      /**
+       * @brief Checks that the given extents match the shape
+       */
+      void checkShape(const int* extents, const int rank) const;
+
+      /**
+       * @brief process C-ordered data of the current shape, assuming that
+       * all the 'check' are done
+       */
+      virtual void processNoCheck(const double* src,
+          double* dst) const = 0;
+      virtual void processNoCheck(const float* src,
+          float* dst) const = 0;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions and
+       * directions, given the 1D transforms of each dimension
+       */
+      template <typename T, typename F>
+      void process(const std::vector<F>& dcts, const T* src, T* dst) const;
+
+      /**
+       * Private attributes
+       */
+      std::vector<size_t> m_shape;
+      size_t m_threads;
+      FFTPlanBase::Engine m_engine;
+  };
+
+
+  /**
+   * @brief This class implements a direct N-dimensional Discrete Cosine
+   * Transform using DCT1D implementations.
+   */
+  class DCTND: public DCTNDAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      DCTND();
+
+      /**
+       * @brief Constructor
+       */
+      DCTND(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      DCTND(const DCTND& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~DCTND();
+
+      /**
+       * @brief Assignment operator
+       */
+      DCTND& operator=(const DCTND& other);
+
+      /**
+       * @brief Setters
+       */
+      void setShape(const std::vector<size_t>& shape);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const double* src,
+          double* dst) const;
+      virtual void processNoCheck(const float* src,
+          float* dst) const;
+
+      /**
+       * @brief Resets the DCT1D instances, one per dimension
+       */
+      void initDCTs();
+
+      /**
+       * @brief DCT1D instances
+       */
+      std::vector<bob::sp::DCT1D> m_dct;
+  };
+
+
+  /**
+   * @brief This class implements an inverse N-dimensional Discrete Cosine
+   * Transform using IDCT1D implementations.
+   */
+  class IDCTND: public DCTNDAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      IDCTND();
+
+      /**
+       * @brief Constructor
+       */
+      IDCTND(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      IDCTND(const IDCTND& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~IDCTND();
+
+      /**
+       * @brief Assignment operator
+       */
+      IDCTND& operator=(const IDCTND& other);
+
+      /**
+       * @brief Setters
+       */
+      void setShape(const std::vector<size_t>& shape);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const double* src,
+          double* dst) const;
+      virtual void processNoCheck(const float* src,
+          float* dst) const;
+
+      /**
+       * @brief Resets the IDCT1D instances, one per dimension
+       */
+      void initDCTs();
+
+      /**
+       * @brief IDCT1D instances
+       */
+      std::vector<bob::sp::IDCT1D> m_idct;
+  };
+
+}}
+
+#endif /* BOB_SP_DCTND_H */
@@ -24,9 +24,11 @@
 #define BOB_SP_FFT1D_H
 
 #include <complex>
+#include <vector>
 #include <blitz/array.h>
 #include <boost/shared_ptr.hpp>
-#include "fftpack.h"
+#include "FFTPlan.h"
+#include "FourStepFFT.h"
 
 
 namespace bob { namespace sp {
@@ -61,18 +63,73 @@ namespace bob { namespace sp {
 
       /**
        * @brief process an array by applying the FFT
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
        */
       virtual void operator()(const blitz::Array<std::complex<double>,1>& src,
           blitz::Array<std::complex<double>,1>& dst) const;
 
+      /**
+       * @brief process an array in-place by applying the FFT: src_dst is
+       * overwritten by its transform, without a copy of it. The plans still
+       * take their working array from the per-thread pool (see Workspace):
+       * the size of the signal for fftpack and the Stockham engine, more
+       * for the lengths computed with Bluestein's algorithm. This is
+       * equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      virtual void operator()(blitz::Array<std::complex<double>,1>& src_dst) const;
+
+      /**
+       * @brief Single precision versions of the above operators. They use
+       * the single precision build of fftpack (and plans), which halves the
+       * memory traffic.
+       */
+      virtual void operator()(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+      virtual void operator()(blitz::Array<std::complex<float>,1>& src_dst) const;
+
+      /**
+       * @brief process a batch of signals by applying the FFT along the
+       * given axis of src: to each of its rows (axis 1) or to each of its
+       * columns (axis 0), which must have the length of this transform.
+       * All the signals are transformed with the same plan, several at once
+       * in the same vector registers (see FFTBatchPlan), and are spread
+       * over getThreads() threads. src and dst may refer to the same data,
+       * but should not partially overlap. An empty batch (no row, or no
+       * column) is a no-op.
+       */
+      virtual void operator()(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<std::complex<double>,2>& dst, const int axis=1) const;
+      virtual void operator()(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst, const int axis=1) const;
+
       /**
        * @brief Getters
+       * getThreads() is the number of threads used by the batched
+       * transforms (0 standing for the number of hardware threads). When 3
+       * of them at least may run in parallel (on as many hardware threads),
+       * the transforms of the single signals too large for the caches are
+       * also spread over the threads, with the four-step algorithm (see
+       * FourStepFFT), if their length has balanced factors. It is slower
+       * than the plans of the whole length on fewer threads.
+       * getEngine() is the backend computing the transforms of one signal
+       * (see FFTPlanBase::Engine). getCentered() tells if the spectra are
+       * centered: the direct transforms then give the output of fftshift(),
+       * with the zero frequency at index N/2, and the inverse transforms
+       * expect such a spectrum (undoing the shift as ifftshift()).
        */
       size_t getLength() const { return m_length; }
+      size_t getThreads() const { return m_threads; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+      bool getCentered() const { return m_centered; }
       /**
        * @brief Setters
        */
       virtual void setLength(const size_t length);
+      void setThreads(const size_t threads) { m_threads = threads; }
+      void setEngine(const FFTPlanBase::Engine engine);
+      void setCentered(const bool centered);
 
     protected:
       /**
@@ -95,17 +152,46 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,1>& src,
           blitz::Array<std::complex<double>,1>& dst) const = 0;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const = 0;
+      virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<std::complex<double>,2>& dst, const int axis) const = 0;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst, const int axis) const = 0;
+
       /**
-       * @brief Initialize working array
+       * @brief Implementation of the batched processNoCheck() for both
+       * precisions and directions. The inverse transforms are normalized.
+       */
+      template <typename T>
+      void processBatch(const blitz::Array<std::complex<T>,2>& src,
+          blitz::Array<std::complex<T>,2>& dst, const int axis,
+          const bool inverse) const;
+
+      /**
+       * @brief Initialize working array, fetching the (shared) plan for the
+       * current length
        */
       virtual void initWorkingArray();
 
       /**
-       * Private attributes
+       * Private attributes. When the spectra are centered, m_modulation
+       * holds the factors u_n = exp(-2*i*pi*n*floor(N/2)/N): multiplying the
+       * signal by their conjugates shifts its spectrum as fftshift(), and
+       * multiplying the output of the inverse transform by them undoes the
+       * shift of its input. The shift is fused with the copies of the
+       * signals, or applied to each signal right after its transform (while
+       * it is in cache), instead of being a pass of its own over the array.
+       * m_four_step is set for the lengths decomposed by FourStepFFT, unless
+       * the engine is FFTW (whose plans already handle the huge lengths).
        */
       size_t m_length;
-      blitz::Array<double,1> m_wsave;
-      mutable blitz::Array<double,1> m_buffer;
+      size_t m_threads;
+      FFTPlanBase::Engine m_engine;
+      bool m_centered;
+      std::vector<std::complex<double> > m_modulation;
+      bob::sp::detail::FFTPlans m_plans;
+      boost::shared_ptr<const bob::sp::detail::FourStepFFT> m_four_step;
   };
 
 
@@ -152,6 +238,19 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,1>& src,
           blitz::Array<std::complex<double>,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<std::complex<double>,2>& dst, const int axis) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst, const int axis) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,1>& src,
+          blitz::Array<std::complex<T>,1>& dst) const;
   };
 
 
@@ -198,6 +297,19 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,1>& src,
           blitz::Array<std::complex<double>,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<std::complex<double>,2>& dst, const int axis) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst, const int axis) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,1>& src,
+          blitz::Array<std::complex<T>,1>& dst) const;
   };
 
 }}
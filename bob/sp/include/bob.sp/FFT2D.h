@@ -59,15 +59,42 @@ namespace bob { namespace sp {
 
       /**
        * @brief process an array by applying the FFT
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
        */
       virtual void operator()(const blitz::Array<std::complex<double>,2>& src,
           blitz::Array<std::complex<double>,2>& dst) const;
 
+      /**
+       * @brief process an array in-place by applying the FFT: src_dst is
+       * overwritten by its transform, without any temporary of its size.
+       * This is equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      virtual void operator()(blitz::Array<std::complex<double>,2>& src_dst) const;
+
+      /**
+       * @brief Single precision versions of the above operators
+       */
+      virtual void operator()(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+      virtual void operator()(blitz::Array<std::complex<float>,2>& src_dst) const;
+
       /**
        * @brief Getters
+       * getThreads() is the number of threads over which the rows, then the
+       * columns, are spread (0 standing for the number of hardware threads)
+       * getEngine() is the backend of the 1D transforms (see
+       * FFTPlanBase::Engine). getCentered() tells if the spectra are
+       * centered along both dimensions: the direct transform then gives the
+       * output of fftshift(), and the inverse one expects it (see
+       * FFT1DAbstract::getCentered()).
        */
       size_t getHeight() const { return m_height; }
       size_t getWidth() const { return m_width; }
+      size_t getThreads() const { return m_threads; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+      bool getCentered() const { return m_centered; }
 
       /**
        * @brief Setters
@@ -75,6 +102,9 @@ namespace bob { namespace sp {
       virtual void setHeight(const size_t height);
       virtual void setWidth(const size_t width);
       virtual void setShape(const size_t height, const size_t width);
+      virtual void setThreads(const size_t threads);
+      virtual void setEngine(const FFTPlanBase::Engine engine);
+      virtual void setCentered(const bool centered);
 
     protected:
       /**
@@ -97,15 +127,17 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
           blitz::Array<std::complex<double>,2>& dst) const = 0;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const = 0;
 
       /**
        * Private attributes
        */
       size_t m_height;
       size_t m_width;
-      mutable blitz::Array<std::complex<double>,2> m_buffer_hw;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_h;
-      mutable blitz::Array<std::complex<double>,1> m_buffer_h2;
+      size_t m_threads;
+      FFTPlanBase::Engine m_engine;
+      bool m_centered;
   };
 
 
@@ -147,6 +179,9 @@ namespace bob { namespace sp {
       void setHeight(const size_t height);
       void setWidth(const size_t width);
       void setShape(const size_t height, const size_t width);
+      void setThreads(const size_t threads);
+      void setEngine(const FFTPlanBase::Engine engine);
+      void setCentered(const bool centered);
 
     private:
       /**
@@ -154,6 +189,15 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
           blitz::Array<std::complex<double>,2>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,2>& src,
+          blitz::Array<std::complex<T>,2>& dst) const;
 
       /**
        * @brief FFT1D instances
@@ -201,6 +245,9 @@ namespace bob { namespace sp {
       void setHeight(const size_t height);
       void setWidth(const size_t width);
       void setShape(const size_t height, const size_t width);
+      void setThreads(const size_t threads);
+      void setEngine(const FFTPlanBase::Engine engine);
+      void setCentered(const bool centered);
 
     private:
       /**
@@ -208,6 +255,15 @@ namespace bob { namespace sp {
        */
       virtual void processNoCheck(const blitz::Array<std::complex<double>,2>& src,
           blitz::Array<std::complex<double>,2>& dst) const;
+      virtual void processNoCheck(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,2>& src,
+          blitz::Array<std::complex<T>,2>& dst) const;
 
       /**
        * @brief IFFT1D instances
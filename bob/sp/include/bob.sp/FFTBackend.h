@@ -0,0 +1,121 @@
+/**
+ * @date Sat Oct 17 09:41:06 CEST 2026
+ *
+ * @brief Interface of the libraries (backends) computing the 1D Fast
+ * Fourier Transforms of a plan, the optional FFTW3 backend and the measured
+ * (tuned) one
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FFTBACKEND_H
+#define BOB_SP_FFTBACKEND_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief This class computes the (unnormalized) 1D FFTs of a given length
+   * and kind, on arrays of T (double or float). The backends are built by
+   * the plans (see BasicFFTPlan), and never change afterwards: forward()
+   * and backward() may be called by several threads at the same time.
+   */
+  template <typename T>
+  class FFTBackend
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~FFTBackend() {}
+
+      /**
+       * @brief Number of T required by the work array passed to forward()
+       * and backward()
+       */
+      virtual size_t getWorkSize() const = 0;
+
+      /**
+       * @brief Computes the direct (unnormalized) FFT, in-place, with the
+       * layout described in BasicFFTPlan
+       */
+      virtual void forward(T* data, T* work) const = 0;
+
+      /**
+       * @brief Computes the inverse (unnormalized) FFT, in-place, with the
+       * layout described in BasicFFTPlan
+       */
+      virtual void backward(T* data, T* work) const = 0;
+  };
+
+  /**
+   * @brief Returns a new fftpack backend computing the complex FFTs of the
+   * given length, whose radix passes are run in the order of the given
+   * factors (at most FFTPACK_MAX_FACTORS, whose product is the length), or
+   * in the default order if factors is empty. Throws if the factors are not
+   * valid.
+   */
+  template <typename T>
+  FFTBackend<T>* newFftpackBackend(const size_t length,
+    const std::vector<int>& factors=std::vector<int>());
+
+  /**
+   * @brief Returns a new backend computing the complex FFTs of the given
+   * length with a codelet: a straight-line transform, whose loops are
+   * unrolled and whose twiddle factors are constants, generated at compile
+   * time (see FFTCodelets.cpp). Returns 0 if there is no codelet for the
+   * length: they cover the lengths up to 64 whose factors are 2, 3 and 5.
+   */
+  template <typename T>
+  FFTBackend<T>* newCodeletBackend(const size_t length);
+
+  /**
+   * @brief Returns a new backend computing the complex FFTs of the given
+   * length with the fastest of the fftpack factor orders and of the
+   * Stockham engine (see FFTTuner.cpp). The candidates are timed the first
+   * time a length is requested in a given precision, unless its choice was
+   * imported with importFFTTuning(): the choices are then kept for the
+   * lifetime of the process.
+   */
+  template <typename T>
+  FFTBackend<T>* newTunedBackend(const size_t length);
+
+  /**
+   * @brief Merges the choices of the tuned backends (of both precisions)
+   * stored in the given file into the current ones, or saves the current
+   * ones to the given file. Throws if the file cannot be read or written,
+   * or is not valid.
+   */
+  void importFFTTuning(const std::string& filename);
+  void exportFFTTuning(const std::string& filename);
+
+  /**
+   * @brief Tells if the library was compiled with the FFTW3 backend
+   * (BOB_SP_HAVE_FFTW3)
+   */
+  bool hasFFTW();
+
+  /**
+   * @brief Returns a new FFTW3 backend computing the complex FFTs of the
+   * given length. The FFTW plans are measured (FFTW_MEASURE), unless the
+   * wisdom already knows them. Throws if FFTW3 is not available.
+   */
+  template <typename T>
+  FFTBackend<T>* newFFTWBackend(const size_t length);
+
+  /**
+   * @brief Merges the FFTW wisdom (of both precisions) stored in the given
+   * file into the current one, or saves the current one to the given file.
+   * Throws if FFTW3 is not available, or if the file cannot be read or
+   * written.
+   */
+  void importFFTWWisdom(const std::string& filename);
+  void exportFFTWWisdom(const std::string& filename);
+
+}}}
+
+#endif /* BOB_SP_FFTBACKEND_H */
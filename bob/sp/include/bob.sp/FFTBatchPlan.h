@@ -0,0 +1,135 @@
+/**
+ * @date Fri Oct 16 18:12:36 CEST 2026
+ *
+ * @brief Immutable, process-wide shared plans for batched 1D complex Fast
+ * Fourier Transforms, which transform several signals at once
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FFTBATCHPLAN_H
+#define BOB_SP_FFTBATCHPLAN_H
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class holds the factorization and the twiddle factors of
+   * a batched complex 1D FFT of a given length, on arrays of T (double or
+   * float).
+   *
+   * A batch is made of getLanes() signals (64 bytes worth of T), stored in
+   * split format: the real and imaginary parts of the k-th value of the
+   * signal l are at index k*getLanes()+l of two separate arrays. Each
+   * vector register hence holds values of several signals, and the
+   * transform is a sequence of (Stockham, self-sorting) radix passes which
+   * are vectorized whatever the length and the factors.
+   *
+   * Batches are only faster than fftpack transforms of one signal at a
+   * time as long as they fit in the L1 cache, i.e. up to 192 values. Like
+   * the fftpack plans, the generic radix pass is quadratic in the factor:
+   * lengths for which FFTPlanBase::useBluestein() is true are not
+   * supported either. Other lengths should be transformed one signal at a
+   * time.
+   *
+   * Plans never change once created, and are obtained through get(), which
+   * looks them up in a process-wide cache indexed by length.
+   */
+  template <typename T>
+  class BasicFFTBatchPlan
+  {
+    public:
+      /**
+       * @brief Returns the (shared) plan for the given length, creating it
+       * if required
+       */
+      static boost::shared_ptr<const BasicFFTBatchPlan> get(const size_t length);
+
+      /**
+       * @brief Tells if batched transforms of the given length are
+       * supported
+       */
+      static bool isSupported(const size_t length);
+
+      /**
+       * @brief Number of signals in a batch
+       */
+      static size_t getLanes() { return 64 / sizeof(T); }
+
+      /**
+       * @brief Destructor
+       */
+      ~BasicFFTBatchPlan();
+
+      /**
+       * @brief Getters
+       */
+      size_t getLength() const { return m_length; }
+      /**
+       * @brief Number of T required by the work array passed to forward()
+       * and backward()
+       */
+      size_t getWorkSize() const { return 2*getLanes()*m_length; }
+
+      /**
+       * @brief Computes the direct (unnormalized) FFTs of a batch, in-place
+       */
+      void forward(T* re, T* im, T* work) const;
+
+      /**
+       * @brief Computes the inverse (unnormalized) FFTs of a batch, in-place
+       */
+      void backward(T* re, T* im, T* work) const;
+
+    private:
+      /**
+       * @brief Constructor: use get() instead
+       */
+      BasicFFTBatchPlan(const size_t length);
+
+      /**
+       * @brief Disabled copy constructor and assignment operator
+       */
+      BasicFFTBatchPlan(const BasicFFTBatchPlan& other);
+      BasicFFTBatchPlan& operator=(const BasicFFTBatchPlan& other);
+
+      /**
+       * @brief Runs all the passes, isign being -1 (direct) or +1 (inverse)
+       */
+      void transform(T* re, T* im, T* work, const int isign) const;
+
+      /**
+       * @brief A radix pass, and the offsets of its twiddle factors and
+       * roots of unity
+       */
+      struct Pass {
+        size_t radix;
+        size_t m;
+        size_t twiddles;
+        size_t roots;
+      };
+
+      /**
+       * Private attributes
+       */
+      size_t m_length;
+      std::vector<Pass> m_passes;
+      std::vector<T> m_twr;
+      std::vector<T> m_twi;
+      std::vector<T> m_rootr;
+      std::vector<T> m_rooti;
+  };
+
+  /**
+   * @brief Double and single precision batch plans
+   */
+  typedef BasicFFTBatchPlan<double> FFTBatchPlan;
+  typedef BasicFFTBatchPlan<float> FFTBatchPlanFloat;
+
+}}
+
+#endif /* BOB_SP_FFTBATCHPLAN_H */
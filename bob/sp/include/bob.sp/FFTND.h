@@ -0,0 +1,274 @@
+/**
+ * @date Fri Oct 16 21:14:52 CEST 2026
+ *
+ * @brief N-dimensional Fast Fourier Transforms, computed as a sequence of
+ * batched 1D transforms, one per dimension
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FFTND_H
+#define BOB_SP_FFTND_H
+
+#include <complex>
+#include <vector>
+#include <blitz/array.h>
+#include <bob.core/assert.h>
+#include "FFT1D.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a N-dimensional Discrete Fourier Transform
+   * using FFT1D implementations. It is used as a base class for FFTND and
+   * IFFTND classes.
+   *
+   * Arrays of any rank (the number of dimensions of the shape) are
+   * supported. The last (contiguous) dimension is transformed first, as a
+   * batch of rows, then each other dimension in place, from the last to the
+   * first one, by tiles of columns of the C-ordered 2D arrays found at each
+   * index along the preceding dimensions.
+   */
+  class FFTNDAbstract
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~FFTNDAbstract();
+
+      /**
+       * @brief Assignment operator
+       */
+      FFTNDAbstract& operator=(const FFTNDAbstract& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const FFTNDAbstract& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const FFTNDAbstract& other) const;
+
+      /**
+       * @brief process an array by applying the FFT, in double or single
+       * precision. The rank N of the arrays should be the one of the shape.
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      template <typename T, int N>
+      void operator()(const blitz::Array<std::complex<T>,N>& src,
+          blitz::Array<std::complex<T>,N>& dst) const
+      {
+        bob::core::array::assertCZeroBaseContiguous(src);
+        checkShape(src.shape().data(), N);
+        bob::core::array::assertCZeroBaseContiguous(dst);
+        bob::core::array::assertSameShape(dst, src);
+        processNoCheck(src.data(), dst.data());
+      }
+
+      /**
+       * @brief process an array in-place by applying the FFT: src_dst is
+       * overwritten by its transform, without any temporary of its size.
+       * This is equivalent to calling operator()(src_dst, src_dst): src and
+       * dst may refer to the same data, but should not partially overlap.
+       */
+      template <typename T, int N>
+      void operator()(blitz::Array<std::complex<T>,N>& src_dst) const
+      {
+        bob::core::array::assertCZeroBaseContiguous(src_dst);
+        checkShape(src_dst.shape().data(), N);
+        processNoCheck(src_dst.data(), src_dst.data());
+      }
+
+      /**
+       * @brief Getters
+       * getThreads() is the number of threads over which each dimension is
+       * transformed (0 standing for the number of hardware threads)
+       * getEngine() is the backend of the 1D transforms (see
+       * FFTPlanBase::Engine)
+       */
+      const std::vector<size_t>& getShape() const { return m_shape; }
+      size_t getRank() const { return m_shape.size(); }
+      size_t getThreads() const { return m_threads; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+
+      /**
+       * @brief Setters
+       */
+      virtual void setShape(const std::vector<size_t>& shape);
+      virtual void setThreads(const size_t threads);
+      virtual void setEngine(const FFTPlanBase::Engine engine);
+
+    protected:
+      /**
+       * @brief Constructor
+       */
+      FFTNDAbstract();
+
+      /**
+       * @brief Constructor
+       */
+      FFTNDAbstract(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      FFTNDAbstract(const FFTNDAbstract& other);
+
+      /**
+       * @brief Checks that the given extents match the shape
+       */
+      void checkShape(const int* extents, const int rank) const;
+
+      /**
+       * @brief process C-ordered data of the current shape, assuming that
+       * all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const = 0;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const = 0;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions and
+       * directions, given the 1D transforms of each dimension
+       */
+      template <typename T, typename F>
+      void process(const std::vector<F>& ffts, const std::complex<T>* src,
+          std::complex<T>* dst) const;
+
+      /**
+       * Private attributes
+       */
+      std::vector<size_t> m_shape;
+      size_t m_threads;
+      FFTPlanBase::Engine m_engine;
+  };
+
+
+  /**
+   * @brief This class implements a direct N-dimensional Discrete Fourier
+   * Transform using FFT1D implementations.
+   */
+  class FFTND: public FFTNDAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      FFTND();
+
+      /**
+       * @brief Constructor
+       */
+      FFTND(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      FFTND(const FFTND& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~FFTND();
+
+      /**
+       * @brief Assignment operator
+       */
+      FFTND& operator=(const FFTND& other);
+
+      /**
+       * @brief Setters
+       */
+      void setShape(const std::vector<size_t>& shape);
+      void setThreads(const size_t threads);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const;
+
+      /**
+       * @brief Resets the FFT1D instances, one per dimension
+       */
+      void initFFTs();
+
+      /**
+       * @brief FFT1D instances
+       */
+      std::vector<bob::sp::FFT1D> m_fft;
+  };
+
+
+  /**
+   * @brief This class implements an inverse N-dimensional Discrete Fourier
+   * Transform using IFFT1D implementations.
+   */
+  class IFFTND: public FFTNDAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      IFFTND();
+
+      /**
+       * @brief Constructor
+       */
+      IFFTND(const std::vector<size_t>& shape);
+
+      /**
+       * @brief Copy constructor
+       */
+      IFFTND(const IFFTND& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~IFFTND();
+
+      /**
+       * @brief Assignment operator
+       */
+      IFFTND& operator=(const IFFTND& other);
+
+      /**
+       * @brief Setters
+       */
+      void setShape(const std::vector<size_t>& shape);
+      void setThreads(const size_t threads);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const;
+
+      /**
+       * @brief Resets the IFFT1D instances, one per dimension
+       */
+      void initFFTs();
+
+      /**
+       * @brief IFFT1D instances
+       */
+      std::vector<bob::sp::IFFT1D> m_ifft;
+  };
+
+}}
+
+#endif /* BOB_SP_FFTND_H */
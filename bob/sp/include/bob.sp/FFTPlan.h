@@ -0,0 +1,315 @@
+/**
+ * @date Fri Oct 16 09:12:41 CEST 2026
+ *
+ * @brief Immutable, process-wide shared plans (twiddle factors and
+ * factorization) for the fftpack based 1D Fast Fourier Transforms, in
+ * double and single precision
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FFTPLAN_H
+#define BOB_SP_FFTPLAN_H
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include "FFTBackend.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief Properties of the plans which do not depend on their floating
+   * point precision
+   */
+  class FFTPlanBase
+  {
+    public:
+      /**
+       * @brief The kind of input the plan is designed for
+       */
+      typedef enum Kind_ {
+        Complex,
+        Real
+      } Kind;
+
+      /**
+       * @brief The backend computing the complex transforms of the plan:
+       * the radix passes of fftpack, the Stockham autosort passes of
+       * StockhamFFT, FFTW3, if the library was compiled with it
+       * (BOB_SP_HAVE_FFTW3), or the fastest of the fftpack factor orders
+       * and of the Stockham engine, measured when the plan is first
+       * created (Tuned). Real plans always use fftpack.
+       */
+      typedef enum Engine_ {
+        Fftpack,
+        Stockham,
+        Fftw,
+        Tuned
+      } Engine;
+
+      /**
+       * @brief Tells if the given engine was compiled in the library
+       */
+      static bool isAvailable(const Engine engine);
+
+      /**
+       * @brief Merges the measurements of the Tuned plans saved by
+       * exportTuning() (possibly by another process) into the current ones,
+       * so that the plans they cover are created without being measured
+       * again. Plans which are already alive are not affected. Throws if
+       * the file cannot be read, or is not valid.
+       */
+      static void importTuning(const std::string& filename);
+
+      /**
+       * @brief Saves the measurements of the Tuned plans created so far
+       * (and the imported ones) to the given file
+       */
+      static void exportTuning(const std::string& filename);
+
+      /**
+       * @brief Merges the FFTW wisdom saved by exportWisdom() (possibly by
+       * another process) into the current one, so that the plans it knows
+       * are created without being measured again. Throws if FFTW3 is not
+       * available, or if the file cannot be read.
+       */
+      static void importWisdom(const std::string& filename);
+
+      /**
+       * @brief Saves the FFTW wisdom gathered by the Fftw plans created so
+       * far (and the imported one) to the given file
+       */
+      static void exportWisdom(const std::string& filename);
+
+      /**
+       * @brief Smallest length >= n which only has 2, 3 and 5 as prime
+       * factors, for which the transforms only use the specialized passes
+       */
+      static size_t nextSmoothLength(const size_t n);
+
+      /**
+       * @brief Length >= n to which the signals of FFT-based computations
+       * (convolutions, chirp-z transforms...) should be zero padded: a
+       * product of 2, 3, 5 and 7 which is the cheapest to transform with the
+       * given engine. FFTW has codelets for all of them, hence gets the
+       * smallest one. The other engines have no radix 7 pass, and get the
+       * length of least estimated cost, which may be larger.
+       */
+      static size_t nextFastLength(const size_t n,
+          const Engine engine=Fftpack);
+
+      /**
+       * @brief Tells if the Bluestein algorithm is faster than a direct
+       * fftpack transform for the given length
+       */
+      static bool useBluestein(const size_t length);
+  };
+
+  /**
+   * @brief This class holds the twiddle factors and the factorization
+   * required by fftpack (or by another engine) to compute a complex or a
+   * real 1D FFT of a given length, on arrays of T (double or float).
+   *
+   * A plan never changes once created, so that it can be used by several
+   * transforms (and threads) at the same time. Plans are obtained through
+   * get(), which looks them up in a process-wide cache indexed by kind,
+   * engine and length: a plan lives as long as at least one transform
+   * refers to it.
+   *
+   * The transforms are computed by a backend (see detail::FFTBackend)
+   * selected by the engine of the plan. Complex plans use fftpack, the
+   * Stockham engine, which does not need any bit reversal or reordering
+   * pass, and whose speed relative to fftpack depends on the length and on
+   * the machine, or FFTW3. fftpack and the Stockham engine only have
+   * specialized passes for the factors 2, 3, 4 and 5, the generic one being
+   * quadratic in the factor. Their lengths with large prime factors are
+   * hence computed with the Bluestein (chirp-z) algorithm, which expresses
+   * the transform as a circular convolution of a (2, 3, 5 smooth) length
+   * m >= 2*length-1, computed with three FFTs.
+   *
+   * The complex fftpack and Tuned plans of the small lengths whose factors
+   * are 2, 3 and 5 (up to 64, see detail::newCodeletBackend()) use
+   * codelets instead: fully unrolled transforms with constant twiddle
+   * factors, generated at compile time, which do not pay the dispatch of
+   * the radix passes and their loops.
+   *
+   * Tuned plans time the fftpack passes in several orders of the factors of
+   * the length, and the Stockham engine, when a length is first planned in
+   * a given precision, and keep the fastest. The measurements are shared by
+   * the process, and may be saved and restored with exportTuning() and
+   * importTuning(). As the timings depend on the machine and on its load,
+   * two processes may choose different backends.
+   *
+   * Single precision plans are computed with the same algorithms, their
+   * twiddle factors being computed in double precision.
+   */
+  template <typename T>
+  class BasicFFTPlan: public FFTPlanBase
+  {
+    public:
+      /**
+       * @brief Returns the (shared) plan for the given length, kind and
+       * engine, creating it if required. Throws if the engine is not
+       * available.
+       */
+      static boost::shared_ptr<const BasicFFTPlan> get(const size_t length,
+        const Kind kind=Complex, const Engine engine=Fftpack);
+
+      /**
+       * @brief Returns the number of plans currently alive in the cache
+       */
+      static size_t getCacheSize();
+
+      /**
+       * @brief Destructor
+       */
+      ~BasicFFTPlan();
+
+      /**
+       * @brief Getters
+       */
+      size_t getLength() const { return m_length; }
+      Kind getKind() const { return m_kind; }
+      Engine getEngine() const { return m_engine; }
+      bool isBluestein() const { return m_bluestein; }
+      /**
+       * @brief Number of T required by the work array passed to forward()
+       * and backward()
+       */
+      size_t getWorkSize() const;
+
+      /**
+       * @brief Computes the direct (unnormalized) FFT, in-place.
+       * For a Complex plan, data is an interleaved complex array (2*length
+       * values). For a Real plan, data holds length real values, which
+       * are replaced by the non-redundant half of the spectrum in the
+       * fftpack halfcomplex order: r0, re1, im1, re2, im2, ... (the last
+       * value being re(length/2) if length is even).
+       */
+      void forward(T* data, T* work) const;
+
+      /**
+       * @brief Computes the inverse (unnormalized) FFT, in-place. The
+       * layout of data is the one of forward(), with input and output
+       * swapped.
+       */
+      void backward(T* data, T* work) const;
+
+    private:
+      /**
+       * @brief Constructor: use get() instead
+       */
+      BasicFFTPlan(const size_t length, const Kind kind, const Engine engine);
+
+      /**
+       * @brief Disabled copy constructor and assignment operator
+       */
+      BasicFFTPlan(const BasicFFTPlan& other);
+      BasicFFTPlan& operator=(const BasicFFTPlan& other);
+
+      /**
+       * @brief Bluestein algorithm: initialization, and (direct or inverse)
+       * complex and real transforms
+       */
+      void initBluestein();
+      void bluestein(T* data, T* work, const bool inverse) const;
+      void realBluestein(T* data, T* work, const bool inverse) const;
+
+      /**
+       * Private attributes
+       */
+      size_t m_length;
+      Kind m_kind;
+      Engine m_engine;
+      bool m_bluestein;
+      boost::shared_ptr<const bob::sp::detail::FFTBackend<T> > m_backend;
+      std::vector<T> m_chirp;
+      std::vector<T> m_kernel;
+      boost::shared_ptr<const BasicFFTPlan> m_sub;
+  };
+
+  /**
+   * @brief Double and single precision plans. The (only) instantiations of
+   * BasicFFTPlan are provided by the library.
+   */
+  typedef BasicFFTPlan<double> FFTPlan;
+  typedef BasicFFTPlan<float> FFTPlanFloat;
+
+  namespace detail {
+
+    /**
+     * @brief The double precision plan of a transform, along with its
+     * single precision counterpart, which is only fetched on first use (most
+     * transforms are only used in one precision).
+     *
+     * get() may be called by several threads at the same time, but not
+     * concurrently with reset().
+     */
+    class FFTPlans
+    {
+      public:
+        /**
+         * @brief Constructor: no plan until reset() is called
+         */
+        FFTPlans();
+
+        /**
+         * @brief Copy constructor
+         */
+        FFTPlans(const FFTPlans& other);
+
+        /**
+         * @brief Assignment operator
+         */
+        FFTPlans& operator=(const FFTPlans& other);
+
+        /**
+         * @brief Fetches the double precision plan for the given length,
+         * kind and engine, and drops the single precision one
+         */
+        void reset(const size_t length,
+          const FFTPlanBase::Kind kind=FFTPlanBase::Complex,
+          const FFTPlanBase::Engine engine=FFTPlanBase::Fftpack);
+
+        /**
+         * @brief Returns the plan of the given precision (double or float)
+         */
+        template <typename T> const BasicFFTPlan<T>& get() const;
+
+      private:
+        /**
+         * @brief Fetches the single precision plan, if not done yet
+         */
+        const FFTPlanFloat& fetchFloat() const;
+
+        /**
+         * Private attributes
+         */
+        boost::shared_ptr<const FFTPlan> m_double;
+        mutable std::mutex m_mutex;
+        mutable boost::shared_ptr<const FFTPlanFloat> m_float;
+        mutable std::atomic<const FFTPlanFloat*> m_float_ptr;
+    };
+
+    template <>
+    inline const FFTPlan& FFTPlans::get<double>() const
+    {
+      return *m_double;
+    }
+
+    template <>
+    inline const FFTPlanFloat& FFTPlans::get<float>() const
+    {
+      const FFTPlanFloat* plan = m_float_ptr.load(std::memory_order_acquire);
+      return (plan ? *plan : fetchFloat());
+    }
+
+  }
+
+}}
+
+#endif /* BOB_SP_FFTPLAN_H */
@@ -0,0 +1,119 @@
+/**
+ * @date Sat Oct 17 21:36:08 CEST 2026
+ *
+ * @brief Four-step decomposition of the complex 1D FFTs of the lengths
+ * whose signals do not fit in the caches
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FOURSTEPFFT_H
+#define BOB_SP_FOURSTEPFFT_H
+
+#include <complex>
+#include <vector>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief This class computes the complex FFTs of a huge length
+   * N = N1*N2 as two batches of cache-resident FFTs (Bailey's four-step
+   * algorithm), the signal x_(n1+N1*n2) being seen as a C-ordered (N2, N1)
+   * matrix:
+   *   1. the N1 columns are transformed (length N2), and the value k2 of
+   *      the column n1 is multiplied by the twiddle factor W^(n1*k2),
+   *      W = exp(-2*i*pi/N), the column n1 being written to the row n1 of
+   *      the output, seen as a C-ordered (N1, N2) matrix,
+   *   2. the N2 columns of the output are transformed in place (length
+   *      N1), the value k1 of the column k2 being X_(k2+N2*k1).
+   * Each step reads and writes the whole signal once, the sub-FFTs being
+   * computed in cache, by tiles of columns (see processColumnTiles()). A
+   * radix pass of a plan of length N, instead, sweeps the whole signal
+   * (from main memory) once per factor. Both steps are spread over several
+   * threads. No scratch of the size of the signal is used, except by the
+   * in-place transforms, the output of the first step being written to a
+   * copy (released right away by the Workspace pool, given its size).
+   *
+   * The twiddle factors W^e are the products of two tables of about
+   * sqrt(N) values, W^(e mod S) and W^(S*floor(e/S)), computed in double
+   * precision, S being a power of two.
+   *
+   * The object never changes once created: transform() may be called by
+   * several threads at the same time.
+   */
+  class FourStepFFT
+  {
+    public:
+      /**
+       * @brief Returns the length N2 of the columns of the decomposition
+       * of the given length (its largest divisor below its square root), or
+       * 0 if the four-step algorithm is not used for it: for lengths below
+       * 2^20 (whose signals mostly fit in the caches), and for the lengths
+       * without balanced factors (N2 < sqrt(N)/8, such as primes).
+       */
+      static size_t split(const size_t length);
+
+      /**
+       * @brief Constructor: decomposition of the given length (for which
+       * split() should not be 0), whose sub-FFTs use the given engine
+       */
+      FourStepFFT(const size_t length, const FFTPlanBase::Engine engine);
+
+      /**
+       * @brief Getters
+       */
+      size_t getLength() const { return m_length; }
+      size_t getRows() const { return m_rows; }
+      size_t getColumns() const { return m_columns; }
+
+      /**
+       * @brief Computes the direct (or the normalized inverse) FFT of src
+       * into dst (which may be src), using up to the given number of
+       * threads (0 for the number of hardware threads). If modulation is
+       * not null, the input of the direct transform is multiplied by its
+       * conjugated factors, and the output of the inverse transform by its
+       * factors (see FFT1DAbstract::setCentered()).
+       */
+      template <typename T>
+      void transform(const std::complex<T>* src, std::complex<T>* dst,
+          const bool inverse, const std::complex<double>* modulation,
+          const size_t threads) const;
+
+    private:
+      /**
+       * @brief The two steps of transform(), the first one writing to z,
+       * which is dst unless it is src
+       */
+      template <typename T>
+      void steps(const std::complex<T>* src, std::complex<T>* z,
+          std::complex<T>* dst, const bool inverse,
+          const std::complex<double>* modulation, const size_t threads) const;
+
+      /**
+       * @brief Returns W^e, for e < N
+       */
+      std::complex<double> twiddle(const size_t e) const
+      {
+        return m_low[e & (m_low.size()-1)] * m_high[e >> m_shift];
+      }
+
+      /**
+       * Private attributes. The columns of the input have m_rows values
+       * (N2), and those of the output m_columns values (N1). m_low holds
+       * W^j for j < S = 2^m_shift, and m_high W^(j*S) for j <= N/S.
+       */
+      size_t m_length;
+      size_t m_rows;
+      size_t m_columns;
+      size_t m_shift;
+      std::vector<std::complex<double> > m_low;
+      std::vector<std::complex<double> > m_high;
+      FFTPlans m_column_plans;
+      FFTPlans m_row_plans;
+  };
+
+}}}
+
+#endif /* BOB_SP_FOURSTEPFFT_H */
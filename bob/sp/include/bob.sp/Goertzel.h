@@ -0,0 +1,162 @@
+/**
+ * @date Sat Oct 17 15:48:10 CEST 2026
+ *
+ * @brief Implement a blitz-based evaluation of a few bins of the Discrete
+ * Fourier Transform, with the Goertzel algorithm
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_GOERTZEL_H
+#define BOB_SP_GOERTZEL_H
+
+#include <complex>
+#include <vector>
+#include <blitz/array.h>
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class evaluates the Discrete Fourier Transform of real
+   * signals of a given length N at a few frequencies only, with the
+   * Goertzel algorithm: the value at frequency f (in bins, f/N cycles per
+   * sample) is obtained from the last two values of the recurrence
+   *   s[n] = x[n] + 2*cos(2*pi*f/N)*s[n-1] - s[n-2]
+   * This costs about N multiply-adds per frequency, against N*log2(N) for
+   * a full FFT, hence is faster when the number of frequencies is small
+   * compared to log2(N).
+   *
+   * The frequencies may be fractional. The recurrences of several
+   * frequencies run in the lanes of the same SIMD vectors (see
+   * fftpack_simd_level()). When there are too few frequencies to keep the
+   * lanes busy, the signal is split into segments, whose recurrences run
+   * side by side. Either the complex values of the transform, or
+   * their power (squared magnitude), which is cheaper, may be computed.
+   *
+   * The computations are done in double precision, whatever the precision
+   * of the signal, as the recurrence is not accurate enough in single
+   * precision.
+   */
+  class Goertzel
+  {
+    public:
+      /**
+       * @brief Constructor: frequency 0 of signals of length 1
+       */
+      Goertzel();
+
+      /**
+       * @brief Constructor: the given frequencies (in bins) of signals of
+       * the given length
+       */
+      Goertzel(const size_t length, const std::vector<double>& frequencies);
+
+      /**
+       * @brief Copy constructor
+       */
+      Goertzel(const Goertzel& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~Goertzel();
+
+      /**
+       * @brief Assignment operator
+       */
+      Goertzel& operator=(const Goertzel& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const Goertzel& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const Goertzel& other) const;
+
+      /**
+       * @brief Computes the values of the transform of the signal src at
+       * the frequencies, in their order. Single precision signals give
+       * single precision values.
+       */
+      void operator()(const blitz::Array<double,1>& src,
+          blitz::Array<std::complex<double>,1>& dst) const;
+      void operator()(const blitz::Array<float,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+
+      /**
+       * @brief Same as above, for each row of src (a batch of signals)
+       */
+      void operator()(const blitz::Array<double,2>& src,
+          blitz::Array<std::complex<double>,2>& dst) const;
+      void operator()(const blitz::Array<float,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+
+      /**
+       * @brief Computes the power (squared magnitude) of the transform of
+       * the signal src at the frequencies, in their order
+       */
+      void power(const blitz::Array<double,1>& src,
+          blitz::Array<double,1>& dst) const;
+      void power(const blitz::Array<float,1>& src,
+          blitz::Array<float,1>& dst) const;
+
+      /**
+       * @brief Same as above, for each row of src (a batch of signals)
+       */
+      void power(const blitz::Array<double,2>& src,
+          blitz::Array<double,2>& dst) const;
+      void power(const blitz::Array<float,2>& src,
+          blitz::Array<float,2>& dst) const;
+
+      /**
+       * @brief Getters
+       */
+      size_t getLength() const { return m_length; }
+      const std::vector<double>& getFrequencies() const
+      { return m_frequencies; }
+      /**
+       * @brief Setters
+       */
+      void setLength(const size_t length);
+      void setFrequencies(const std::vector<double>& frequencies);
+
+    private:
+      /**
+       * @brief Runs the recurrences on the rows of src (contiguous), and
+       * stores either the values or the power of the transform of each row
+       * into the rows of dst (contiguous)
+       */
+      template <typename T, typename U>
+      void process(const T* src, const size_t rows, U* dst) const;
+
+      /**
+       * @brief Initialize working array: coefficients of the recurrences
+       * and phase factors of the results
+       */
+      void initWorkingArray();
+
+      /**
+       * Private attributes. m_coefficients are the coefficients
+       * 2*cos(2*pi*f/N) of the recurrences, padded with zeros to a multiple
+       * of 8. The signal, padded with m_padding leading zeros, is split into
+       * m_segments segments of length L, and the value of the transform at
+       * the frequency f is the sum over the segments j of
+       * m_shifts[j][f] * (m_first[f]*s_j[L-1] - m_second[f]*s_j[L-2]).
+       */
+      size_t m_length;
+      std::vector<double> m_frequencies;
+      std::vector<double> m_coefficients;
+      size_t m_segments;
+      size_t m_padding;
+      std::vector<std::complex<double> > m_first;
+      std::vector<std::complex<double> > m_second;
+      std::vector<std::complex<double> > m_shifts;
+  };
+
+}}
+
+#endif /* BOB_SP_GOERTZEL_H */
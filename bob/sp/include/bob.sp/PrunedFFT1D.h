@@ -0,0 +1,261 @@
+/**
+ * @date Sat Oct 17 12:24:51 CEST 2026
+ *
+ * @brief Implement a blitz-based pruned 1D Fast Fourier Transform, which
+ * skips the computations feeding only known-zero inputs or discarded
+ * outputs
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_PRUNEDFFT1D_H
+#define BOB_SP_PRUNEDFFT1D_H
+
+#include <complex>
+#include <vector>
+#include <blitz/array.h>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a pruned 1D Discrete Fourier Transform of
+   * a given length N: only the first K (input length) values of the signal
+   * may be non-zero, the other ones being implicitly zero (zero padding),
+   * and only the first M (output length) values of the transform are
+   * computed. It is used as a base class for PrunedFFT1D and PrunedIFFT1D.
+   *
+   * The transform is decomposed as follows, with N = P*L and L = Q*S:
+   * - input pruning: L is the smallest divisor of N which is >= K. The
+   *   outputs P*q+r of the transform are then the outputs q of a transform
+   *   of length L of the (twiddled) K first values, for each 0 <= r < P;
+   * - output pruning: S is the smallest divisor of L which is >= the
+   *   number of outputs required from each of these transforms. They are
+   *   then computed by Q transforms of length S (of their decimated inputs),
+   *   which are combined for the required outputs only.
+   * Zero padding to a (much) larger length, or keeping a small part of the
+   * transform, hence costs less than a full transform of length N. Each
+   * pruning is only used if it saves more operations than its extra passes
+   * over the data cost, which is not the case for small ratios (such as
+   * N = 2*K) and lengths: the transform then falls back to a plain FFT of
+   * length N.
+   */
+  class PrunedFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~PrunedFFT1DAbstract();
+
+      /**
+       * @brief Assignment operator
+       */
+      PrunedFFT1DAbstract& operator=(const PrunedFFT1DAbstract& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const PrunedFFT1DAbstract& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const PrunedFFT1DAbstract& other) const;
+
+      /**
+       * @brief process the getInputLength() first values of a signal (the
+       * other ones being zero), and returns the getOutputLength() first
+       * values of its transform
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<std::complex<double>,1>& src,
+          blitz::Array<std::complex<double>,1>& dst) const;
+
+      /**
+       * @brief Single precision version of the above operator
+       */
+      void operator()(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+
+      /**
+       * @brief Same as the above operators, on contiguous arrays of
+       * getInputLength() and getOutputLength() complex values, which should
+       * not overlap
+       */
+      void operator()(const std::complex<double>* src,
+          std::complex<double>* dst) const;
+      void operator()(const std::complex<float>* src,
+          std::complex<float>* dst) const;
+
+      /**
+       * @brief Getters
+       * getLength() is the length N of the transform, getInputLength() the
+       * number K of (possibly) non-zero values of the signal, and
+       * getOutputLength() the number M of values of the transform which are
+       * computed. getEngine() is the backend of the inner transforms (see
+       * FFTPlanBase::Engine).
+       */
+      size_t getLength() const { return m_length; }
+      size_t getInputLength() const { return m_input_length; }
+      size_t getOutputLength() const { return m_output_length; }
+      FFTPlanBase::Engine getEngine() const { return m_engine; }
+      /**
+       * @brief Setters
+       * The input and output lengths should be in [1, length].
+       */
+      void setLength(const size_t length, const size_t input_length,
+          const size_t output_length);
+      void setEngine(const FFTPlanBase::Engine engine);
+
+    protected:
+      /**
+       * @brief Constructor
+       */
+      PrunedFFT1DAbstract();
+
+      /**
+       * @brief Constructor
+       */
+      PrunedFFT1DAbstract(const size_t length, const size_t input_length,
+          const size_t output_length);
+
+      /**
+       * @brief Copy constructor
+       */
+      PrunedFFT1DAbstract(const PrunedFFT1DAbstract& other);
+
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const = 0;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const = 0;
+
+      /**
+       * @brief Implementation of processNoCheck() for both precisions and
+       * directions. The inverse transforms are normalized.
+       */
+      template <typename T>
+      void process(const std::complex<T>* src, std::complex<T>* dst,
+          const bool inverse) const;
+
+      /**
+       * @brief Initialize working array: decomposition of the transform,
+       * twiddle factors and (shared) plan of the inner transforms
+       */
+      void initWorkingArray();
+
+      /**
+       * Private attributes. The decomposition (see above) is N = P*L
+       * (m_split, m_split_length) and L = Q*S (m_groups, m_group_length),
+       * each transform of length L providing at most m_group_outputs values.
+       */
+      size_t m_length;
+      size_t m_input_length;
+      size_t m_output_length;
+      FFTPlanBase::Engine m_engine;
+      size_t m_split;
+      size_t m_split_length;
+      size_t m_groups;
+      size_t m_group_length;
+      size_t m_group_outputs;
+      std::vector<std::complex<double> > m_input_twiddles;
+      std::vector<std::complex<double> > m_output_twiddles;
+      bob::sp::detail::FFTPlans m_plans;
+  };
+
+
+  /**
+   * @brief This class implements a direct pruned 1D Discrete Fourier
+   * Transform
+   */
+  class PrunedFFT1D: public PrunedFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      PrunedFFT1D();
+
+      /**
+       * @brief Constructor
+       */
+      PrunedFFT1D(const size_t length, const size_t input_length,
+          const size_t output_length);
+
+      /**
+       * @brief Copy constructor
+       */
+      PrunedFFT1D(const PrunedFFT1D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~PrunedFFT1D();
+
+      /**
+       * @brief Assignment operator
+       */
+      PrunedFFT1D& operator=(const PrunedFFT1D& other);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const;
+  };
+
+
+  /**
+   * @brief This class implements an inverse pruned 1D Discrete Fourier
+   * Transform, normalized by 1/length as IFFT1D
+   */
+  class PrunedIFFT1D: public PrunedFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      PrunedIFFT1D();
+
+      /**
+       * @brief Constructor
+       */
+      PrunedIFFT1D(const size_t length, const size_t input_length,
+          const size_t output_length);
+
+      /**
+       * @brief Copy constructor
+       */
+      PrunedIFFT1D(const PrunedIFFT1D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~PrunedIFFT1D();
+
+      /**
+       * @brief Assignment operator
+       */
+      PrunedIFFT1D& operator=(const PrunedIFFT1D& other);
+
+    private:
+      /**
+       * @brief process an array assuming that all the 'check' are done
+       */
+      virtual void processNoCheck(const std::complex<double>* src,
+          std::complex<double>* dst) const;
+      virtual void processNoCheck(const std::complex<float>* src,
+          std::complex<float>* dst) const;
+  };
+
+}}
+
+#endif /* BOB_SP_PRUNEDFFT1D_H */
@@ -0,0 +1,210 @@
+/**
+ * @date Fri Oct 16 13:21:05 CEST 2026
+ *
+ * @brief Implement a blitz-based 1D Fast Fourier Transform of real signals,
+ * based on the fftpack real transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_RFFT1D_H
+#define BOB_SP_RFFT1D_H
+
+#include <complex>
+#include <blitz/array.h>
+#include <boost/shared_ptr.hpp>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a 1D Discrete Fourier Transform of real
+   * signals based on the NumPy FFT implementation. It is used as a base
+   * class for RFFT1D and IRFFT1D classes.
+   *
+   * As the spectrum of a real signal of length N is hermitian-symmetric,
+   * only its N/2+1 first (non-redundant) bins are stored.
+   */
+  class RFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~RFFT1DAbstract();
+
+      /**
+       * @brief Assignment operator
+       */
+      RFFT1DAbstract& operator=(const RFFT1DAbstract& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const RFFT1DAbstract& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const RFFT1DAbstract& other) const;
+
+      /**
+       * @brief Getters
+       * getLength() is the length of the real signal, getSpectrumLength()
+       * the number of non-redundant bins of its spectrum (length/2+1)
+       */
+      size_t getLength() const { return m_length; }
+      size_t getSpectrumLength() const { return m_length/2+1; }
+      /**
+       * @brief Setters
+       */
+      virtual void setLength(const size_t length);
+
+    protected:
+      /**
+       * @brief Constructor
+       */
+      RFFT1DAbstract();
+
+      /**
+       * @brief Constructor
+       */
+      RFFT1DAbstract(const size_t length);
+
+      /**
+       * @brief Copy constructor
+       */
+      RFFT1DAbstract(const RFFT1DAbstract& other);
+
+      /**
+       * @brief Initialize working array, fetching the (shared) plan for the
+       * current length
+       */
+      virtual void initWorkingArray();
+
+      /**
+       * Private attributes
+       */
+      size_t m_length;
+      bob::sp::detail::FFTPlans m_plans;
+  };
+
+
+  /**
+   * @brief This class implements a direct 1D Discrete Fourier Transform
+   * of real signals based on the NumPy FFT implementation.
+   */
+  class RFFT1D: public RFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      RFFT1D();
+
+      /**
+       * @brief Constructor
+       */
+      RFFT1D(const size_t length);
+
+      /**
+       * @brief Copy constructor
+       */
+      RFFT1D(const RFFT1D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~RFFT1D();
+
+      /**
+       * @brief Assignment operator
+       */
+      RFFT1D& operator=(const RFFT1D& other);
+
+      /**
+       * @brief process a real array of the given length, and returns the
+       * length/2+1 first bins of its spectrum
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<double,1>& src,
+          blitz::Array<std::complex<double>,1>& dst) const;
+
+      /**
+       * @brief Single precision version of the above operator
+       */
+      void operator()(const blitz::Array<float,1>& src,
+          blitz::Array<std::complex<float>,1>& dst) const;
+
+    private:
+      /**
+       * @brief Implementation of operator() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<T,1>& src,
+          blitz::Array<std::complex<T>,1>& dst) const;
+  };
+
+
+  /**
+   * @brief This class implements a inverse 1D Discrete Fourier Transform
+   * of real signals based on the NumPy FFT implementation.
+   */
+  class IRFFT1D: public RFFT1DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      IRFFT1D();
+
+      /**
+       * @brief Constructor
+       */
+      IRFFT1D(const size_t length);
+
+      /**
+       * @brief Copy constructor
+       */
+      IRFFT1D(const IRFFT1D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~IRFFT1D();
+
+      /**
+       * @brief Assignment operator
+       */
+      IRFFT1D& operator=(const IRFFT1D& other);
+
+      /**
+       * @brief process the length/2+1 first bins of a spectrum, and returns
+       * the real signal of the given length. The imaginary parts of the
+       * first bin (and of the last one, if length is even) are ignored.
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<std::complex<double>,1>& src,
+          blitz::Array<double,1>& dst) const;
+
+      /**
+       * @brief Single precision version of the above operator
+       */
+      void operator()(const blitz::Array<std::complex<float>,1>& src,
+          blitz::Array<float,1>& dst) const;
+
+    private:
+      /**
+       * @brief Implementation of operator() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,1>& src,
+          blitz::Array<T,1>& dst) const;
+  };
+
+}}
+
+#endif /* BOB_SP_RFFT1D_H */
@@ -0,0 +1,237 @@
+/**
+ * @date Fri Oct 16 14:32:18 CEST 2026
+ *
+ * @brief Implement a blitz-based 2D Fast Fourier Transform of real signals,
+ * based on the fftpack real transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_RFFT2D_H
+#define BOB_SP_RFFT2D_H
+
+#include <complex>
+#include <blitz/array.h>
+#include "FFT1D.h"
+#include "RFFT1D.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a 2D Discrete Fourier Transform of real
+   * signals using RFFT1D and FFT1D implementations. It is used as a base
+   * class for RFFT2D and IRFFT2D classes.
+   *
+   * As the spectrum of a real signal of size height x width is
+   * hermitian-symmetric, only its height x (width/2+1) first (non-redundant)
+   * bins are stored.
+   */
+  class RFFT2DAbstract
+  {
+    public:
+      /**
+       * @brief Destructor
+       */
+      virtual ~RFFT2DAbstract();
+
+      /**
+       * @brief Assignment operator
+       */
+      RFFT2DAbstract& operator=(const RFFT2DAbstract& other);
+
+      /**
+       * @brief Equal operator
+       */
+      bool operator==(const RFFT2DAbstract& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const RFFT2DAbstract& other) const;
+
+      /**
+       * @brief Getters
+       * getHeight() and getWidth() are the dimensions of the real signal,
+       * getSpectrumWidth() the number of non-redundant columns of its
+       * spectrum (width/2+1)
+       */
+      size_t getHeight() const { return m_height; }
+      size_t getWidth() const { return m_width; }
+      size_t getSpectrumWidth() const { return m_width/2+1; }
+
+      /**
+       * @brief Setters
+       */
+      virtual void setHeight(const size_t height);
+      virtual void setWidth(const size_t width);
+      virtual void setShape(const size_t height, const size_t width);
+
+    protected:
+      /**
+       * @brief Constructor
+       */
+      RFFT2DAbstract();
+
+      /**
+       * @brief Constructor
+       */
+      RFFT2DAbstract(const size_t height, const size_t width);
+
+      /**
+       * @brief Copy constructor
+       */
+      RFFT2DAbstract(const RFFT2DAbstract& other);
+
+      /**
+       * Private attributes
+       */
+      size_t m_height;
+      size_t m_width;
+  };
+
+
+  /**
+   * @brief This class implements a direct 2D Discrete Fourier Transform of
+   * real signals: real FFTs are applied on the rows, and complex FFTs on the
+   * width/2+1 non-redundant columns only.
+   */
+  class RFFT2D: public RFFT2DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      RFFT2D();
+
+      /**
+       * @brief Constructor
+       */
+      RFFT2D(const size_t height, const size_t width);
+
+      /**
+       * @brief Copy constructor
+       */
+      RFFT2D(const RFFT2D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~RFFT2D();
+
+      /**
+       * @brief Assignment operator
+       */
+      RFFT2D& operator=(const RFFT2D& other);
+
+      /**
+       * @brief Setters
+       */
+      void setHeight(const size_t height);
+      void setWidth(const size_t width);
+      void setShape(const size_t height, const size_t width);
+
+      /**
+       * @brief process a real array of the given shape, and returns the
+       * height x (width/2+1) first bins of its spectrum
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<double,2>& src,
+          blitz::Array<std::complex<double>,2>& dst) const;
+
+      /**
+       * @brief Single precision version of the above operator
+       */
+      void operator()(const blitz::Array<float,2>& src,
+          blitz::Array<std::complex<float>,2>& dst) const;
+
+    private:
+      /**
+       * @brief Implementation of operator() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<T,2>& src,
+          blitz::Array<std::complex<T>,2>& dst) const;
+
+      /**
+       * @brief FFT1D instances
+       */
+      bob::sp::FFT1D m_fft_h;
+      bob::sp::RFFT1D m_rfft_w;
+  };
+
+
+  /**
+   * @brief This class implements a inverse 2D Discrete Fourier Transform of
+   * real signals: complex inverse FFTs are applied on the width/2+1
+   * non-redundant columns, and real inverse FFTs on the rows.
+   */
+  class IRFFT2D: public RFFT2DAbstract
+  {
+    public:
+      /**
+       * @brief Constructor
+       */
+      IRFFT2D();
+
+      /**
+       * @brief Constructor
+       */
+      IRFFT2D(const size_t height, const size_t width);
+
+      /**
+       * @brief Copy constructor
+       */
+      IRFFT2D(const IRFFT2D& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~IRFFT2D();
+
+      /**
+       * @brief Assignment operator
+       */
+      IRFFT2D& operator=(const IRFFT2D& other);
+
+      /**
+       * @brief Setters
+       */
+      void setHeight(const size_t height);
+      void setWidth(const size_t width);
+      void setShape(const size_t height, const size_t width);
+
+      /**
+       * @brief process the height x (width/2+1) first bins of a spectrum,
+       * and returns the real signal of the given shape
+       * This method is reentrant: scratch memory is taken from a per-thread
+       * pool, so that the same object may be used by several threads.
+       */
+      void operator()(const blitz::Array<std::complex<double>,2>& src,
+          blitz::Array<double,2>& dst) const;
+
+      /**
+       * @brief Single precision version of the above operator
+       */
+      void operator()(const blitz::Array<std::complex<float>,2>& src,
+          blitz::Array<float,2>& dst) const;
+
+    private:
+      /**
+       * @brief Implementation of operator() for both precisions
+       */
+      template <typename T>
+      void process(const blitz::Array<std::complex<T>,2>& src,
+          blitz::Array<T,2>& dst) const;
+
+      /**
+       * @brief IFFT1D instances
+       */
+      bob::sp::IFFT1D m_ifft_h;
+      bob::sp::IRFFT1D m_irfft_w;
+  };
+
+}}
+
+#endif /* BOB_SP_RFFT2D_H */
@@ -0,0 +1,169 @@
+/**
+ * @date Sat Oct 17 14:18:32 CEST 2026
+ *
+ * @brief Implement a blitz-based sliding Discrete Fourier Transform, which
+ * updates the spectrum of a window moving over a stream of samples
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_SLIDINGDFT_H
+#define BOB_SP_SLIDINGDFT_H
+
+#include <complex>
+#include <vector>
+#include <blitz/array.h>
+#include "FFTPlan.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief This class implements a sliding Discrete Fourier Transform: it
+   * keeps the spectrum of the last N (length) samples of a stream, and
+   * updates it as new samples are pushed, instead of transforming the
+   * whole window again.
+   *
+   * When the window moves by h samples, each bin k is updated by the
+   * recurrence:
+   *   X'_k = W^(-k*h) * (X_k + sum_{j<h} (x_{N+j} - x_j) * W^(k*j))
+   * with W = exp(-2*pi*i/N) and x_0 the oldest sample of the window. This
+   * costs O(h) per monitored bin, hence O(h*N) for the whole spectrum or
+   * O(h*k) for a subset of k bins, instead of O(N*log(N)) for an FFT of
+   * the window. If the hop is so large that recomputing the spectrum is
+   * cheaper, it is recomputed instead.
+   *
+   * As the rounding errors of the recurrence accumulate, the spectrum is
+   * recomputed exactly from the window every getRefreshInterval() samples.
+   *
+   * The spectrum and the window are kept in double precision. Before any
+   * sample is pushed, the window is full of zeros.
+   */
+  class SlidingDFT
+  {
+    public:
+      /**
+       * @brief Constructor: window of length 1
+       */
+      SlidingDFT();
+
+      /**
+       * @brief Constructor: all the bins of a window of the given length
+       */
+      SlidingDFT(const size_t length);
+
+      /**
+       * @brief Constructor: the given bins (in [0, length[) of a window of
+       * the given length
+       */
+      SlidingDFT(const size_t length, const std::vector<size_t>& bins);
+
+      /**
+       * @brief Copy constructor (the state of the stream is copied as well)
+       */
+      SlidingDFT(const SlidingDFT& other);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~SlidingDFT();
+
+      /**
+       * @brief Assignment operator (the state of the stream is copied as
+       * well)
+       */
+      SlidingDFT& operator=(const SlidingDFT& other);
+
+      /**
+       * @brief Equal operator: same length, bins and refresh interval
+       */
+      bool operator==(const SlidingDFT& other) const;
+
+      /**
+       * @brief Not equal operator
+       */
+      bool operator!=(const SlidingDFT& other) const;
+
+      /**
+       * @brief Pushes the given samples (a hop of any size) into the window,
+       * and updates the spectrum
+       */
+      void operator()(const blitz::Array<std::complex<double>,1>& src);
+      void operator()(const blitz::Array<double,1>& src);
+
+      /**
+       * @brief Copies the current spectrum (the monitored bins, in the order
+       * of getBins()) into dst
+       */
+      void getSpectrum(blitz::Array<std::complex<double>,1>& dst) const;
+
+      /**
+       * @brief Fills the window with zeros (and hence the spectrum)
+       */
+      void reset();
+
+      /**
+       * @brief Getters
+       * getRefreshInterval() is the number of samples after which the
+       * spectrum is recomputed from the window (0 if it never is)
+       */
+      size_t getLength() const { return m_length; }
+      const std::vector<size_t>& getBins() const { return m_bins; }
+      size_t getRefreshInterval() const { return m_refresh_interval; }
+      /**
+       * @brief Setters
+       * setLength() monitors all the bins of the new window, which is
+       * filled with zeros, and resets the refresh interval to its default
+       * (16 windows). setBins() computes the spectrum of the new bins from
+       * the current window.
+       */
+      void setLength(const size_t length);
+      void setBins(const std::vector<size_t>& bins);
+      void setRefreshInterval(const size_t interval)
+      { m_refresh_interval = interval; }
+
+    private:
+      /**
+       * @brief Pushes the samples into the window and updates the spectrum
+       */
+      template <typename T>
+      void update(const blitz::Array<T,1>& src);
+
+      /**
+       * @brief Recomputes the spectrum from the window
+       */
+      void refresh();
+
+      /**
+       * @brief Initialize working array: twiddle factors and plan of the
+       * FFT of the window
+       */
+      void initWorkingArray();
+
+      /**
+       * @brief Initialize the rotations W^(-k) of the monitored bins
+       */
+      void initRotations();
+
+      /**
+       * Private attributes. The window is a circular buffer, the oldest
+       * sample being at m_position. m_twiddles are the powers W^t, for
+       * t < N, and m_rotations the factors W^(-k) of the single sample
+       * updates, for the monitored bins k. m_pending is the number of samples
+       * pushed since the spectrum was last recomputed.
+       */
+      size_t m_length;
+      std::vector<size_t> m_bins;
+      size_t m_refresh_interval;
+      std::vector<std::complex<double> > m_twiddles;
+      std::vector<std::complex<double> > m_rotations;
+      std::vector<std::complex<double> > m_window;
+      std::vector<std::complex<double> > m_spectrum;
+      size_t m_position;
+      size_t m_pending;
+      bob::sp::detail::FFTPlans m_plans;
+  };
+
+}}
+
+#endif /* BOB_SP_SLIDINGDFT_H */
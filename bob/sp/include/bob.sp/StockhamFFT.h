@@ -0,0 +1,101 @@
+/**
+ * @date Fri Oct 16 23:05:19 CEST 2026
+ *
+ * @brief Native engine of the complex 1D Fast Fourier Transforms, based on
+ * the Stockham autosort algorithm
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_STOCKHAMFFT_H
+#define BOB_SP_STOCKHAMFFT_H
+
+#include <cstddef>
+#include <vector>
+#include "FFTBackend.h"
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief This class holds the factorization and the twiddle factors of a
+   * complex 1D FFT of a given length, computed with the Stockham autosort
+   * algorithm, on interleaved arrays of T (double or float).
+   *
+   * Each radix pass reads the signal from one array and writes it, already
+   * in order, to the other one: there is no bit reversal, and the passes
+   * ping-pong between the data and the work array. The factors are 4 first,
+   * then 2, 3, 5, and any other prime with a generic (quadratic) pass. The
+   * twiddle factors of each pass are precomputed (in double precision) and
+   * stored one after the other, in the order in which the pass reads them,
+   * and the butterflies of a pass which share a twiddle factor are next to
+   * each other in memory, so that the innermost loops are unit-stride.
+   */
+  template <typename T>
+  class StockhamFFT: public FFTBackend<T>
+  {
+    public:
+      /**
+       * @brief Constructor: no pass until init() is called
+       */
+      StockhamFFT();
+
+      /**
+       * @brief Computes the factorization and the twiddle factors for the
+       * given length
+       */
+      void init(const size_t length);
+
+      /**
+       * @brief Getters
+       */
+      size_t getLength() const { return m_length; }
+      /**
+       * @brief Number of T required by the work array passed to forward()
+       * and backward()
+       */
+      virtual size_t getWorkSize() const { return 2*m_length; }
+
+      /**
+       * @brief Computes the direct (unnormalized) FFT of the interleaved
+       * complex array data (2*length values), in-place
+       */
+      virtual void forward(T* data, T* work) const;
+
+      /**
+       * @brief Computes the inverse (unnormalized) FFT of the interleaved
+       * complex array data (2*length values), in-place
+       */
+      virtual void backward(T* data, T* work) const;
+
+    private:
+      /**
+       * @brief Runs all the passes
+       */
+      template <bool inverse>
+      void transform(T* data, T* work) const;
+
+      /**
+       * @brief A radix pass, the offset of its twiddle factors, and the one
+       * of the roots of unity of the generic pass
+       */
+      struct Pass {
+        size_t radix;
+        size_t m;
+        size_t stride;
+        size_t twiddles;
+        size_t roots;
+      };
+
+      /**
+       * Private attributes
+       */
+      size_t m_length;
+      std::vector<Pass> m_passes;
+      std::vector<T> m_twiddles;
+      std::vector<T> m_roots;
+  };
+
+}}}
+
+#endif /* BOB_SP_STOCKHAMFFT_H */
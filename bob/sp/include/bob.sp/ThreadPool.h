@@ -0,0 +1,44 @@
+/**
+ * @date Fri Oct 16 18:40:19 CEST 2026
+ *
+ * @brief Process-wide pool of worker threads, used to spread the
+ * independent 1D transforms of batched and multidimensional transforms
+ * over several cores
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_THREADPOOL_H
+#define BOB_SP_THREADPOOL_H
+
+#include <cstddef>
+#include <functional>
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief Returns the number of threads actually used for a requested
+   * number of threads: 0 stands for the number of hardware threads.
+   */
+  size_t resolveThreads(const size_t threads);
+
+  /**
+   * @brief Calls fn(i) for each i in [0, count), using up to threads
+   * threads (0 for the number of hardware threads), the calling one
+   * included, and returns once all the calls are done.
+   *
+   * The calls are distributed dynamically over the threads, in increasing
+   * order of i. The other threads are taken from a process-wide pool, which
+   * is grown on demand, up to one thread per hardware thread, so that they
+   * keep their scratch memory (see Workspace) from one call to the next. A
+   * child process created by fork() starts with an empty pool. Nested calls, made from fn, run
+   * on the calling thread only. If some calls throw, the first exception
+   * caught is rethrown, once all the threads are done.
+   */
+  void parallelFor(const size_t count, const size_t threads,
+    const std::function<void(size_t)>& fn);
+
+}}}
+
+#endif /* BOB_SP_THREADPOOL_H */
@@ -0,0 +1,116 @@
+/**
+ * @date Fri Oct 16 11:03:27 CEST 2026
+ *
+ * @brief Per-thread scratch memory for the signal processing transforms
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_WORKSPACE_H
+#define BOB_SP_WORKSPACE_H
+
+#include <vector>
+#include <blitz/array.h>
+
+
+namespace bob { namespace sp { namespace detail {
+
+  /**
+   * @brief Acquires a block of at least size doubles from the pool of the
+   * calling thread
+   */
+  std::vector<double>* acquireScratch(const size_t size);
+
+  /**
+   * @brief Gives a block back to the pool of the calling thread
+   */
+  void releaseScratch(std::vector<double>* block);
+
+  /**
+   * @brief Returns the number of bytes held by the pool of the calling
+   * thread, in the blocks not in use
+   */
+  size_t scratchBytes();
+
+  /**
+   * @brief Returns the largest number of bytes of scratch memory in use at
+   * once by the calling thread since the previous call
+   */
+  size_t scratchPeak();
+
+  /**
+   * @brief Scratch array of T, taken from a per-thread pool for the
+   * lifetime of this object.
+   *
+   * Transforms use it instead of mutable members, so that their const
+   * operator() is reentrant: a single transform object may be used by
+   * several threads at the same time. Blocks are recycled, so that no
+   * memory allocation happens once a thread has warmed up, except for the
+   * blocks of more than 1 MB, which are freed when released: a thread
+   * keeps at most 8 blocks of up to 1 MB.
+   */
+  template <typename T>
+  class Workspace
+  {
+    public:
+      /**
+       * @brief Constructor: acquires room for size elements of type T
+       */
+      explicit Workspace(const size_t size):
+        m_size(size),
+        m_block(acquireScratch((size*sizeof(T)+sizeof(double)-1)/sizeof(double)))
+      {
+      }
+
+      /**
+       * @brief Destructor: gives the memory back to the thread pool
+       */
+      ~Workspace()
+      {
+        releaseScratch(m_block);
+      }
+
+      /**
+       * @brief Getters
+       */
+      T* data() const { return reinterpret_cast<T*>(m_block->data()); }
+      size_t size() const { return m_size; }
+
+      /**
+       * @brief Returns a 1D blitz array referring to the elements
+       * [offset, offset+length[ of the workspace
+       */
+      blitz::Array<T,1> operator()(const size_t offset, const size_t length) const
+      {
+        return blitz::Array<T,1>(data() + offset,
+            blitz::TinyVector<int,1>(length), blitz::neverDeleteData);
+      }
+
+      /**
+       * @brief Returns a 2D (C-ordered) blitz array referring to the
+       * elements [offset, offset+height*width[ of the workspace
+       */
+      blitz::Array<T,2> operator()(const size_t offset, const size_t height,
+        const size_t width) const
+      {
+        return blitz::Array<T,2>(data() + offset,
+            blitz::TinyVector<int,2>(height, width), blitz::neverDeleteData);
+      }
+
+    private:
+      /**
+       * @brief Disabled copy constructor and assignment operator
+       */
+      Workspace(const Workspace& other);
+      Workspace& operator=(const Workspace& other);
+
+      /**
+       * Private attributes
+       */
+      size_t m_size;
+      std::vector<double>* m_block;
+  };
+
+}}}
+
+#endif /* BOB_SP_WORKSPACE_H */
@@ -0,0 +1,82 @@
+/**
+ * @date Sat Oct 17 18:41:27 CEST 2026
+ *
+ * @brief Implement blitz-based convolution and correlation products computed
+ * with real FFTs, for large kernels
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#ifndef BOB_SP_FFTCONV_H
+#define BOB_SP_FFTCONV_H
+
+#include <blitz/array.h>
+#include "conv.h"
+
+
+namespace bob { namespace sp {
+
+  /**
+   * @brief 1D convolution of blitz arrays computed with FFTs: c=a*b
+   * The output is the same as the one of conv(), for the given size
+   * option, but costs O((A+B)*log(A+B)) instead of O(A*B), which is faster
+   * unless the kernel b is small (a few tens of samples). The signals are
+   * zero padded to the length FFTPlanBase::nextFastLength(A+B-1), so that
+   * any size is fast, and the result is cropped. The transforms of the last
+   * few lengths used by each thread are kept, so that repeated products of
+   * the same sizes do not plan them again.
+   * @param a The first input array a
+   * @param b The second input array b (the kernel)
+   * @param c The output array c=a*b, of size getConvOutputSize()
+   * @param size_opt:  * Full: full size (default)
+   *                   * Same: same size as a
+   *                   * Valid: valid (part without padding)
+   * @warning a should be larger than the kernel b
+   */
+  void fftconv(const blitz::Array<double,1>& a,
+      const blitz::Array<double,1>& b, blitz::Array<double,1>& c,
+      const Conv::SizeOption size_opt = Conv::Full);
+  void fftconv(const blitz::Array<float,1>& a,
+      const blitz::Array<float,1>& b, blitz::Array<float,1>& c,
+      const Conv::SizeOption size_opt = Conv::Full);
+
+  /**
+   * @brief 2D convolution of blitz arrays computed with FFTs: C=A*B
+   * Same as above, both dimensions being padded to a fast length.
+   * @warning A should have larger dimensions than the kernel B
+   */
+  void fftconv(const blitz::Array<double,2>& A,
+      const blitz::Array<double,2>& B, blitz::Array<double,2>& C,
+      const Conv::SizeOption size_opt = Conv::Full);
+  void fftconv(const blitz::Array<float,2>& A,
+      const blitz::Array<float,2>& B, blitz::Array<float,2>& C,
+      const Conv::SizeOption size_opt = Conv::Full);
+
+  /**
+   * @brief 1D correlation of blitz arrays computed with FFTs: the
+   * convolution of a with the reversed kernel b, with the same output sizes
+   * as fftconv(). The Valid part is
+   *   c_i = sum_(j<B) a_(i+j) * b_j,  for i <= A-B
+   * and the Full one starts B-1 samples earlier.
+   */
+  void fftcorr(const blitz::Array<double,1>& a,
+      const blitz::Array<double,1>& b, blitz::Array<double,1>& c,
+      const Conv::SizeOption size_opt = Conv::Full);
+  void fftcorr(const blitz::Array<float,1>& a,
+      const blitz::Array<float,1>& b, blitz::Array<float,1>& c,
+      const Conv::SizeOption size_opt = Conv::Full);
+
+  /**
+   * @brief 2D correlation of blitz arrays computed with FFTs, the kernel B
+   * being reversed along both dimensions
+   */
+  void fftcorr(const blitz::Array<double,2>& A,
+      const blitz::Array<double,2>& B, blitz::Array<double,2>& C,
+      const Conv::SizeOption size_opt = Conv::Full);
+  void fftcorr(const blitz::Array<float,2>& A,
+      const blitz::Array<float,2>& B, blitz::Array<float,2>& C,
+      const Conv::SizeOption size_opt = Conv::Full);
+
+}}
+
+#endif /* BOB_SP_FFTCONV_H */
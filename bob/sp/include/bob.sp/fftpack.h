@@ -54,10 +54,77 @@ extern void cfftf(int N, Treal data[], const Treal wrk[]);
 extern void cfftb(int N, Treal data[], const Treal wrk[]);
 extern void cffti(int N, Treal wrk[]);
 
+/* Same as above, but with the work array (2*N) passed separately from the
+ * read-only plan (2*N+15) created by cffti_plan() */
+extern void cfftf_plan(int N, Treal data[], Treal work[], const Treal plan[]);
+extern void cfftb_plan(int N, Treal data[], Treal work[], const Treal plan[]);
+extern void cffti_plan(int N, Treal plan[]);
+/* Same as cffti_plan(), with the nf factors of N (at most
+ * FFTPACK_MAX_FACTORS, all >= 2) taken in the given order instead of the
+ * default one. Returns 0, or -1 if the factors are not valid. */
+extern int cffti_plan_factors(int N, Treal plan[], int nf, const int factors[]);
+#define FFTPACK_MAX_FACTORS 13
+
 extern void rfftf(int N, Treal data[], const Treal wrk[]);
 extern void rfftb(int N, Treal data[], const Treal wrk[]);
 extern void rffti(int N, Treal wrk[]);
 
+/* Same as above, but with the work array (N) passed separately from the
+ * read-only plan (N+15) created by rffti_plan() */
+extern void rfftf_plan(int N, Treal data[], Treal work[], const Treal plan[]);
+extern void rfftb_plan(int N, Treal data[], Treal work[], const Treal plan[]);
+extern void rffti_plan(int N, Treal plan[]);
+
+/* Single precision versions of the plan based transforms above
+ * (fftpack_float.c). The plans hold 2*N+15 (complex) or N+15 (real) floats,
+ * the work arrays 2*N or N floats. */
+extern void cfftf_plan_float(int N, float data[], float work[], const float plan[]);
+extern void cfftb_plan_float(int N, float data[], float work[], const float plan[]);
+extern void cffti_plan_float(int N, float plan[]);
+extern int cffti_plan_factors_float(int N, float plan[], int nf, const int factors[]);
+extern void rfftf_plan_float(int N, float data[], float work[], const float plan[]);
+extern void rfftb_plan_float(int N, float data[], float work[], const float plan[]);
+extern void rffti_plan_float(int N, float plan[]);
+
+/* Instruction sets of the vectorized radix 2, 3, 4 and 5 passes of the
+ * complex transforms (fftpack_simd.c), selected at runtime */
+#define FFTPACK_SIMD_NONE 0
+#define FFTPACK_SIMD_SSE2 1
+#define FFTPACK_SIMD_AVX2 2
+#define FFTPACK_SIMD_AVX512 3
+
+/* Returns the instruction set currently used by the complex passes (and by
+ * the batched transforms below) */
+extern int fftpack_simd_level(void);
+/* Restricts the instruction set used by the complex passes (mostly for
+ * testing), and returns the level actually set, which is capped to the
+ * best one supported by the CPU. A negative level restores the default. */
+extern int fftpack_set_simd_level(int level);
+
+/* One radix p stage of a batched complex Stockham FFT (fftpack_batch.c),
+ * on split real/imaginary arrays. The input x is read as p blocks of m*sl
+ * values, and the output y written as m groups of p runs of sl values, the
+ * run t of group i being multiplied by the twiddle factor at (p-1)*i+t-1 in
+ * twr/twi (cosine and sine). rootr/rooti hold the p-th roots of unity, only
+ * used for radices larger than 5. isign is -1 for the direct transform and
+ * +1 for the inverse one. sl is a multiple of 8 (double) or 16 (float). */
+extern void fftpack_batch_stage(int p, int m, int sl, const double xr[],
+    const double xi[], double yr[], double yi[], const double twr[],
+    const double twi[], const double rootr[], const double rooti[], int isign);
+extern void fftpack_batch_stage_float(int p, int m, int sl, const float xr[],
+    const float xi[], float yr[], float yi[], const float twr[],
+    const float twi[], const float rootr[], const float rooti[], int isign);
+
+/* Goertzel recurrences s[n] = x[n] + c*s[n-1] - s[n-2] of several bins
+ * at once (goertzel.c), with the same instruction set as the complex
+ * passes, on each of the segments of length values of x. On return,
+ * s1[j*ld+b] and s2[j*ld+b] hold the last two values s[length-1] and
+ * s[length-2] of the recurrence of the bin b (of coefficient c[b]) on the
+ * segment j, ld being bins rounded up to a multiple of 8. c, s1 and s2 are
+ * padded up to this multiple of 8. */
+extern void goertzel_run(int length, const double x[], int segments,
+    int bins, const double c[], double s1[], double s2[]);
+
 #ifdef __cplusplus
 }
 #endif
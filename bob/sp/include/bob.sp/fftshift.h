@@ -11,8 +11,10 @@
 #define BOB_SP_FFTSHIFT_H
 
 #include <complex>
+#include <algorithm>
 #include <blitz/array.h>
 #include <bob.core/assert.h>
+#include <bob.core/array_check.h>
 
 
 namespace bob { namespace sp {
@@ -84,6 +86,103 @@ namespace detail {
       B(B_y4,B_x4) = A(A_y4,A_x4);
     }
   }
+
+  /**
+   * @brief Reverses the order of the count contiguous blocks of inner
+   * elements starting at p. The blocks are swapped with std::swap_ranges,
+   * which is vectorized.
+   */
+  template <typename T>
+  void reverseBlocks(T* p, const size_t count, const size_t inner)
+  {
+    if (inner == 1) std::reverse(p, p + count);
+    else
+      for (size_t i=0; i<count/2; ++i)
+        std::swap_ranges(p + i*inner, p + (i+1)*inner, p + (count-1-i)*inner);
+  }
+
+  /**
+   * @brief Rotates to the left by shift blocks, in place, each of the outer
+   * sequences of n contiguous blocks of inner elements starting at data.
+   * Halves of the same size are swapped. Otherwise, the rotation is a triple
+   * reversal (of the first shift blocks, of the others, then of the whole
+   * sequence), which moves each element twice, whatever the extents.
+   */
+  template <typename T>
+  void rotateBlocks(T* data, const size_t outer, const size_t n,
+    const size_t inner, const size_t shift)
+  {
+    if (shift == 0 || shift == n) return;
+    for (size_t o=0; o<outer; ++o) {
+      T* p = data + o*n*inner;
+      if (2*shift == n)
+        std::swap_ranges(p, p + shift*inner, p + shift*inner);
+      else {
+        reverseBlocks(p, shift, inner);
+        reverseBlocks(p + shift*inner, n - shift, inner);
+        reverseBlocks(p, n, inner);
+      }
+    }
+  }
+
+  /**
+   * @brief Performs the fftshift (or ifftshift if inverse is set) operation
+   * in place, one dimension after the other. Arrays which are not
+   * C-contiguous (e.g. slices) are shifted through a contiguous copy.
+   */
+  template <typename T, int N>
+  void fftshiftInPlace(blitz::Array<T,N>& A, const bool inverse)
+  {
+    if (A.numElements() == 0) return;
+    if (!bob::core::array::isCZeroBaseContiguous(A)) {
+      blitz::Array<T,N> C(A.shape());
+      C = A;
+      fftshiftInPlace(C, inverse);
+      A = C;
+      return;
+    }
+
+    // Along the dimension d, the array is made of outer sequences of
+    // A.extent(d) blocks of inner elements. fftshift moves the block
+    // ceil(n/2) to the front, and ifftshift the block floor(n/2).
+    size_t outer = 1;
+    size_t inner = A.numElements();
+    for (int d=0; d<N; ++d) {
+      const size_t n = A.extent(d);
+      inner /= n;
+      rotateBlocks(A.data(), outer, n, inner, inverse ? n/2 : (n+1)/2);
+      outer *= n;
+    }
+  }
+
+  /**
+   * @brief Checks if A and B are the same view of the same data
+   */
+  template <typename T, int N>
+  bool isSameView(const blitz::Array<T,N>& A, const blitz::Array<T,N>& B)
+  {
+    if (A.data() != B.data()) return false;
+    for (int d=0; d<N; ++d)
+      if (A.stride(d) != B.stride(d)) return false;
+    return true;
+  }
+
+  /**
+   * @brief Checks if the memory spanned by A and B overlaps (views with
+   * negative strides span memory before their data())
+   */
+  template <typename T, int N>
+  bool overlap(const blitz::Array<T,N>& A, const blitz::Array<T,N>& B)
+  {
+    if (A.numElements() == 0 || B.numElements() == 0) return false;
+    const T* a[2] = {A.data(), A.data()};
+    const T* b[2] = {B.data(), B.data()};
+    for (int d=0; d<N; ++d) {
+      a[A.stride(d) < 0 ? 0 : 1] += A.stride(d) * (A.extent(d) - 1);
+      b[B.stride(d) < 0 ? 0 : 1] += B.stride(d) * (B.extent(d) - 1);
+    }
+    return a[0] <= b[1] && b[0] <= a[1];
+  }
 }
 
 /**
@@ -104,10 +203,20 @@ void fftshift(const blitz::Array<T,1>& A, blitz::Array<T,1>& B)
   bob::core::array::assertZeroBase(B);
   bob::core::array::assertSameShape(A,B);
 
+  // A and B being the same view: shift in place
+  if (detail::isSameView(A, B)) {
+    detail::fftshiftInPlace(B, false);
+    return;
+  }
+
   // Center location
   int size_by_2 = A.extent(0)/2 + (A.extent(0) % 2);
 
-  detail::fftshiftNoCheck(size_by_2, A, B);
+  // Other views of the same data (e.g. reversed): shift a copy of A
+  if (detail::overlap(A, B))
+    detail::fftshiftNoCheck(size_by_2, blitz::Array<T,1>(A.copy()), B);
+  else
+    detail::fftshiftNoCheck(size_by_2, A, B);
 }
 
 /**
@@ -124,10 +233,20 @@ void ifftshift(const blitz::Array<T,1>& A, blitz::Array<T,1>& B)
   bob::core::array::assertZeroBase(B);
   bob::core::array::assertSameShape(A,B);
 
+  // A and B being the same view: shift in place
+  if (detail::isSameView(A, B)) {
+    detail::fftshiftInPlace(B, true);
+    return;
+  }
+
   // Center location
   int size_by_2 = A.extent(0)/2;
 
-  detail::fftshiftNoCheck(size_by_2, A, B);
+  // Other views of the same data (e.g. reversed): shift a copy of A
+  if (detail::overlap(A, B))
+    detail::fftshiftNoCheck(size_by_2, blitz::Array<T,1>(A.copy()), B);
+  else
+    detail::fftshiftNoCheck(size_by_2, A, B);
 }
 
 /**
@@ -145,11 +264,21 @@ void fftshift(const blitz::Array<T,2>& A, blitz::Array<T,2>& B)
   bob::core::array::assertZeroBase(B);
   bob::core::array::assertSameShape(A,B);
 
+  // A and B being the same view: shift in place
+  if (detail::isSameView(A, B)) {
+    detail::fftshiftInPlace(B, false);
+    return;
+  }
+
   // Center location
   int h_by_2 = A.extent(0)/2 + (A.extent(0) % 2);
   int w_by_2 = A.extent(1)/2 + (A.extent(1) % 2);
 
-  detail::fftshiftNoCheck(h_by_2, w_by_2, A, B);
+  // Other views of the same data (e.g. transposed): shift a copy of A
+  if (detail::overlap(A, B))
+    detail::fftshiftNoCheck(h_by_2, w_by_2, blitz::Array<T,2>(A.copy()), B);
+  else
+    detail::fftshiftNoCheck(h_by_2, w_by_2, A, B);
 }
 
 /**
@@ -166,11 +295,44 @@ void ifftshift(const blitz::Array<T,2>& A, blitz::Array<T,2>& B)
   bob::core::array::assertZeroBase(B);
   bob::core::array::assertSameShape(A,B);
 
+  // A and B being the same view: shift in place
+  if (detail::isSameView(A, B)) {
+    detail::fftshiftInPlace(B, true);
+    return;
+  }
+
   // Center location
   int h_by_2 = A.extent(0)/2;
   int w_by_2 = A.extent(1)/2;
 
-  detail::fftshiftNoCheck(h_by_2, w_by_2, A, B);
+  // Other views of the same data (e.g. transposed): shift a copy of A
+  if (detail::overlap(A, B))
+    detail::fftshiftNoCheck(h_by_2, w_by_2, blitz::Array<T,2>(A.copy()), B);
+  else
+    detail::fftshiftNoCheck(h_by_2, w_by_2, A, B);
+}
+
+/**
+ * @brief Performs the fftshift operation in place, on a blitz array of any
+ * dimension (including odd extents), without any temporary if the array is
+ * C-contiguous (other arrays are shifted through a contiguous copy). This
+ * is also done by the functions above if A and B are the same view of the
+ * same data, while A is copied first if they overlap otherwise.
+ */
+template <typename T, int N>
+void fftshift(blitz::Array<T,N>& A)
+{
+  detail::fftshiftInPlace(A, false);
+}
+
+/**
+ * @brief Performs the ifftshift operation in place, on a C-contiguous
+ * blitz array of any dimension, which reverts the in-place fftshift
+ */
+template <typename T, int N>
+void ifftshift(blitz::Array<T,N>& A)
+{
+  detail::fftshiftInPlace(A, true);
 }
 
 /**
@@ -0,0 +1,464 @@
+/**
+ * @date Fri Oct 16 14:58:03 CEST 2026
+ *
+ * @brief Python bindings to the inverse FFT of real 2D signals
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/RFFT2D.h>
+
+PyDoc_STRVAR(s_fft2d_str, BOB_EXT_MODULE_PREFIX ".IRFFT2D");
+
+PyDoc_STRVAR(s_fft2d_doc,
+"IRFFT2D(shape) -> new IRFFT2D operator\n\
+\n\
+Calculates the inverse FFT of the non-redundant half of the\n\
+spectrum of a real 2D signal, as computed by :py:class:`RFFT2D`.\n\
+The input array is a 2D NumPy array of type ``complex128`` and shape\n\
+``(height, width//2+1)``. The output array is a 2D NumPy array of\n\
+type ``float64`` and shape ``(height, width)``.\n\
+\n\
+Single precision arrays (``complex64`` instead of ``complex128``,\n\
+``float32`` instead of ``float64``) are also accepted, in which case\n\
+the transform is computed in single precision.\n\
+"
+);
+
+/**
+ * Represents either an IRFFT2D
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::IRFFT2D* cxx;
+} PyBobSpIRFFT2DObject;
+
+extern PyTypeObject PyBobSpIRFFT2D_Type; //forward declaration
+
+int PyBobSpIRFFT2D_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpIRFFT2D_Type));
+}
+
+static void PyBobSpIRFFT2D_Delete (PyBobSpIRFFT2DObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpIRFFT2D_InitCopy
+(PyBobSpIRFFT2DObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpIRFFT2D_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpIRFFT2DObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::IRFFT2D(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpIRFFT2D_InitShape(PyBobSpIRFFT2DObject* self, PyObject *args,
+    PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"height", "width", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t h = 0;
+  Py_ssize_t w = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "nn", kwlist, &h, &w)) return -1;
+
+  try {
+    self->cxx = new bob::sp::IRFFT2D(h, w);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpIRFFT2D_Init(PyBobSpIRFFT2DObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+      return PyBobSpIRFFT2D_InitCopy(self, args, kwds);
+
+    case 2:
+      return PyBobSpIRFFT2D_InitShape(self, args, kwds);
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 argument, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpIRFFT2D_Repr(PyBobSpIRFFT2DObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(height=%zu, width=%zu)", Py_TYPE(self)->tp_name, self->cxx->getHeight(),
+   self->cxx->getWidth());
+}
+
+static PyObject* PyBobSpIRFFT2D_RichCompare (PyBobSpIRFFT2DObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpIRFFT2D_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpIRFFT2DObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_height_str, "height");
+PyDoc_STRVAR(s_height_doc,
+"The height of the (real) output array\n\
+");
+
+static PyObject* PyBobSpIRFFT2D_GetHeight
+(PyBobSpIRFFT2DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getHeight());
+}
+
+static int PyBobSpIRFFT2D_SetHeight
+(PyBobSpIRFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' height can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setHeight(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `height' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_width_str, "width");
+PyDoc_STRVAR(s_width_doc,
+"The width of the (real) output array\n\
+");
+
+static PyObject* PyBobSpIRFFT2D_GetWidth
+(PyBobSpIRFFT2DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getWidth());
+}
+
+static int PyBobSpIRFFT2D_SetWidth
+(PyBobSpIRFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' width can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setWidth(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `width' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_shape_str, "shape");
+PyDoc_STRVAR(s_shape_doc,
+"A tuple that represents the size of the (real) output array\n\
+");
+
+static PyObject* PyBobSpIRFFT2D_GetShape
+(PyBobSpIRFFT2DObject* self, void* /*closure*/) {
+  return Py_BuildValue("(nn)", self->cxx->getHeight(), self->cxx->getWidth());
+}
+
+static int PyBobSpIRFFT2D_SetShape
+(PyBobSpIRFFT2DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PySequence_Check(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' shape can only be set using tuples (or sequences), not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  PyObject* shape = PySequence_Tuple(o);
+  auto shape_ = make_safe(shape);
+
+  if (PyTuple_GET_SIZE(shape) != 2) {
+    PyErr_Format(PyExc_RuntimeError, "`%s' shape can only be set using 2-position tuples (or sequences), not an %" PY_FORMAT_SIZE_T "d-position sequence", Py_TYPE(self)->tp_name, PyTuple_GET_SIZE(shape));
+    return -1;
+  }
+
+  Py_ssize_t h = PyNumber_AsSsize_t(PyTuple_GET_ITEM(shape, 0), PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+  Py_ssize_t w = PyNumber_AsSsize_t(PyTuple_GET_ITEM(shape, 1), PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setHeight(h);
+    self->cxx->setWidth(w);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `shape' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_spectrum_width_str, "spectrum_width");
+PyDoc_STRVAR(s_spectrum_width_doc,
+"The number of non-redundant columns of the spectrum (``width//2+1``)\n\
+");
+
+static PyObject* PyBobSpIRFFT2D_GetSpectrumWidth
+(PyBobSpIRFFT2DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getSpectrumWidth());
+}
+
+static PyGetSetDef PyBobSpIRFFT2D_getseters[] = {
+    {
+      s_height_str,
+      (getter)PyBobSpIRFFT2D_GetHeight,
+      (setter)PyBobSpIRFFT2D_SetHeight,
+      s_height_doc,
+      0
+    },
+    {
+      s_width_str,
+      (getter)PyBobSpIRFFT2D_GetWidth,
+      (setter)PyBobSpIRFFT2D_SetWidth,
+      s_width_doc,
+      0
+    },
+    {
+      s_shape_str,
+      (getter)PyBobSpIRFFT2D_GetShape,
+      (setter)PyBobSpIRFFT2D_SetShape,
+      s_shape_doc,
+      0
+    },
+    {
+      s_spectrum_width_str,
+      (getter)PyBobSpIRFFT2D_GetSpectrumWidth,
+      0,
+      s_spectrum_width_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+static PyObject* PyBobSpIRFFT2D_Call
+(PyBobSpIRFFT2DObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_COMPLEX64);
+  const int output_type = (single ? NPY_FLOAT32 : NPY_FLOAT64);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "32-bit float" : "64-bit float", single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)");
+    return 0;
+  }
+
+  if (input->ndim != 2) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 2-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && input->ndim != output->ndim) {
+    PyErr_Format(PyExc_RuntimeError, "Input and output arrays should have matching number of dimensions, but input array `input' has %" PY_FORMAT_SIZE_T "d dimensions while output array `output' has %" PY_FORMAT_SIZE_T "d dimensions", input->ndim, output->ndim);
+    return 0;
+  }
+
+  if (output && output->shape[0] != (Py_ssize_t)self->cxx->getHeight()) {
+    PyErr_Format(PyExc_RuntimeError, "2D `output' array should have %" PY_FORMAT_SIZE_T "d rows matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getHeight(), Py_TYPE(self)->tp_name, output->shape[0]);
+    return 0;
+  }
+
+  if (output && output->shape[1] != (Py_ssize_t)self->cxx->getWidth()) {
+    PyErr_Format(PyExc_RuntimeError, "2D `output' array should have %" PY_FORMAT_SIZE_T "d columns matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getWidth(), Py_TYPE(self)->tp_name, output->shape[1]);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    Py_ssize_t size[2];
+    size[0] = self->cxx->getHeight();
+    size[1] = self->cxx->getWidth();
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, 2, size);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<float,2>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,2>(input),
+          *PyBlitzArrayCxx_AsBlitz<double,2>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpIRFFT2D_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_fft2d_str,                              /*tp_name*/
+    sizeof(PyBobSpIRFFT2DObject),         /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpIRFFT2D_Delete,    /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpIRFFT2D_Repr,        /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpIRFFT2D_Call,     /* tp_call */
+    (reprfunc)PyBobSpIRFFT2D_Repr,        /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_fft2d_doc,                              /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpIRFFT2D_RichCompare, /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    0,                                        /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpIRFFT2D_getseters,             /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpIRFFT2D_Init,        /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
@@ -22,10 +22,23 @@ extern PyTypeObject PyBobSpFFT1D_Type;
 extern PyTypeObject PyBobSpIFFT1D_Type;
 extern PyTypeObject PyBobSpFFT2D_Type;
 extern PyTypeObject PyBobSpIFFT2D_Type;
+extern PyTypeObject PyBobSpFFTND_Type;
+extern PyTypeObject PyBobSpIFFTND_Type;
+extern PyTypeObject PyBobSpRFFT1D_Type;
+extern PyTypeObject PyBobSpIRFFT1D_Type;
+extern PyTypeObject PyBobSpPrunedFFT1D_Type;
+extern PyTypeObject PyBobSpPrunedIFFT1D_Type;
+extern PyTypeObject PyBobSpSlidingDFT_Type;
+extern PyTypeObject PyBobSpGoertzel_Type;
+extern PyTypeObject PyBobSpChirpZ_Type;
+extern PyTypeObject PyBobSpRFFT2D_Type;
+extern PyTypeObject PyBobSpIRFFT2D_Type;
 extern PyTypeObject PyBobSpDCT1D_Type;
 extern PyTypeObject PyBobSpIDCT1D_Type;
 extern PyTypeObject PyBobSpDCT2D_Type;
 extern PyTypeObject PyBobSpIDCT2D_Type;
+extern PyTypeObject PyBobSpDCTND_Type;
+extern PyTypeObject PyBobSpIDCTND_Type;
 extern PyTypeObject PyBobSpExtrapolationBorder_Type;
 extern PyTypeObject PyBobSpQuantization_Type;
 
@@ -47,23 +60,27 @@ PyDoc_STRVAR(s_fft_str, "fft");
 PyDoc_STRVAR(s_fft_doc,
 "fft(src, [dst]) -> array\n\
 \n\
-Computes the direct Fast Fourier Transform of a 1D or 2D\n\
-array/signal of type ``complex128``. Allocates a new output\n\
+Computes the direct Fast Fourier Transform of an array/signal\n\
+of 1 to 4 dimensions, of type ``complex128``. Allocates a new output\n\
 array if ``dst`` is not provided. If it is, then it must\n\
-be of the same type and shape as ``src``.\n\
+be of the same type and shape as ``src``. It may also be\n\
+``src`` itself, in which case the transform is computed\n\
+in-place. Arrays of type ``complex64`` are also accepted, in which\n\
+case the transform is computed in single precision, and the\n\
+output is of type ``complex64`` as well.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-  [array] A 1 or 2-dimensional array of type ``complex128``\n\
+  [array] A 1 to 4-dimensional array of type ``complex128``\n\
   in which the FFT operation will be performed.\n\
 \n\
 dst\n\
-  [array, optional] A 1 or 2-dimensional array of type\n\
+  [array, optional] A 1 to 4-dimensional array of type\n\
   ``complex128`` and matching dimensions to ``src`` in\n\
   which the result of the operation will be stored.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
+Returns a 1 to 4-dimensional array, of the same dimension\n\
 as ``src``, of type ``complex128``, containing the FFT of\n\
 the input signal.\n\
 ");
@@ -73,23 +90,27 @@ PyDoc_STRVAR(s_ifft_str, "ifft");
 PyDoc_STRVAR(s_ifft_doc,
 "ifft(src, [dst]) -> array\n\
 \n\
-Computes the inverse Fast Fourier Transform of a 1D or 2D\n\
-transform of type ``complex128``. Allocates a new output\n\
+Computes the inverse Fast Fourier Transform of a transform\n\
+of 1 to 4 dimensions, of type ``complex128``. Allocates a new output\n\
 array if ``dst`` is not provided. If it is, then it must\n\
-be of the same type and shape as ``src``.\n\
+be of the same type and shape as ``src``. It may also be\n\
+``src`` itself, in which case the transform is computed\n\
+in-place. Arrays of type ``complex64`` are also accepted, in which\n\
+case the transform is computed in single precision, and the\n\
+output is of type ``complex64`` as well.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-  [array] A 1 or 2-dimensional array of type ``complex128``\n\
+  [array] A 1 to 4-dimensional array of type ``complex128``\n\
   in which the inverse FFT operation will be performed.\n\
 \n\
 dst\n\
-  [array, optional] A 1 or 2-dimensional array of type\n\
+  [array, optional] A 1 to 4-dimensional array of type\n\
   ``complex128`` and matching dimensions to ``src`` in\n\
   which the result of the operation will be stored.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
+Returns a 1 to 4-dimensional array, of the same dimension\n\
 as ``src``, of type ``complex128``, containing the inverse\n\
 FFT of the input transform.\n\
 ");
@@ -99,25 +120,32 @@ PyDoc_STRVAR(s_fftshift_str, "fftshift");
 PyDoc_STRVAR(s_fftshift_doc,
 "fftshift(src, [dst]) -> array\n\
 \n\
-If a 1D complex128 array is passed, inverses the two halves\n\
-of that array and returns the result as a new array. If a 2D\n\
-``complex128`` array is passed, swaps the four quadrants of\n\
-the array and returns the result as a new array.\n\
+If a 1D array is passed, inverses the two halves of that array\n\
+and returns the result as a new array. If a 2D array is passed,\n\
+swaps the four quadrants of the array and returns the result as\n\
+a new array. Arrays of more dimensions have their halves swapped\n\
+along each dimension. The zero frequency of a spectrum is then\n\
+moved to the center of the array.\n\
+\n\
+If ``dst`` is ``src`` itself, the shift is done in place, without\n\
+any temporary if ``src`` is C-contiguous, for all extents\n\
+(including odd ones). Other views of the data of ``src`` (e.g.\n\
+slices, or reversed or transposed arrays) are shifted through a\n\
+copy.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-[array] A 1 or 2-dimensional array of type ``complex128``\n\
-with the signal to be shifted.\n\
+[array] A 1 to 4-dimensional array of type ``complex128`` or\n\
+``complex64`` with the signal to be shifted.\n\
 \n\
 dst\n\
-[array, optional] A 1 or 2-dimensional array of type\n\
-``complex128`` and matching dimensions to ``src`` in\n\
-which the result of the operation will be stored.\n\
+[array, optional] An array of the type and dimensions of\n\
+``src`` in which the result of the operation will be stored,\n\
+or ``src`` itself.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
-as ``src``, of type ``complex128``, containing the shifted\n\
-version of theinput.\n\
+Returns an array of the type and dimensions of ``src``,\n\
+containing the shifted version of the input.\n\
 ");
 PyObject* fftshift(PyObject*, PyObject* args, PyObject* kwds);
 
@@ -125,23 +153,23 @@ PyDoc_STRVAR(s_ifftshift_str, "ifftshift");
 PyDoc_STRVAR(s_ifftshift_doc,
 "ifftshift(src, [dst]) -> array\n\
 \n\
-This method undoes what :py:meth:`fftshift` does. It accepts\n\
-1 or 2-dimensional arrays of type ``complex128``.\n\
+This method undoes what :py:meth:`fftshift` does, which is\n\
+different for dimensions of odd size. It accepts the same\n\
+arrays, and is done in place if ``dst`` is ``src`` itself.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-[array] A 1 or 2-dimensional array of type ``complex128``\n\
-with the signal to be shifted.\n\
+[array] A 1 to 4-dimensional array of type ``complex128`` or\n\
+``complex64`` with the signal to be shifted.\n\
 \n\
 dst\n\
-[array, optional] A 1 or 2-dimensional array of type\n\
-``complex128`` and matching dimensions to ``src`` in\n\
-which the result of the operation will be stored.\n\
+[array, optional] An array of the type and dimensions of\n\
+``src`` in which the result of the operation will be stored,\n\
+or ``src`` itself.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
-as ``src``, of type ``complex128``, containing the shifted\n\
-version of theinput.\n\
+Returns an array of the type and dimensions of ``src``,\n\
+containing the shifted version of the input.\n\
 ");
 PyObject* ifftshift(PyObject*, PyObject* args, PyObject* kwds);
 
@@ -149,23 +177,27 @@ PyDoc_STRVAR(s_dct_str, "dct");
 PyDoc_STRVAR(s_dct_doc,
 "dct(src, [dst]) -> array\n\
 \n\
-Computes the direct Discrete Cosine Transform of a 1D or 2D\n\
-array/signal of type ``float64``. Allocates a new output\n\
+Computes the direct Discrete Cosine Transform of an array/signal\n\
+of 1 to 4 dimensions, of type ``float64``. Allocates a new output\n\
 array if ``dst`` is not provided. If it is, then it must\n\
-be of the same type and shape as ``src``.\n\
+be of the same type and shape as ``src``. It may also be\n\
+``src`` itself, in which case the transform is computed\n\
+in-place. Arrays of type ``float32`` are also accepted, in which\n\
+case the transform is computed in single precision, and the\n\
+output is of type ``float32`` as well.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-  [array] A 1 or 2-dimensional array of type ``float64``\n\
+  [array] A 1 to 4-dimensional array of type ``float64``\n\
   in which the DCT operation will be performed.\n\
 \n\
 dst\n\
-  [array, optional] A 1 or 2-dimensional array of type\n\
+  [array, optional] A 1 to 4-dimensional array of type\n\
   ``float64`` and matching dimensions to ``src`` in\n\
   which the result of the operation will be stored.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
+Returns a 1 to 4-dimensional array, of the same dimension\n\
 as ``src``, of type ``float64``, containing the DCT of\n\
 the input signal.\n\
 ");
@@ -175,28 +207,172 @@ PyDoc_STRVAR(s_idct_str, "idct");
 PyDoc_STRVAR(s_idct_doc,
 "idct(src, [dst]) -> array\n\
 \n\
-Computes the inverse Discrete Cosinte Transform of a 1D or 2D\n\
-transform of type ``float64``. Allocates a new output\n\
+Computes the inverse Discrete Cosinte Transform of a transform\n\
+of 1 to 4 dimensions, of type ``float64``. Allocates a new output\n\
 array if ``dst`` is not provided. If it is, then it must\n\
-be of the same type and shape as ``src``.\n\
+be of the same type and shape as ``src``. It may also be\n\
+``src`` itself, in which case the transform is computed\n\
+in-place. Arrays of type ``float32`` are also accepted, in which\n\
+case the transform is computed in single precision, and the\n\
+output is of type ``float32`` as well.\n\
 \n\
 Parameters:\n\
 \n\
 src\n\
-  [array] A 1 or 2-dimensional array of type ``float64``\n\
+  [array] A 1 to 4-dimensional array of type ``float64``\n\
   in which the inverse DCT operation will be performed.\n\
 \n\
 dst\n\
-  [array, optional] A 1 or 2-dimensional array of type\n\
+  [array, optional] A 1 to 4-dimensional array of type\n\
   ``float64`` and matching dimensions to ``src`` in\n\
   which the result of the operation will be stored.\n\
 \n\
-Returns a 1 or 2-dimensional array, of the same dimension\n\
+Returns a 1 to 4-dimensional array, of the same dimension\n\
 as ``src``, of type ``float64``, containing the inverse\n\
 DCT of the input transform.\n\
 ");
 PyObject* idct(PyObject*, PyObject* args, PyObject* kwds);
 
+PyDoc_STRVAR(s_available_engines_str, "available_engines");
+PyDoc_STRVAR(s_available_engines_doc,
+"available_engines() -> list\n\
+\n\
+Returns the names of the engines which may be assigned to the\n\
+``engine`` attribute of the FFT and DCT transforms:\n\
+``'fftpack'`` (the default), ``'stockham'`` and ``'tuned'``,\n\
+plus ``'fftw'`` if the library was compiled with FFTW3. The\n\
+``'tuned'`` engine times several orders of the radix passes of\n\
+fftpack and the ``'stockham'`` engine the first time a length\n\
+is planned, and keeps the fastest (see\n\
+:py:func:`export_fft_tuning`).\n\
+");
+PyObject* available_engines(PyObject*);
+
+PyDoc_STRVAR(s_next_fast_length_str, "next_fast_length");
+PyDoc_STRVAR(s_next_fast_length_doc,
+"next_fast_length(n, engine='fftpack') -> int\n\
+\n\
+Returns the length >= ``n`` to which signals should be zero\n\
+padded before being transformed with the given engine, such as\n\
+the ``n = a+b-1`` samples of a convolution: a product of 2, 3, 5\n\
+and 7, which is the cheapest to transform. ``'fftw'`` gets the\n\
+smallest one, the other engines (which have no radix 7 pass) the\n\
+one of least estimated cost.\n\
+");
+PyObject* next_fast_length(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_fftconv_str, "fftconv");
+PyDoc_STRVAR(s_fftconv_doc,
+"fftconv(a, b, [c], [size='full']) -> array\n\
+\n\
+Computes the convolution of the 1D or 2D array ``a`` with the\n\
+kernel ``b`` (of the same number of dimensions, and no larger\n\
+than ``a`` along any of them) with FFTs. This costs\n\
+O((A+B)*log(A+B)) instead of O(A*B), which is faster unless the\n\
+kernel is small. The arrays are zero padded to the lengths given\n\
+by :py:func:`next_fast_length`, and the product is cropped.\n\
+Arrays of type ``float64`` and ``float32`` are accepted, ``b``\n\
+and ``c`` being of the same type as ``a``.\n\
+\n\
+Parameters:\n\
+\n\
+a\n\
+  [array] The 1D or 2D signal\n\
+\n\
+b\n\
+  [array] The kernel\n\
+\n\
+c\n\
+  [array, optional] The output array, allocated if not given\n\
+\n\
+size\n\
+  [str, optional] The part of the product which is returned:\n\
+  ``'full'`` (of size A+B-1, the default), ``'same'`` (of the size\n\
+  of ``a``, starting (B-1)//2 values into the full product, as\n\
+  :py:func:`numpy.convolve`), or ``'valid'`` (of size A-B+1, where\n\
+  the kernel does not overlap the padding)\n\
+\n\
+Returns the convolution ``c``.\n\
+");
+PyObject* fftconv(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_fftcorr_str, "fftcorr");
+PyDoc_STRVAR(s_fftcorr_doc,
+"fftcorr(a, b, [c], [size='full']) -> array\n\
+\n\
+Computes the correlation of the 1D or 2D array ``a`` with the\n\
+kernel ``b`` with FFTs: the convolution of ``a`` with ``b``\n\
+reversed along all its dimensions, with the same parameters and\n\
+output sizes as :py:func:`fftconv`. In 1D, the ``'valid'`` part\n\
+is ``c[i] = sum(a[i:i+B] * b)``, as :py:func:`numpy.correlate`.\n\
+");
+PyObject* fftcorr(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_scratch_bytes_str, "_scratch_bytes");
+PyDoc_STRVAR(s_scratch_bytes_doc,
+"_scratch_bytes() -> int\n\
+\n\
+Returns the number of bytes of scratch memory kept by the calling\n\
+thread for its next transforms (for the tests).\n\
+");
+PyObject* scratch_bytes(PyObject*);
+
+PyDoc_STRVAR(s_scratch_peak_str, "_scratch_peak");
+PyDoc_STRVAR(s_scratch_peak_doc,
+"_scratch_peak() -> int\n\
+\n\
+Returns the largest number of bytes of scratch memory in use at\n\
+once by the calling thread since the previous call (for the tests).\n\
+");
+PyObject* scratch_peak(PyObject*);
+
+PyDoc_STRVAR(s_import_fftw_wisdom_str, "import_fftw_wisdom");
+PyDoc_STRVAR(s_import_fftw_wisdom_doc,
+"import_fftw_wisdom(filename) -> None\n\
+\n\
+Merges the FFTW wisdom saved with :py:func:`export_fftw_wisdom`\n\
+(possibly by another process) into the current one. The transforms\n\
+using the ``'fftw'`` engine then reuse the plans it knows, instead\n\
+of measuring them again. Raises a :py:exc:`RuntimeError` if the\n\
+library was compiled without FFTW3, or if the file cannot be read.\n\
+");
+PyObject* import_fftw_wisdom(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_export_fftw_wisdom_str, "export_fftw_wisdom");
+PyDoc_STRVAR(s_export_fftw_wisdom_doc,
+"export_fftw_wisdom(filename) -> None\n\
+\n\
+Saves the FFTW wisdom gathered by the transforms using the\n\
+``'fftw'`` engine (and the imported one) to the given file.\n\
+Raises a :py:exc:`RuntimeError` if the library was compiled\n\
+without FFTW3, or if the file cannot be written.\n\
+");
+PyObject* export_fftw_wisdom(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_import_fft_tuning_str, "import_fft_tuning");
+PyDoc_STRVAR(s_import_fft_tuning_doc,
+"import_fft_tuning(filename) -> None\n\
+\n\
+Merges the measurements of the ``'tuned'`` engine saved with\n\
+:py:func:`export_fft_tuning` (possibly by another process) into\n\
+the current ones. The transforms then use the saved choices for\n\
+the lengths it covers, instead of measuring them again. Raises a\n\
+:py:exc:`RuntimeError` if the file cannot be read, or is not\n\
+valid (in which case nothing is merged).\n\
+");
+PyObject* import_fft_tuning(PyObject*, PyObject* args, PyObject* kwds);
+
+PyDoc_STRVAR(s_export_fft_tuning_str, "export_fft_tuning");
+PyDoc_STRVAR(s_export_fft_tuning_doc,
+"export_fft_tuning(filename) -> None\n\
+\n\
+Saves the measurements of the ``'tuned'`` engine (and the\n\
+imported ones) to the given text file, one length and precision\n\
+per line, along with the chosen engine and order of the factors.\n\
+Raises a :py:exc:`RuntimeError` if the file cannot be written.\n\
+");
+PyObject* export_fft_tuning(PyObject*, PyObject* args, PyObject* kwds);
+
 static PyMethodDef module_methods[] = {
     {
       s_extrapolate_str,
@@ -240,6 +416,66 @@ static PyMethodDef module_methods[] = {
       METH_VARARGS|METH_KEYWORDS,
       s_idct_doc
     },
+    {
+      s_available_engines_str,
+      (PyCFunction)available_engines,
+      METH_NOARGS,
+      s_available_engines_doc
+    },
+    {
+      s_next_fast_length_str,
+      (PyCFunction)next_fast_length,
+      METH_VARARGS|METH_KEYWORDS,
+      s_next_fast_length_doc
+    },
+    {
+      s_fftconv_str,
+      (PyCFunction)fftconv,
+      METH_VARARGS|METH_KEYWORDS,
+      s_fftconv_doc
+    },
+    {
+      s_fftcorr_str,
+      (PyCFunction)fftcorr,
+      METH_VARARGS|METH_KEYWORDS,
+      s_fftcorr_doc
+    },
+    {
+      s_scratch_bytes_str,
+      (PyCFunction)scratch_bytes,
+      METH_NOARGS,
+      s_scratch_bytes_doc
+    },
+    {
+      s_scratch_peak_str,
+      (PyCFunction)scratch_peak,
+      METH_NOARGS,
+      s_scratch_peak_doc
+    },
+    {
+      s_import_fftw_wisdom_str,
+      (PyCFunction)import_fftw_wisdom,
+      METH_VARARGS|METH_KEYWORDS,
+      s_import_fftw_wisdom_doc
+    },
+    {
+      s_export_fftw_wisdom_str,
+      (PyCFunction)export_fftw_wisdom,
+      METH_VARARGS|METH_KEYWORDS,
+      s_export_fftw_wisdom_doc
+    },
+    {
+      s_import_fft_tuning_str,
+      (PyCFunction)import_fft_tuning,
+      METH_VARARGS|METH_KEYWORDS,
+      s_import_fft_tuning_doc
+    },
+    {
+      s_export_fft_tuning_str,
+      (PyCFunction)export_fft_tuning,
+      METH_VARARGS|METH_KEYWORDS,
+      s_export_fft_tuning_doc
+    },
     {0}  /* Sentinel */
 };
 
@@ -270,6 +506,39 @@ static PyObject* create_module (void) {
   PyBobSpIFFT2D_Type.tp_new = PyType_GenericNew;
   if (PyType_Ready(&PyBobSpIFFT2D_Type) < 0) return 0;
 
+  PyBobSpFFTND_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpFFTND_Type) < 0) return 0;
+
+  PyBobSpIFFTND_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpIFFTND_Type) < 0) return 0;
+
+  PyBobSpRFFT1D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpRFFT1D_Type) < 0) return 0;
+
+  PyBobSpIRFFT1D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpIRFFT1D_Type) < 0) return 0;
+
+  PyBobSpPrunedFFT1D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpPrunedFFT1D_Type) < 0) return 0;
+
+  PyBobSpPrunedIFFT1D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpPrunedIFFT1D_Type) < 0) return 0;
+
+  PyBobSpSlidingDFT_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpSlidingDFT_Type) < 0) return 0;
+
+  PyBobSpGoertzel_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpGoertzel_Type) < 0) return 0;
+
+  PyBobSpChirpZ_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpChirpZ_Type) < 0) return 0;
+
+  PyBobSpRFFT2D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpRFFT2D_Type) < 0) return 0;
+
+  PyBobSpIRFFT2D_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpIRFFT2D_Type) < 0) return 0;
+
   PyBobSpDCT1D_Type.tp_new = PyType_GenericNew;
   if (PyType_Ready(&PyBobSpDCT1D_Type) < 0) return 0;
 
@@ -282,6 +551,12 @@ static PyObject* create_module (void) {
   PyBobSpIDCT2D_Type.tp_new = PyType_GenericNew;
   if (PyType_Ready(&PyBobSpIDCT2D_Type) < 0) return 0;
 
+  PyBobSpDCTND_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpDCTND_Type) < 0) return 0;
+
+  PyBobSpIDCTND_Type.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&PyBobSpIDCTND_Type) < 0) return 0;
+
   PyBobSpExtrapolationBorder_Type.tp_new = PyType_GenericNew;
   if (PyType_Ready(&PyBobSpExtrapolationBorder_Type) < 0) return 0;
 
@@ -311,6 +586,39 @@ static PyObject* create_module (void) {
   Py_INCREF(&PyBobSpIFFT2D_Type);
   if (PyModule_AddObject(m, "IFFT2D", (PyObject *)&PyBobSpIFFT2D_Type) < 0) return 0;
 
+  Py_INCREF(&PyBobSpFFTND_Type);
+  if (PyModule_AddObject(m, "FFTND", (PyObject *)&PyBobSpFFTND_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpIFFTND_Type);
+  if (PyModule_AddObject(m, "IFFTND", (PyObject *)&PyBobSpIFFTND_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpRFFT1D_Type);
+  if (PyModule_AddObject(m, "RFFT1D", (PyObject *)&PyBobSpRFFT1D_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpIRFFT1D_Type);
+  if (PyModule_AddObject(m, "IRFFT1D", (PyObject *)&PyBobSpIRFFT1D_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpPrunedFFT1D_Type);
+  if (PyModule_AddObject(m, "PrunedFFT1D", (PyObject *)&PyBobSpPrunedFFT1D_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpPrunedIFFT1D_Type);
+  if (PyModule_AddObject(m, "PrunedIFFT1D", (PyObject *)&PyBobSpPrunedIFFT1D_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpSlidingDFT_Type);
+  if (PyModule_AddObject(m, "SlidingDFT", (PyObject *)&PyBobSpSlidingDFT_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpGoertzel_Type);
+  if (PyModule_AddObject(m, "Goertzel", (PyObject *)&PyBobSpGoertzel_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpChirpZ_Type);
+  if (PyModule_AddObject(m, "ChirpZ", (PyObject *)&PyBobSpChirpZ_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpRFFT2D_Type);
+  if (PyModule_AddObject(m, "RFFT2D", (PyObject *)&PyBobSpRFFT2D_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpIRFFT2D_Type);
+  if (PyModule_AddObject(m, "IRFFT2D", (PyObject *)&PyBobSpIRFFT2D_Type) < 0) return 0;
+
   Py_INCREF(&PyBobSpDCT1D_Type);
   if (PyModule_AddObject(m, "DCT1D", (PyObject *)&PyBobSpDCT1D_Type) < 0) return 0;
 
@@ -323,6 +631,12 @@ static PyObject* create_module (void) {
   Py_INCREF(&PyBobSpIDCT2D_Type);
   if (PyModule_AddObject(m, "IDCT2D", (PyObject *)&PyBobSpIDCT2D_Type) < 0) return 0;
 
+  Py_INCREF(&PyBobSpDCTND_Type);
+  if (PyModule_AddObject(m, "DCTND", (PyObject *)&PyBobSpDCTND_Type) < 0) return 0;
+
+  Py_INCREF(&PyBobSpIDCTND_Type);
+  if (PyModule_AddObject(m, "IDCTND", (PyObject *)&PyBobSpIDCTND_Type) < 0) return 0;
+
   Py_INCREF(&PyBobSpExtrapolationBorder_Type);
   if (PyModule_AddObject(m, "BorderType", (PyObject *)&PyBobSpExtrapolationBorder_Type) < 0) return 0;
 
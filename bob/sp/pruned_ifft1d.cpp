@@ -0,0 +1,485 @@
+/**
+ * @date Sat Oct 17 13:52:19 CEST 2026
+ *
+ * @brief Python bindings to the inverse pruned FFT of 1D signals
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/PrunedFFT1D.h>
+
+/* Conversions of the engine names, defined in fft.cpp */
+PyObject* PyBobSpEngine_AsString(bob::sp::FFTPlanBase::Engine engine);
+int PyBobSpEngine_FromString(PyObject* o, bob::sp::FFTPlanBase::Engine* engine);
+
+PyDoc_STRVAR(s_ifft1d_str, BOB_EXT_MODULE_PREFIX ".PrunedIFFT1D");
+
+PyDoc_STRVAR(s_ifft1d_doc,
+"PrunedIFFT1D(length, input_length, output_length) -> new PrunedIFFT1D operator\n\
+\n\
+Calculates the first ``output_length`` values of the inverse FFT\n\
+of length ``length`` of a 1D spectrum of which only the first\n\
+``input_length`` values are given, the other ones being zero. This\n\
+is the same as ``IFFT1D(length)`` applied to the spectrum zero-padded\n\
+to ``length`` values and keeping the first ``output_length`` values\n\
+of the result, but the computations feeding only zeros or\n\
+discarded values are skipped. The input array is a 1D NumPy array\n\
+of type ``complex128`` with ``input_length`` elements, and the\n\
+output array a 1D NumPy array of type ``complex128`` with\n\
+``output_length`` elements.\n\
+\n\
+Single precision arrays (of type ``complex64``) are also accepted,\n\
+in which case the transform is computed in single precision.\n\
+"
+);
+
+/**
+ * Represents a PrunedIFFT1D
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::PrunedIFFT1D* cxx;
+} PyBobSpPrunedIFFT1DObject;
+
+extern PyTypeObject PyBobSpPrunedIFFT1D_Type; //forward declaration
+
+int PyBobSpPrunedIFFT1D_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpPrunedIFFT1D_Type));
+}
+
+static void PyBobSpPrunedIFFT1D_Delete (PyBobSpPrunedIFFT1DObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpPrunedIFFT1D_InitCopy
+(PyBobSpPrunedIFFT1DObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpPrunedIFFT1D_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpPrunedIFFT1DObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::PrunedIFFT1D(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpPrunedIFFT1D_InitLengths(PyBobSpPrunedIFFT1DObject* self,
+    PyObject *args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"length", "input_length", "output_length", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t length = 0;
+  Py_ssize_t input_length = 0;
+  Py_ssize_t output_length = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "nnn", kwlist,
+        &length, &input_length, &output_length)) return -1;
+
+  if (length < 0 || input_length < 0 || output_length < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' lengths cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  try {
+    self->cxx = new bob::sp::PrunedIFFT1D(length, input_length, output_length);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpPrunedIFFT1D_Init(PyBobSpPrunedIFFT1DObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+
+      {
+
+        PyObject* arg = 0; ///< borrowed (don't delete)
+        if (PyTuple_Size(args)) arg = PyTuple_GET_ITEM(args, 0);
+        else {
+          PyObject* tmp = PyDict_Values(kwds);
+          auto tmp_ = make_safe(tmp);
+          arg = PyList_GET_ITEM(tmp, 0);
+        }
+
+        if (PyBobSpPrunedIFFT1D_Check(arg)) {
+          return PyBobSpPrunedIFFT1D_InitCopy(self, args, kwds);
+        }
+
+        PyErr_Format(PyExc_TypeError, "cannot initialize `%s' with `%s' (see help)", Py_TYPE(self)->tp_name, Py_TYPE(arg)->tp_name);
+
+      }
+
+      break;
+
+    case 3:
+
+      return PyBobSpPrunedIFFT1D_InitLengths(self, args, kwds);
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 or 3 arguments, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpPrunedIFFT1D_Repr(PyBobSpPrunedIFFT1DObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(length=%zu, input_length=%zu, output_length=%zu)",
+   Py_TYPE(self)->tp_name, self->cxx->getLength(),
+   self->cxx->getInputLength(), self->cxx->getOutputLength());
+}
+
+static PyObject* PyBobSpPrunedIFFT1D_RichCompare (PyBobSpPrunedIFFT1DObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpPrunedIFFT1D_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpPrunedIFFT1DObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+/**
+ * Resets one of the three lengths, keeping the two other ones
+ */
+static int PyBobSpPrunedIFFT1D_SetLengths
+(PyBobSpPrunedIFFT1DObject* self, PyObject* o, const char* name, int which) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' %s can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (len < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' %s cannot be negative", Py_TYPE(self)->tp_name, name);
+    return -1;
+  }
+
+  size_t lengths[3] = {self->cxx->getLength(), self->cxx->getInputLength(),
+    self->cxx->getOutputLength()};
+  lengths[which] = len;
+
+  try {
+    self->cxx->setLength(lengths[0], lengths[1], lengths[2]);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `%s' of %s: unknown exception caught", name, Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_length_str, "length");
+PyDoc_STRVAR(s_length_doc,
+"The length of the transform (of the zero-padded signal)\n\
+");
+
+static PyObject* PyBobSpPrunedIFFT1D_GetLength
+(PyBobSpPrunedIFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getLength());
+}
+
+static int PyBobSpPrunedIFFT1D_SetLength
+(PyBobSpPrunedIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+  return PyBobSpPrunedIFFT1D_SetLengths(self, o, s_length_str, 0);
+}
+
+PyDoc_STRVAR(s_input_length_str, "input_length");
+PyDoc_STRVAR(s_input_length_doc,
+"The length of the input vector, which is implicitly zero-padded\n\
+to :py:attr:`length` values (at most :py:attr:`length`)\n\
+");
+
+static PyObject* PyBobSpPrunedIFFT1D_GetInputLength
+(PyBobSpPrunedIFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getInputLength());
+}
+
+static int PyBobSpPrunedIFFT1D_SetInputLength
+(PyBobSpPrunedIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+  return PyBobSpPrunedIFFT1D_SetLengths(self, o, s_input_length_str, 1);
+}
+
+PyDoc_STRVAR(s_output_length_str, "output_length");
+PyDoc_STRVAR(s_output_length_doc,
+"The length of the output vector: the number of values of the\n\
+transform which are computed (at most :py:attr:`length`)\n\
+");
+
+static PyObject* PyBobSpPrunedIFFT1D_GetOutputLength
+(PyBobSpPrunedIFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getOutputLength());
+}
+
+static int PyBobSpPrunedIFFT1D_SetOutputLength
+(PyBobSpPrunedIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+  return PyBobSpPrunedIFFT1D_SetLengths(self, o, s_output_length_str, 2);
+}
+
+PyDoc_STRVAR(s_engine_str, "engine");
+PyDoc_STRVAR(s_engine_doc,
+"The backend computing the inner transforms: ``'fftpack'``\n\
+(default), ``'stockham'``, a native Stockham autosort engine,\n\
+``'tuned'``, which times fftpack with several orders of the\n\
+factors of the length and the Stockham engine when the length is\n\
+first planned, and keeps the fastest, or ``'fftw'``, if the\n\
+library was compiled with FFTW3 (see\n\
+:py:func:`available_engines`).\n\
+");
+
+static PyObject* PyBobSpPrunedIFFT1D_GetEngine
+(PyBobSpPrunedIFFT1DObject* self, void* /*closure*/) {
+  return PyBobSpEngine_AsString(self->cxx->getEngine());
+}
+
+static int PyBobSpPrunedIFFT1D_SetEngine
+(PyBobSpPrunedIFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  bob::sp::FFTPlanBase::Engine engine;
+  if (PyBobSpEngine_FromString(o, &engine) < 0) return -1;
+
+  try {
+    self->cxx->setEngine(engine);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `engine' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static PyGetSetDef PyBobSpPrunedIFFT1D_getseters[] = {
+    {
+      s_length_str,
+      (getter)PyBobSpPrunedIFFT1D_GetLength,
+      (setter)PyBobSpPrunedIFFT1D_SetLength,
+      s_length_doc,
+      0
+    },
+    {
+      s_input_length_str,
+      (getter)PyBobSpPrunedIFFT1D_GetInputLength,
+      (setter)PyBobSpPrunedIFFT1D_SetInputLength,
+      s_input_length_doc,
+      0
+    },
+    {
+      s_output_length_str,
+      (getter)PyBobSpPrunedIFFT1D_GetOutputLength,
+      (setter)PyBobSpPrunedIFFT1D_SetOutputLength,
+      s_output_length_doc,
+      0
+    },
+    {
+      s_engine_str,
+      (getter)PyBobSpPrunedIFFT1D_GetEngine,
+      (setter)PyBobSpPrunedIFFT1D_SetEngine,
+      s_engine_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+static PyObject* PyBobSpPrunedIFFT1D_Call
+(PyBobSpPrunedIFFT1DObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_COMPLEX128 && input->type_num != NPY_COMPLEX64) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) or 64-bit complex (2x32-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_COMPLEX64);
+  const int output_type = (single ? NPY_COMPLEX64 : NPY_COMPLEX128);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)", single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)");
+    return 0;
+  }
+
+  if (input->ndim != 1) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && input->ndim != output->ndim) {
+    PyErr_Format(PyExc_RuntimeError, "Input and output arrays should have matching number of dimensions, but input array `input' has %" PY_FORMAT_SIZE_T "d dimensions while output array `output' has %" PY_FORMAT_SIZE_T "d dimensions", input->ndim, output->ndim);
+    return 0;
+  }
+
+  if (output && output->shape[0] != (Py_ssize_t)self->cxx->getOutputLength()) {
+    PyErr_Format(PyExc_RuntimeError, "1D `output' array should have %" PY_FORMAT_SIZE_T "d elements matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getOutputLength(), Py_TYPE(self)->tp_name, output->shape[0]);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    Py_ssize_t length = self->cxx->getOutputLength();
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, 1, &length);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpPrunedIFFT1D_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_ifft1d_str,                              /*tp_name*/
+    sizeof(PyBobSpPrunedIFFT1DObject),         /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpPrunedIFFT1D_Delete,    /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpPrunedIFFT1D_Repr,        /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpPrunedIFFT1D_Call,     /* tp_call */
+    (reprfunc)PyBobSpPrunedIFFT1D_Repr,        /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_ifft1d_doc,                              /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpPrunedIFFT1D_RichCompare, /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    0,                                        /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpPrunedIFFT1D_getseters,             /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpPrunedIFFT1D_Init,        /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
@@ -0,0 +1,429 @@
+/**
+ * @date Fri Oct 16 13:58:40 CEST 2026
+ *
+ * @brief Python bindings to the direct FFT of real 1D signals
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/RFFT1D.h>
+
+PyDoc_STRVAR(s_fft1d_str, BOB_EXT_MODULE_PREFIX ".RFFT1D");
+
+PyDoc_STRVAR(s_fft1d_doc,
+"RFFT1D(shape) -> new RFFT1D operator\n\
+\n\
+Calculates the direct FFT of a real 1D array/signal. The input\n\
+array is a 1D NumPy array of type ``float64`` and ``length``\n\
+elements. As the spectrum of a real signal is hermitian-symmetric,\n\
+only its ``length//2+1`` first (non-redundant) bins are computed:\n\
+the output array is a 1D NumPy array of type ``complex128`` with\n\
+``length//2+1`` elements.\n\
+\n\
+Single precision arrays (``complex64`` instead of ``complex128``,\n\
+``float32`` instead of ``float64``) are also accepted, in which case\n\
+the transform is computed in single precision.\n\
+"
+);
+
+/**
+ * Represents either an RFFT1D
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::RFFT1D* cxx;
+} PyBobSpRFFT1DObject;
+
+extern PyTypeObject PyBobSpRFFT1D_Type; //forward declaration
+
+int PyBobSpRFFT1D_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpRFFT1D_Type));
+}
+
+static void PyBobSpRFFT1D_Delete (PyBobSpRFFT1DObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpRFFT1D_InitCopy
+(PyBobSpRFFT1DObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpRFFT1D_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpRFFT1DObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::RFFT1D(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpRFFT1D_InitShape(PyBobSpRFFT1DObject* self, PyObject *args,
+    PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"length", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t length = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "n", kwlist, &length)) return -1;
+
+  try {
+    self->cxx = new bob::sp::RFFT1D(length);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpRFFT1D_Init(PyBobSpRFFT1DObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+
+      {
+
+        PyObject* arg = 0; ///< borrowed (don't delete)
+        if (PyTuple_Size(args)) arg = PyTuple_GET_ITEM(args, 0);
+        else {
+          PyObject* tmp = PyDict_Values(kwds);
+          auto tmp_ = make_safe(tmp);
+          arg = PyList_GET_ITEM(tmp, 0);
+        }
+
+        if (PyBob_NumberCheck(arg)) {
+          return PyBobSpRFFT1D_InitShape(self, args, kwds);
+        }
+
+        if (PyBobSpRFFT1D_Check(arg)) {
+          return PyBobSpRFFT1D_InitCopy(self, args, kwds);
+        }
+
+        PyErr_Format(PyExc_TypeError, "cannot initialize `%s' with `%s' (see help)", Py_TYPE(self)->tp_name, Py_TYPE(arg)->tp_name);
+
+      }
+
+      break;
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 argument, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpRFFT1D_Repr(PyBobSpRFFT1DObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(length=%zu)", Py_TYPE(self)->tp_name, self->cxx->getLength());
+}
+
+static PyObject* PyBobSpRFFT1D_RichCompare (PyBobSpRFFT1DObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpRFFT1D_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpRFFT1DObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_length_str, "length");
+PyDoc_STRVAR(s_length_doc,
+"The length of the (real) input vector\n\
+");
+
+static PyObject* PyBobSpRFFT1D_GetLength
+(PyBobSpRFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getLength());
+}
+
+static int PyBobSpRFFT1D_SetLength
+(PyBobSpRFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' length can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setLength(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `length' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_shape_str, "shape");
+PyDoc_STRVAR(s_shape_doc,
+"A tuple that represents the size of the (real) input vector\n\
+");
+
+static PyObject* PyBobSpRFFT1D_GetShape
+(PyBobSpRFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("(n)", self->cxx->getLength());
+}
+
+static int PyBobSpRFFT1D_SetShape
+(PyBobSpRFFT1DObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PySequence_Check(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' shape can only be set using tuples (or sequences), not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  PyObject* shape = PySequence_Tuple(o);
+  auto shape_ = make_safe(shape);
+
+  if (PyTuple_GET_SIZE(shape) != 1) {
+    PyErr_Format(PyExc_RuntimeError, "`%s' shape can only be set using 1-position tuples (or sequences), not an %" PY_FORMAT_SIZE_T "d-position sequence", Py_TYPE(self)->tp_name, PyTuple_GET_SIZE(shape));
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(PyTuple_GET_ITEM(shape, 0), PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  try {
+    self->cxx->setLength(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `shape' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_spectrum_length_str, "spectrum_length");
+PyDoc_STRVAR(s_spectrum_length_doc,
+"The number of non-redundant bins of the spectrum (``length//2+1``)\n\
+");
+
+static PyObject* PyBobSpRFFT1D_GetSpectrumLength
+(PyBobSpRFFT1DObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getSpectrumLength());
+}
+
+static PyGetSetDef PyBobSpRFFT1D_getseters[] = {
+    {
+      s_length_str,
+      (getter)PyBobSpRFFT1D_GetLength,
+      (setter)PyBobSpRFFT1D_SetLength,
+      s_length_doc,
+      0
+    },
+    {
+      s_shape_str,
+      (getter)PyBobSpRFFT1D_GetShape,
+      (setter)PyBobSpRFFT1D_SetShape,
+      s_shape_doc,
+      0
+    },
+    {
+      s_spectrum_length_str,
+      (getter)PyBobSpRFFT1D_GetSpectrumLength,
+      0,
+      s_spectrum_length_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+static PyObject* PyBobSpRFFT1D_Call
+(PyBobSpRFFT1DObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_FLOAT64 && input->type_num != NPY_FLOAT32) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit float or 32-bit float arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  // single precision inputs are transformed in single precision
+  const bool single = (input->type_num == NPY_FLOAT32);
+  const int output_type = (single ? NPY_COMPLEX64 : NPY_COMPLEX128);
+
+  if (output && output->type_num != output_type) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports %s arrays for output array `output', as input array `input' is of type %s", Py_TYPE(self)->tp_name, single ? "64-bit complex (2x32-bit float)" : "128-bit complex (2x64-bit float)", single ? "32-bit float" : "64-bit float");
+    return 0;
+  }
+
+  if (input->ndim != 1) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && input->ndim != output->ndim) {
+    PyErr_Format(PyExc_RuntimeError, "Input and output arrays should have matching number of dimensions, but input array `input' has %" PY_FORMAT_SIZE_T "d dimensions while output array `output' has %" PY_FORMAT_SIZE_T "d dimensions", input->ndim, output->ndim);
+    return 0;
+  }
+
+  if (output && output->shape[0] != (Py_ssize_t)self->cxx->getSpectrumLength()) {
+    PyErr_Format(PyExc_RuntimeError, "1D `output' array should have %" PY_FORMAT_SIZE_T "d elements matching `%s' output size, not %" PY_FORMAT_SIZE_T "d elements", self->cxx->getSpectrumLength(), Py_TYPE(self)->tp_name, output->shape[0]);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    Py_ssize_t length = self->cxx->getSpectrumLength();
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(output_type, 1, &length);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (single)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<float,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<float>,1>(output));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,1>(input),
+          *PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpRFFT1D_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_fft1d_str,                              /*tp_name*/
+    sizeof(PyBobSpRFFT1DObject),          /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpRFFT1D_Delete,     /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpRFFT1D_Repr,         /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpRFFT1D_Call,      /* tp_call */
+    (reprfunc)PyBobSpRFFT1D_Repr,         /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_fft1d_doc,                              /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpRFFT1D_RichCompare, /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    0,                                        /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpRFFT1D_getseters,              /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpRFFT1D_Init,         /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
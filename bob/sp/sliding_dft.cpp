@@ -0,0 +1,570 @@
+/**
+ * @date Sat Oct 17 15:02:44 CEST 2026
+ *
+ * @brief Python bindings to the sliding DFT of streams of samples
+ *
+ * Copyright (C) Idiap Research Institute, Martigny, Switzerland
+ */
+
+#include <bob.blitz/cppapi.h>
+#include <bob.blitz/cleanup.h>
+#include <bob.extension/defines.h>
+#include <bob.sp/SlidingDFT.h>
+
+PyDoc_STRVAR(s_sliding_dft_str, BOB_EXT_MODULE_PREFIX ".SlidingDFT");
+
+PyDoc_STRVAR(s_sliding_dft_doc,
+"SlidingDFT(length, [bins]) -> new SlidingDFT operator\n\
+\n\
+Keeps the DFT of the last ``length`` samples of a stream, and\n\
+updates it as new samples are pushed, instead of transforming the\n\
+whole window again: the window moving by ``h`` samples costs\n\
+``O(h)`` per monitored bin, hence ``O(h*length)`` for the whole\n\
+spectrum, or ``O(h*k)`` when only ``k`` bins are monitored. When\n\
+the hop is large enough for an FFT of the window to be cheaper,\n\
+the spectrum is recomputed instead.\n\
+\n\
+Samples are pushed by calling the operator with 1D NumPy arrays\n\
+of type ``float64`` or ``complex128`` (of any size), which returns\n\
+the updated spectrum, a 1D NumPy array of type ``complex128`` with\n\
+the values of the monitored :py:attr:`bins`, in their order (all\n\
+the bins by default). Before any sample is pushed, the window is\n\
+full of zeros.\n\
+\n\
+As the rounding errors of the updates accumulate, the spectrum is\n\
+recomputed exactly from the window every\n\
+:py:attr:`refresh_interval` samples.\n\
+"
+);
+
+/**
+ * Represents a SlidingDFT
+ */
+typedef struct {
+  PyObject_HEAD
+  bob::sp::SlidingDFT* cxx;
+} PyBobSpSlidingDFTObject;
+
+extern PyTypeObject PyBobSpSlidingDFT_Type; //forward declaration
+
+int PyBobSpSlidingDFT_Check(PyObject* o) {
+  return PyObject_IsInstance(o, reinterpret_cast<PyObject*>(&PyBobSpSlidingDFT_Type));
+}
+
+/**
+ * Converts a sequence of bins
+ */
+static bool PyBobSpSlidingDFT_AsBins(PyObject* self, PyObject* o,
+    std::vector<size_t>& bins) {
+
+  if (!PySequence_Check(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' bins can only be set using tuples (or sequences), not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return false;
+  }
+
+  PyObject* tuple = PySequence_Tuple(o);
+  if (!tuple) return false;
+  auto tuple_ = make_safe(tuple);
+
+  bins.clear();
+  for (Py_ssize_t i=0; i<PyTuple_GET_SIZE(tuple); ++i) {
+    Py_ssize_t v = PyNumber_AsSsize_t(PyTuple_GET_ITEM(tuple, i), PyExc_OverflowError);
+    if (PyErr_Occurred()) return false;
+    if (v < 0) {
+      PyErr_Format(PyExc_ValueError, "`%s' bins cannot be negative", Py_TYPE(self)->tp_name);
+      return false;
+    }
+    bins.push_back(v);
+  }
+
+  return true;
+
+}
+
+static void PyBobSpSlidingDFT_Delete (PyBobSpSlidingDFTObject* o) {
+
+  delete o->cxx;
+  Py_TYPE(o)->tp_free((PyObject*)o);
+
+}
+
+static int PyBobSpSlidingDFT_InitCopy
+(PyBobSpSlidingDFTObject* self, PyObject* args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"other", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyObject* other = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!", kwlist,
+        &PyBobSpSlidingDFT_Type, &other)) return -1;
+
+  auto copy = reinterpret_cast<PyBobSpSlidingDFTObject*>(other);
+
+  try {
+    self->cxx = new bob::sp::SlidingDFT(*(copy->cxx));
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+static int PyBobSpSlidingDFT_InitLength(PyBobSpSlidingDFTObject* self,
+    PyObject *args, PyObject* kwds) {
+
+  /* Parses input arguments in a single shot */
+  static const char* const_kwlist[] = {"length", "bins", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  Py_ssize_t length = 0;
+  PyObject* o = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|O", kwlist, &length, &o))
+    return -1;
+
+  if (length < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  std::vector<size_t> bins;
+  if (o && !PyBobSpSlidingDFT_AsBins((PyObject*)self, o, bins)) return -1;
+
+  try {
+    if (o) self->cxx = new bob::sp::SlidingDFT(length, bins);
+    else self->cxx = new bob::sp::SlidingDFT(length);
+    if (!self->cxx) {
+      PyErr_Format(PyExc_MemoryError, "cannot create new object of type `%s' - no more memory", Py_TYPE(self)->tp_name);
+      return -1;
+    }
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot create new object of type `%s' - unknown exception thrown", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0; ///< SUCCESS
+
+}
+
+static int PyBobSpSlidingDFT_Init(PyBobSpSlidingDFTObject* self,
+    PyObject* args, PyObject* kwds) {
+
+  Py_ssize_t nargs = (args?PyTuple_Size(args):0) + (kwds?PyDict_Size(kwds):0);
+
+  switch (nargs) {
+
+    case 1:
+
+      {
+
+        PyObject* arg = 0; ///< borrowed (don't delete)
+        if (PyTuple_Size(args)) arg = PyTuple_GET_ITEM(args, 0);
+        else {
+          PyObject* tmp = PyDict_Values(kwds);
+          auto tmp_ = make_safe(tmp);
+          arg = PyList_GET_ITEM(tmp, 0);
+        }
+
+        if (PyBob_NumberCheck(arg)) {
+          return PyBobSpSlidingDFT_InitLength(self, args, kwds);
+        }
+
+        if (PyBobSpSlidingDFT_Check(arg)) {
+          return PyBobSpSlidingDFT_InitCopy(self, args, kwds);
+        }
+
+        PyErr_Format(PyExc_TypeError, "cannot initialize `%s' with `%s' (see help)", Py_TYPE(self)->tp_name, Py_TYPE(arg)->tp_name);
+
+      }
+
+      break;
+
+    case 2:
+
+      return PyBobSpSlidingDFT_InitLength(self, args, kwds);
+
+    default:
+
+      PyErr_Format(PyExc_RuntimeError, "number of arguments mismatch - %s requires 1 or 2 arguments, but you provided %" PY_FORMAT_SIZE_T "d (see help)", Py_TYPE(self)->tp_name, nargs);
+
+  }
+
+  return -1;
+
+}
+
+static PyObject* PyBobSpSlidingDFT_Repr(PyBobSpSlidingDFTObject* self) {
+  return
+# if PY_VERSION_HEX >= 0x03000000
+  PyUnicode_FromFormat
+# else
+  PyString_FromFormat
+# endif
+  ("%s(length=%zu, bins=%zu)", Py_TYPE(self)->tp_name,
+   self->cxx->getLength(), self->cxx->getBins().size());
+}
+
+static PyObject* PyBobSpSlidingDFT_RichCompare (PyBobSpSlidingDFTObject* self,
+    PyObject* other, int op) {
+
+  if (!PyBobSpSlidingDFT_Check(other)) {
+    PyErr_Format(PyExc_TypeError, "cannot compare `%s' with `%s'",
+        Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+    return 0;
+  }
+
+  auto other_ = reinterpret_cast<PyBobSpSlidingDFTObject*>(other);
+
+  switch (op) {
+    case Py_EQ:
+      if (self->cxx->operator==(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    case Py_NE:
+      if (self->cxx->operator!=(*other_->cxx)) Py_RETURN_TRUE;
+      Py_RETURN_FALSE;
+      break;
+    default:
+      Py_INCREF(Py_NotImplemented);
+      return Py_NotImplemented;
+  }
+
+}
+
+PyDoc_STRVAR(s_length_str, "length");
+PyDoc_STRVAR(s_length_doc,
+"The length of the window. Setting it monitors all the bins of\n\
+the new window, which is filled with zeros, and resets\n\
+:py:attr:`refresh_interval` to its default (16 windows).\n\
+");
+
+static PyObject* PyBobSpSlidingDFT_GetLength
+(PyBobSpSlidingDFTObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getLength());
+}
+
+static int PyBobSpSlidingDFT_SetLength
+(PyBobSpSlidingDFTObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' length can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t len = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (len < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' length cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  try {
+    self->cxx->setLength(len);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `length' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_bins_str, "bins");
+PyDoc_STRVAR(s_bins_doc,
+"A tuple with the monitored bins, in ``[0, length[``, in the\n\
+order of the spectrum. Setting them computes their values from\n\
+the current window.\n\
+");
+
+static PyObject* PyBobSpSlidingDFT_GetBins
+(PyBobSpSlidingDFTObject* self, void* /*closure*/) {
+
+  const std::vector<size_t>& bins = self->cxx->getBins();
+  PyObject* retval = PyTuple_New(bins.size());
+  if (!retval) return 0;
+  auto retval_ = make_safe(retval);
+
+  for (size_t i=0; i<bins.size(); ++i) {
+    PyObject* v = Py_BuildValue("n", bins[i]);
+    if (!v) return 0;
+    PyTuple_SET_ITEM(retval, i, v);
+  }
+
+  Py_INCREF(retval);
+  return retval;
+
+}
+
+static int PyBobSpSlidingDFT_SetBins
+(PyBobSpSlidingDFTObject* self, PyObject* o, void* /*closure*/) {
+
+  std::vector<size_t> bins;
+  if (!PyBobSpSlidingDFT_AsBins((PyObject*)self, o, bins)) return -1;
+
+  try {
+    self->cxx->setBins(bins);
+  }
+  catch (std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return -1;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "cannot reset `bins' of %s: unknown exception caught", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_refresh_interval_str, "refresh_interval");
+PyDoc_STRVAR(s_refresh_interval_doc,
+"The number of pushed samples after which the spectrum is\n\
+recomputed exactly from the window, to drop the rounding errors\n\
+accumulated by the updates (16 windows by default, 0 to never\n\
+recompute it)\n\
+");
+
+static PyObject* PyBobSpSlidingDFT_GetRefreshInterval
+(PyBobSpSlidingDFTObject* self, void* /*closure*/) {
+  return Py_BuildValue("n", self->cxx->getRefreshInterval());
+}
+
+static int PyBobSpSlidingDFT_SetRefreshInterval
+(PyBobSpSlidingDFTObject* self, PyObject* o, void* /*closure*/) {
+
+  if (!PyBob_NumberCheck(o)) {
+    PyErr_Format(PyExc_TypeError, "`%s' refresh_interval can only be set using a number, not `%s'", Py_TYPE(self)->tp_name, Py_TYPE(o)->tp_name);
+    return -1;
+  }
+
+  Py_ssize_t interval = PyNumber_AsSsize_t(o, PyExc_OverflowError);
+  if (PyErr_Occurred()) return -1;
+
+  if (interval < 0) {
+    PyErr_Format(PyExc_ValueError, "`%s' refresh_interval cannot be negative", Py_TYPE(self)->tp_name);
+    return -1;
+  }
+
+  self->cxx->setRefreshInterval(interval);
+  return 0;
+
+}
+
+PyDoc_STRVAR(s_spectrum_str, "spectrum");
+PyDoc_STRVAR(s_spectrum_doc,
+"A copy of the current spectrum: the values of the monitored\n\
+:py:attr:`bins`, in their order\n\
+");
+
+static PyObject* PyBobSpSlidingDFT_GetSpectrum
+(PyBobSpSlidingDFTObject* self, void* /*closure*/) {
+
+  Py_ssize_t length = self->cxx->getBins().size();
+  PyBlitzArrayObject* output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_COMPLEX128, 1, &length);
+  if (!output) return 0;
+  auto output_ = make_safe(output);
+
+  try {
+    self->cxx->getSpectrum(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot copy the spectrum: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+static PyGetSetDef PyBobSpSlidingDFT_getseters[] = {
+    {
+      s_length_str,
+      (getter)PyBobSpSlidingDFT_GetLength,
+      (setter)PyBobSpSlidingDFT_SetLength,
+      s_length_doc,
+      0
+    },
+    {
+      s_bins_str,
+      (getter)PyBobSpSlidingDFT_GetBins,
+      (setter)PyBobSpSlidingDFT_SetBins,
+      s_bins_doc,
+      0
+    },
+    {
+      s_refresh_interval_str,
+      (getter)PyBobSpSlidingDFT_GetRefreshInterval,
+      (setter)PyBobSpSlidingDFT_SetRefreshInterval,
+      s_refresh_interval_doc,
+      0
+    },
+    {
+      s_spectrum_str,
+      (getter)PyBobSpSlidingDFT_GetSpectrum,
+      0,
+      s_spectrum_doc,
+      0
+    },
+    {0}  /* Sentinel */
+};
+
+PyDoc_STRVAR(s_reset_str, "reset");
+PyDoc_STRVAR(s_reset_doc,
+"Fills the window with zeros (and hence the spectrum)\n\
+");
+
+static PyObject* PyBobSpSlidingDFT_Reset
+(PyBobSpSlidingDFTObject* self) {
+  self->cxx->reset();
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef PyBobSpSlidingDFT_methods[] = {
+  {
+    s_reset_str,
+    (PyCFunction)PyBobSpSlidingDFT_Reset,
+    METH_NOARGS,
+    s_reset_doc,
+  },
+  {0} /* Sentinel */
+};
+
+static PyObject* PyBobSpSlidingDFT_Call
+(PyBobSpSlidingDFTObject* self, PyObject* args, PyObject* kwds) {
+
+  static const char* const_kwlist[] = {"input", "output", 0};
+  static char** kwlist = const_cast<char**>(const_kwlist);
+
+  PyBlitzArrayObject* input = 0;
+  PyBlitzArrayObject* output = 0;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O&", kwlist,
+        &PyBlitzArray_Converter, &input,
+        &PyBlitzArray_OutputConverter, &output
+        )) return 0;
+
+  //protects acquired resources through this scope
+  auto input_ = make_safe(input);
+  auto output_ = make_xsafe(output);
+
+  if (input->type_num != NPY_FLOAT64 && input->type_num != NPY_COMPLEX128) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 64-bit float or 128-bit complex (2x64-bit float) arrays for input array `input'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  if (output && output->type_num != NPY_COMPLEX128) {
+    PyErr_Format(PyExc_TypeError, "`%s' only supports 128-bit complex (2x64-bit float) arrays for output array `output'", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  if (input->ndim != 1) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1-dimensional arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, input->ndim);
+    return 0;
+  }
+
+  if (output && output->ndim != 1) {
+    PyErr_Format(PyExc_TypeError, "`%s' only accepts 1-dimensional output arrays (not %" PY_FORMAT_SIZE_T "dD arrays)", Py_TYPE(self)->tp_name, output->ndim);
+    return 0;
+  }
+
+  Py_ssize_t bins = self->cxx->getBins().size();
+  if (output && output->shape[0] != bins) {
+    PyErr_Format(PyExc_RuntimeError, "1D `output' array should have %" PY_FORMAT_SIZE_T "d elements matching `%s' number of bins, not %" PY_FORMAT_SIZE_T "d elements", bins, Py_TYPE(self)->tp_name, output->shape[0]);
+    return 0;
+  }
+
+  /** if ``output`` was not pre-allocated, do it now **/
+  if (!output) {
+    output = (PyBlitzArrayObject*)PyBlitzArray_SimpleNew(NPY_COMPLEX128, 1, &bins);
+    output_ = make_safe(output);
+  }
+
+  /** all basic checks are done, can call the operator now **/
+  try {
+    if (input->type_num == NPY_FLOAT64)
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<double,1>(input));
+    else
+      self->cxx->operator()(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(input));
+    self->cxx->getSpectrum(*PyBlitzArrayCxx_AsBlitz<std::complex<double>,1>(output));
+  }
+  catch (std::exception& e) {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+    return 0;
+  }
+  catch (...) {
+    PyErr_Format(PyExc_RuntimeError, "%s cannot operate on data: unknown exception caught", Py_TYPE(self)->tp_name);
+    return 0;
+  }
+
+  return PyBlitzArray_NUMPY_WRAP(Py_BuildValue("O", output));
+
+}
+
+PyTypeObject PyBobSpSlidingDFT_Type = {
+    PyVarObject_HEAD_INIT(0, 0)
+    s_sliding_dft_str,                        /*tp_name*/
+    sizeof(PyBobSpSlidingDFTObject),          /*tp_basicsize*/
+    0,                                        /*tp_itemsize*/
+    (destructor)PyBobSpSlidingDFT_Delete,     /*tp_dealloc*/
+    0,                                        /*tp_print*/
+    0,                                        /*tp_getattr*/
+    0,                                        /*tp_setattr*/
+    0,                                        /*tp_compare*/
+    (reprfunc)PyBobSpSlidingDFT_Repr,         /*tp_repr*/
+    0,                                        /*tp_as_number*/
+    0,                                        /*tp_as_sequence*/
+    0,                                        /*tp_as_mapping*/
+    0,                                        /*tp_hash */
+    (ternaryfunc)PyBobSpSlidingDFT_Call,      /* tp_call */
+    (reprfunc)PyBobSpSlidingDFT_Repr,         /*tp_str*/
+    0,                                        /*tp_getattro*/
+    0,                                        /*tp_setattro*/
+    0,                                        /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    s_sliding_dft_doc,                        /* tp_doc */
+    0,		                                    /* tp_traverse */
+    0,		                                    /* tp_clear */
+    (richcmpfunc)PyBobSpSlidingDFT_RichCompare, /* tp_richcompare */
+    0,		                                    /* tp_weaklistoffset */
+    0,		                                    /* tp_iter */
+    0,		                                    /* tp_iternext */
+    PyBobSpSlidingDFT_methods,                /* tp_methods */
+    0,                                        /* tp_members */
+    PyBobSpSlidingDFT_getseters,              /* tp_getset */
+    0,                                        /* tp_base */
+    0,                                        /* tp_dict */
+    0,                                        /* tp_descr_get */
+    0,                                        /* tp_descr_set */
+    0,                                        /* tp_dictoffset */
+    (initproc)PyBobSpSlidingDFT_Init,         /* tp_init */
+    0,                                        /* tp_alloc */
+    0,                                        /* tp_new */
+};
@@ -12,6 +12,7 @@ import numpy
 import random
 
 from . import *
+from ._library import _scratch_bytes, _scratch_peak
 
 #############################################################################
 # Test fast DCT/FFT implementation based on numpy FFT
@@ -191,6 +192,32 @@ def test_fft1D_range1to2048_random():
     # call the test function
     _fft1D(N, t, 1e-3)
 
+def test_fft1D_large_primes():
+  # Lengths with large prime factors go through the Bluestein algorithm
+  for N in [127, 1009, 2*1021, 4099]:
+    t = numpy.random.randn(N) + 1j*numpy.random.randn(N)
+    assert numpy.allclose(FFT1D(N)(t), numpy.fft.fft(t))
+    assert numpy.allclose(IFFT1D(N)(t), numpy.fft.ifft(t))
+    r = numpy.random.randn(N)
+    assert numpy.allclose(RFFT1D(N)(r), numpy.fft.rfft(r))
+    assert numpy.allclose(IRFFT1D(N)(numpy.fft.rfft(r)), r)
+
+def test_rfft1D_range1to2048_random():
+  # This tests the real 1D FFT against numpy, including all lengths up to 64
+  for N in list(range(1,65)) + [random.randint(1,2048) for loop in range(10)]:
+    t = numpy.random.uniform(1, 10, (N,))
+
+    rfft = RFFT1D(N)
+    u_rfft = rfft(t)
+    assert u_rfft.shape == (N//2+1,)
+    assert numpy.allclose(u_rfft, numpy.fft.rfft(t))
+    assert numpy.allclose(u_rfft, FFT1D(N)(t.astype('complex128'))[:N//2+1])
+
+    irfft = IRFFT1D(N)
+    u_rfft_irfft = numpy.zeros((N,), 'float64')
+    irfft(u_rfft, u_rfft_irfft)
+    assert numpy.allclose(u_rfft_irfft, t)
+
 
 def test_fft2D_1x1to8x8_set():
   # size of the data
@@ -223,6 +250,25 @@ def test_fft2D_range1x1to64x64_random():
     # call the test function
     _fft2D(M, N, t, 1e-3)
 
+def test_rfft2D_range1x1to64x64_random():
+  # This tests the real 2D FFT against numpy, on 10 random images
+  # The size of each image is randomly chosen between 1x1 and 64x64
+  for loop in range(0,10):
+    M = random.randint(1,64)
+    N = random.randint(1,64)
+    t = numpy.random.uniform(1, 10, (M,N))
+
+    rfft = RFFT2D(M,N)
+    u_rfft = rfft(t)
+    assert u_rfft.shape == (M,N//2+1)
+    assert numpy.allclose(u_rfft, numpy.fft.rfft2(t))
+
+    irfft = IRFFT2D(M,N)
+    u_rfft_irfft = numpy.zeros((M,N), 'float64')
+    irfft(u_rfft, u_rfft_irfft)
+    assert numpy.allclose(u_rfft_irfft, t)
+
+
 def test_dct1d_methods():
   r = numpy.random.randn(7).astype(numpy.float64)
   # 1.a DCT1D
@@ -360,6 +406,48 @@ def test_fft1d_methods():
   o_f = a(v)
   assert numpy.allclose(o_i, o_f)
 
+def test_rfft1d_methods():
+  v = numpy.random.randn(7)
+  # 3.c RFFT1D
+  a = RFFT1D(7)
+  o_i = a(v)
+  b = RFFT1D(7)
+  c = RFFT1D(a)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert not a != c
+  a.length = 8
+  assert not a == b
+  assert a != b
+  assert a.spectrum_length == 5
+  a.shape = (7,)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert a.shape == (7,)
+  assert a.spectrum_length == 4
+  o_f = a(v)
+  assert numpy.allclose(o_i, o_f)
+  # 3.d IRFFT1D
+  a = IRFFT1D(7)
+  o_i = a(o_f)
+  b = IRFFT1D(7)
+  c = IRFFT1D(a)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert not a != c
+  a.length = 8
+  assert not a == b
+  assert a != b
+  a.shape = (7,)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert a.shape == (7,)
+  assert numpy.allclose(o_i, v)
+
 def test_fft2d_methods():
   v = numpy.random.randn(7,9).astype(numpy.complex128)
   # 4.a FFT2D
@@ -415,3 +503,753 @@ def test_fft2d_methods():
   assert not a != b
   o_f = a(v)
   assert numpy.allclose(o_i, o_f)
+
+def test_rfft2d_methods():
+  v = numpy.random.randn(7,9)
+  # 4.c RFFT2D
+  a = RFFT2D(7,9)
+  o_i = a(v)
+  b = RFFT2D(7,9)
+  c = RFFT2D(a)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert not a != c
+  a.height = 8
+  assert not a == b
+  assert a != b
+  a.shape = (7,9)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert a.shape == (7,9)
+  assert a.spectrum_width == 5
+  a.width = 10
+  assert not a == b
+  assert a != b
+  assert a.spectrum_width == 6
+  a.shape = (7,9)
+  assert a == b
+  assert a == c
+  assert not a != b
+  o_f = a(v)
+  assert numpy.allclose(o_i, o_f)
+
+  # 4.d IRFFT2D
+  a = IRFFT2D(7,9)
+  o_i = a(o_f)
+  b = IRFFT2D(7,9)
+  c = IRFFT2D(a)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert not a != c
+  a.height = 8
+  assert not a == b
+  assert a != b
+  a.shape = (7,9)
+  assert a == b
+  assert a == c
+  assert not a != b
+  assert a.shape == (7,9)
+  assert numpy.allclose(o_i, v)
+
+def test_fft_dct_inplace():
+  # 1D and 2D transforms may be given the same array as input and output
+  for shape in [(1,), (31,), (64,), (1,1), (7,9), (16,16)]:
+    v = numpy.random.randn(*shape).astype(numpy.complex128)
+    for f in (fft, ifft):
+      ref = f(v)
+      a = v.copy()
+      f(a, a)
+      assert numpy.allclose(a, ref)
+    op = FFT1D(shape[0]) if len(shape) == 1 else FFT2D(*shape)
+    a = v.copy()
+    op(a, a)
+    assert numpy.allclose(a, fft(v))
+
+    r = numpy.random.randn(*shape)
+    for f in (dct, idct):
+      ref = f(r)
+      a = r.copy()
+      f(a, a)
+      assert numpy.allclose(a, ref)
+    op = DCT1D(shape[0]) if len(shape) == 1 else DCT2D(*shape)
+    a = r.copy()
+    op(a, a)
+    assert numpy.allclose(a, dct(r))
+
+def test_fft_inplace_scratch():
+  # The in-place transforms make no copy of the signal: the 1D ones only
+  # use the working array of their plan (of the size of the signal), and
+  # the 2D ones buffers of a few columns
+  n = 2**17
+  v = numpy.random.randn(n) + 1j * numpy.random.randn(n)
+  for op in (FFT1D(n), IFFT1D(n)):
+    ref = op(v)
+    a = v.copy()
+    _scratch_peak()
+    op(a, a)
+    assert _scratch_peak() <= v.nbytes
+    assert numpy.allclose(a, ref)
+  v = v.reshape(512, 256)
+  for op in (FFT2D(512, 256), IFFT2D(512, 256)):
+    ref = op(v)
+    a = v.copy()
+    _scratch_peak()
+    op(a, a)
+    assert _scratch_peak() <= v.nbytes // 2
+    assert numpy.allclose(a, ref)
+
+def test_fft_dct_float32():
+  # single precision inputs are transformed in single precision, and agree
+  # with the double precision transforms up to the float precision
+  for shape in [(1,), (31,), (64,), (97,), (1,1), (7,9), (16,16)]:
+    v = numpy.random.randn(*shape) + 1j * numpy.random.randn(*shape)
+    for f in (fft, ifft):
+      o = f(v.astype(numpy.complex64))
+      assert o.dtype == numpy.complex64
+      ref = f(v)
+      assert numpy.allclose(o, ref, rtol=1e-4, atol=1e-4 * abs(ref).max())
+    op = FFT1D(shape[0]) if len(shape) == 1 else FFT2D(*shape)
+    assert numpy.allclose(op(v.astype(numpy.complex64)), fft(v), rtol=1e-4, atol=1e-4 * abs(fft(v)).max())
+
+    r = numpy.random.randn(*shape)
+    for f in (dct, idct):
+      o = f(r.astype(numpy.float32))
+      assert o.dtype == numpy.float32
+      ref = f(r)
+      assert numpy.allclose(o, ref, rtol=1e-4, atol=1e-4 * abs(ref).max())
+
+    rop = RFFT1D(shape[0]) if len(shape) == 1 else RFFT2D(*shape)
+    iop = IRFFT1D(shape[0]) if len(shape) == 1 else IRFFT2D(*shape)
+    o = rop(r.astype(numpy.float32))
+    assert o.dtype == numpy.complex64
+    assert numpy.allclose(iop(o), r, rtol=1e-4, atol=1e-4)
+
+  # the output array must have the same precision as the input array
+  nose.tools.assert_raises(TypeError, fft, numpy.zeros((4,), numpy.complex64), numpy.zeros((4,), numpy.complex128))
+  nose.tools.assert_raises(TypeError, dct, numpy.zeros((4,), numpy.float32), numpy.zeros((4,), numpy.float64))
+
+def test_fft1d_batch():
+  # 2D arrays are transformed along one axis, in a single call
+  for length in [1, 7, 16, 97, 100, 256]:
+    for count in [1, 5, 8, 33]:
+      v = numpy.random.randn(count, length) + 1j * numpy.random.randn(count, length)
+      ref = numpy.array([fft(row) for row in v])
+      for threads in [1, 3]:
+        op = FFT1D(length)
+        op.threads = threads
+        assert numpy.allclose(op(v), ref)
+        assert numpy.allclose(op(v, axis=1), ref)
+        assert numpy.allclose(op(v.T.copy(), axis=0), ref.T)
+        iop = IFFT1D(length)
+        iop.threads = threads
+        assert numpy.allclose(iop(op(v)), v)
+        a = v.astype(numpy.complex64)
+        o = op(a)
+        assert o.dtype == numpy.complex64
+        assert numpy.allclose(o, ref, rtol=1e-4, atol=1e-4 * abs(ref).max())
+
+  # Empty batches are no-ops, on one thread or several
+  for threads in [1, 3]:
+    op = FFT1D(8)
+    op.threads = threads
+    iop = IFFT1D(8)
+    iop.threads = threads
+    for shape, axis in [((8, 0), 0), ((0, 8), 1)]:
+      v = numpy.zeros(shape, numpy.complex128)
+      assert op(v, axis=axis).shape == shape
+      assert iop(v, axis=axis).shape == shape
+
+  op = FFT1D(8)
+  assert op.threads == 1
+  nose.tools.assert_raises(RuntimeError, op, numpy.zeros((3, 8), numpy.complex128), axis=0)
+  nose.tools.assert_raises(RuntimeError, op, numpy.zeros((3, 8), numpy.complex128), axis=2)
+
+def test_fft1d_batch_empty():
+  # Batches without any signal, along either axis, with the rows or the
+  # columns path, on one thread or several
+  for threads in [1, 4]:
+    for cls in (FFT1D, IFFT1D):
+      op = cls(8)
+      op.threads = threads
+      for shape, axis in [((8, 0), 0), ((0, 8), 1)]:
+        for dtype in (numpy.complex128, numpy.complex64):
+          v = numpy.zeros(shape, dtype)
+          o = op(v, axis=axis)
+          assert o.shape == shape and o.dtype == v.dtype
+          op(v, v, axis=axis)
+      nose.tools.assert_raises(RuntimeError, op, numpy.zeros((8, 0), numpy.complex128), axis=1)
+      nose.tools.assert_raises(RuntimeError, op, numpy.zeros((0, 8), numpy.complex128), axis=0)
+
+def test_fft1d_batch_after_fork():
+  # A child process forked after some threaded transforms gets threads of
+  # its own, and exits cleanly
+  if not hasattr(os, 'fork'): return
+  import time
+  t = numpy.random.randn(64, 32) + 1j * numpy.random.randn(64, 32)
+  op = FFT1D(32)
+  op.threads = 4
+  ref = op(t)
+  pid = os.fork()
+  if pid == 0:
+    ok = numpy.allclose(op(t), ref) and numpy.allclose(op(t), ref)
+    os._exit(0 if ok else 1)
+  for i in range(300):
+    done, status = os.waitpid(pid, os.WNOHANG)
+    if done: break
+    time.sleep(0.1)
+  else:
+    os.kill(pid, 9)
+    os.waitpid(pid, 0)
+    assert False, "the forked process did not terminate"
+  assert os.WIFEXITED(status) and os.WEXITSTATUS(status) == 0
+
+def test_fft_dct_2d_column_tiles():
+  # Wide arrays, whose columns are transformed by several tiles, the last
+  # one being partial
+  for M, N in [(5, 3001), (40, 3000), (97, 1500)]:
+    t = numpy.random.randn(M, N) + 1j * numpy.random.randn(M, N)
+    assert numpy.allclose(FFT2D(M, N)(t), numpy.fft.fft2(t))
+    assert numpy.allclose(IFFT2D(M, N)(t), numpy.fft.ifft2(t))
+    assert numpy.allclose(FFT1D(M)(t, axis=0), numpy.fft.fft(t, axis=0))
+
+    r = numpy.random.randn(M, N)
+    dct_h, dct_w = DCT1D(M), DCT1D(N)
+    rows = numpy.array([dct_w(row) for row in r])
+    ref = numpy.array([dct_h(col.copy()) for col in rows.T]).T
+    u = DCT2D(M, N)(r)
+    assert numpy.allclose(u, ref)
+    assert numpy.allclose(IDCT2D(M, N)(u), r)
+
+def test_fft_dct_2d_threads():
+  # The rows and the columns may be spread over several threads
+  for M, N in [(1, 1), (7, 300), (97, 40)]:
+    t = numpy.random.randn(M, N) + 1j * numpy.random.randn(M, N)
+    r = numpy.random.randn(M, N)
+    for op, v in [(FFT2D(M, N), t), (IFFT2D(M, N), t), (DCT2D(M, N), r), (IDCT2D(M, N), r)]:
+      assert op.threads == 1
+      ref = op(v)
+      for threads in [0, 2, 5]:
+        op.threads = threads
+        assert op.threads == threads
+        assert type(op)(op) == op and op != type(op)(M, N)
+        assert numpy.allclose(op(v), ref)
+        assert numpy.allclose(type(op)(op)(v), ref)
+
+  op = FFT2D(4, 4)
+  nose.tools.assert_raises(ValueError, setattr, op, 'threads', -1)
+
+def test_scratch_memory_is_bounded():
+  # The scratch memory of the transforms of huge signals is not kept by
+  # the threads once they are done
+  v = numpy.random.randn(2**18) + 1j * numpy.random.randn(2**18)
+  for op in (FFT1D(2**18), IFFT1D(2**18), DCT1D(2**18)):
+    op(v.real if isinstance(op, DCT1D) else v)
+    assert _scratch_bytes() <= 8 * 2**20
+  # The small ones keep theirs, to be reused
+  op = FFT1D(64)
+  op(v[:64])
+  held = _scratch_bytes()
+  assert held > 0
+  op(v[:64])
+  assert _scratch_bytes() == held
+
+def test_fft_dct_nd():
+  # N-dimensional transforms, compared with numpy and with 1D transforms
+  # along each dimension
+  for shape in [(17,), (6, 10), (4, 5, 6), (3, 1, 9), (2, 3, 4, 5)]:
+    t = numpy.random.randn(*shape) + 1j * numpy.random.randn(*shape)
+    op = FFTND(shape)
+    assert op.shape == shape
+    assert op.rank == len(shape)
+    assert numpy.allclose(op(t), numpy.fft.fftn(t))
+    assert numpy.allclose(IFFTND(shape)(t), numpy.fft.ifftn(t))
+    assert numpy.allclose(fft(t), numpy.fft.fftn(t))
+    assert numpy.allclose(ifft(t), numpy.fft.ifftn(t))
+
+    r = numpy.random.randn(*shape)
+    ref = r
+    for axis, n in enumerate(shape):
+      dct_a = DCT1D(n)
+      ref = numpy.apply_along_axis(lambda v: dct_a(v.copy()), axis, ref)
+    u = DCTND(shape)(r)
+    assert numpy.allclose(u, ref)
+    assert numpy.allclose(dct(r), ref)
+    assert numpy.allclose(IDCTND(shape)(u), r)
+    assert numpy.allclose(idct(u), r)
+
+    for op, v in [(FFTND(shape), t), (DCTND(shape), r)]:
+      ref = op(v)
+      op.threads = 2
+      assert numpy.allclose(type(op)(op)(v), ref)
+      assert type(op)(op) == op
+
+  op = FFTND((4, 5, 6))
+  nose.tools.assert_raises(TypeError, op, numpy.zeros((4, 5), 'complex128'))
+  nose.tools.assert_raises(RuntimeError, op, numpy.zeros((4, 5, 7), 'complex128'))
+  op.shape = (4, 5, 7)
+  assert op(numpy.zeros((4, 5, 7), 'complex128')).shape == (4, 5, 7)
+
+def test_fft_centered():
+  # Centered transforms give the output of fftshift, and their inverses
+  # undo it, for even and odd sizes, single signals and batches
+  for length in [1, 2, 7, 16, 45]:
+    v = numpy.random.randn(5, length) + 1j * numpy.random.randn(5, length)
+    ref = numpy.fft.fftshift(numpy.fft.fft(v, axis=1), axes=1)
+    op = FFT1D(length)
+    assert not op.centered
+    op.centered = True
+    assert op.centered and FFT1D(op).centered
+    assert numpy.allclose(op(v[0]), ref[0])
+    assert numpy.allclose(op(v), ref)
+    assert numpy.allclose(op(v.T.copy(), axis=0), ref.T)
+    iop = IFFT1D(length)
+    iop.centered = True
+    assert numpy.allclose(iop(ref[0]), v[0])
+    assert numpy.allclose(iop(ref), v)
+
+  for shape in [(1, 1), (4, 6), (5, 7), (9, 16)]:
+    v = numpy.random.randn(*shape) + 1j * numpy.random.randn(*shape)
+    ref = numpy.fft.fftshift(numpy.fft.fft2(v))
+    op = FFT2D(*shape)
+    op.centered = True
+    assert numpy.allclose(op(v), ref)
+    assert numpy.allclose(op(v.astype('complex64')), ref, atol=1e-4)
+    iop = IFFT2D(*shape)
+    iop.centered = True
+    assert numpy.allclose(iop(ref), v)
+    out = ref.copy()
+    iop(out, out)
+    assert numpy.allclose(out, v)
+
+def test_fftshift():
+  # fftshift and ifftshift match numpy, out of place or in place, for odd
+  # and even extents and any number of dimensions
+  for shape in [(1,), (8,), (9,), (4, 6), (5, 7), (3, 4, 5), (2, 3, 1, 5)]:
+    v = numpy.random.randn(*shape) + 1j * numpy.random.randn(*shape)
+    for dtype in ('complex128', 'complex64'):
+      a = v.astype(dtype)
+      for f, ref in [(fftshift, numpy.fft.fftshift(a)),
+          (ifftshift, numpy.fft.ifftshift(a))]:
+        out = f(a)
+        assert out.dtype == a.dtype and numpy.array_equal(out, ref)
+        assert numpy.array_equal(f(a, numpy.empty_like(a)), ref)
+        b = a.copy()
+        f(b, b)
+        assert numpy.array_equal(b, ref)
+      b = a.copy()
+      fftshift(b, b)
+      ifftshift(b, b)
+      assert numpy.array_equal(b, a)
+
+  # Aliased views which are not C-contiguous, or not the same view, are
+  # shifted through a copy
+  for shape in [(9,), (16,), (5, 8), (3, 4, 6)]:
+    v = numpy.random.randn(*shape) + 1j * numpy.random.randn(*shape)
+    for f, nf in [(fftshift, numpy.fft.fftshift), (ifftshift, numpy.fft.ifftshift)]:
+      a = v.copy()
+      s = a[..., ::2]
+      ref = nf(s)
+      f(s, s)
+      assert numpy.array_equal(s, ref) and numpy.array_equal(a[..., 1::2], v[..., 1::2])
+      a = v.copy()
+      ref = nf(a[..., ::-1])
+      f(a[..., ::-1], a)
+      assert numpy.array_equal(a, ref)
+  a = numpy.random.randn(5, 5) + 1j * numpy.random.randn(5, 5)
+  ref = numpy.fft.fftshift(a.T)
+  fftshift(a.T, a)
+  assert numpy.array_equal(a, ref)
+
+def test_fft1d_engine():
+  # The Stockham engine computes the same transforms as fftpack
+  for length in [1, 2, 12, 64, 127, 360, 1000, 4099]:
+    v = numpy.random.randn(length) + 1j * numpy.random.randn(length)
+    op = FFT1D(length)
+    iop = IFFT1D(length)
+    assert op.engine == 'fftpack'
+    op.engine = 'stockham'
+    iop.engine = 'stockham'
+    assert op.engine == 'stockham'
+    assert numpy.allclose(op(v), numpy.fft.fft(v))
+    assert numpy.allclose(iop(v), numpy.fft.ifft(v))
+    assert numpy.allclose(FFT1D(op)(v), numpy.fft.fft(v))
+    assert FFT1D(op).engine == 'stockham'
+    o = op(v.astype(numpy.complex64))
+    assert o.dtype == numpy.complex64
+    assert numpy.allclose(o, numpy.fft.fft(v), rtol=1e-4, atol=1e-4 * length)
+
+    b = numpy.random.randn(5, length) + 1j * numpy.random.randn(5, length)
+    assert numpy.allclose(op(b), numpy.fft.fft(b, axis=1))
+    assert numpy.allclose(op(b.T.copy(), axis=0), numpy.fft.fft(b, axis=1).T)
+
+  op = FFT1D(8)
+  nose.tools.assert_raises(ValueError, setattr, op, 'engine', 'kiss')
+  nose.tools.assert_raises(TypeError, setattr, op, 'engine', 1)
+
+def test_fft1d_codelets():
+  # The small lengths whose factors are 2, 3 and 5 are computed by
+  # codelets, in both directions and precisions
+  for length in range(1, 70):
+    v = numpy.random.randn(3, length) + 1j * numpy.random.randn(3, length)
+    for engine in ('fftpack', 'tuned'):
+      op = FFT1D(length)
+      iop = IFFT1D(length)
+      op.engine = engine
+      iop.engine = engine
+      assert numpy.allclose(op(v[0]), numpy.fft.fft(v[0]))
+      assert numpy.allclose(iop(v[0]), numpy.fft.ifft(v[0]))
+      assert numpy.allclose(op(v), numpy.fft.fft(v, axis=1))
+      o = op(v[0].astype(numpy.complex64))
+      assert o.dtype == numpy.complex64
+      assert numpy.allclose(o, numpy.fft.fft(v[0]), rtol=1e-4, atol=1e-4 * length)
+
+def test_fft1d_four_step():
+  # The huge signals are transformed with the four-step algorithm when
+  # enough threads run in parallel (on enough hardware threads), in both
+  # directions and precisions, and with the plans of their length otherwise
+  for length in (2**20, 3 * 2**19):
+    v = numpy.random.randn(length) + 1j * numpy.random.randn(length)
+    ref = numpy.fft.fft(v)
+    for centered in (False, True):
+      op = FFT1D(length)
+      iop = IFFT1D(length)
+      op.centered = centered
+      iop.centered = centered
+      op.threads = 4
+      iop.threads = 0
+      _scratch_peak()
+      o = op(v)
+      # Out of place, no scratch of the size of the signal is added to the
+      # work array of the plans
+      assert _scratch_peak() <= v.nbytes
+      expected = numpy.fft.fftshift(ref) if centered else ref
+      assert numpy.allclose(o, expected)
+      assert numpy.allclose(iop(o), v)
+      o = op(v.astype(numpy.complex64))
+      assert o.dtype == numpy.complex64
+      assert numpy.allclose(o, expected, rtol=1e-3, atol=1e-2)
+
+def test_fft_dct_engines():
+  # All the transforms give the same results with all the available engines
+  engines = available_engines()
+  assert engines[:2] == ['fftpack', 'stockham']
+
+  t = numpy.random.randn(12, 17) + 1j * numpy.random.randn(12, 17)
+  r = numpy.random.randn(12, 17)
+  for engine in engines:
+    for op, v in [(FFT1D(17), t), (IFFT1D(17), t), (FFT2D(12, 17), t),
+        (IFFT2D(12, 17), t), (FFTND((12, 17)), t), (IFFTND((12, 17)), t),
+        (DCT1D(17), r[0]), (IDCT1D(17), r[0]), (DCT2D(12, 17), r),
+        (IDCT2D(12, 17), r), (DCTND((12, 17)), r), (IDCTND((12, 17)), r)]:
+      ref = op(v)
+      assert op.engine == 'fftpack'
+      default = type(op)(op)
+      op.engine = engine
+      assert op.engine == engine
+      assert numpy.allclose(op(v), ref)
+      assert type(op)(op).engine == engine
+      assert type(op)(op) == op
+      assert (op == default) == (engine == 'fftpack')
+
+  if 'fftw' in engines:
+    import tempfile
+    op = FFT1D(1000)
+    op.engine = 'fftw'
+    fd, filename = tempfile.mkstemp()
+    os.close(fd)
+    try:
+      export_fftw_wisdom(filename)
+      assert os.path.getsize(filename) > 0
+      import_fftw_wisdom(filename)
+    finally:
+      os.unlink(filename)
+  else:
+    nose.tools.assert_raises(RuntimeError, setattr, FFT2D(4, 4), 'engine', 'fftw')
+    nose.tools.assert_raises(RuntimeError, export_fftw_wisdom, 'wisdom')
+  nose.tools.assert_raises(RuntimeError, import_fftw_wisdom, '/nonexistent/wisdom')
+
+def test_next_fast_length():
+  # Fast lengths are the 7-smooth lengths which are not beaten by a larger
+  # one, and FFTW gets the smallest
+  def smooth(m):
+    for p in (2, 3, 5, 7):
+      while m % p == 0: m //= p
+    return m == 1
+
+  for n in list(range(1, 200)) + [1009, 2049, 65537, 1000003]:
+    m = next_fast_length(n)
+    assert m >= n and smooth(m)
+    if 'fftw' in available_engines():
+      m = next_fast_length(n, 'fftw')
+      assert m >= n and smooth(m)
+      assert not any(smooth(k) for k in range(n, m))
+  assert next_fast_length(2049) == 2160
+  assert next_fast_length(64) == 64
+  nose.tools.assert_raises(ValueError, next_fast_length, 0)
+  nose.tools.assert_raises(ValueError, next_fast_length, 10, 'kiss')
+
+def test_fft1d_tuned():
+  # The tuned engine gives the same results as fftpack, and its measurements
+  # can be saved and restored
+  import tempfile
+  assert 'tuned' in available_engines()
+  for length in [1, 64, 360, 1000, 97]:
+    v = numpy.random.randn(length) + 1j * numpy.random.randn(length)
+    op = FFT1D(length)
+    op.engine = 'tuned'
+    assert op.engine == 'tuned'
+    assert numpy.allclose(op(v), numpy.fft.fft(v))
+    iop = IFFT1D(length)
+    iop.engine = 'tuned'
+    assert numpy.allclose(iop(op(v)), v)
+    o = op(v.astype(numpy.complex64))
+    assert numpy.allclose(o, numpy.fft.fft(v), rtol=1e-4, atol=1e-4 * length)
+
+  fd, filename = tempfile.mkstemp()
+  os.close(fd)
+  try:
+    export_fft_tuning(filename)
+    lines = [l.split() for l in open(filename) if not l.startswith('#')]
+    assert ['double', '360'] in [l[:2] for l in lines]
+    assert ['float', '1000'] in [l[:2] for l in lines]
+    import_fft_tuning(filename)
+
+    # Imported choices are used by the new plans
+    with open(filename, 'w') as f:
+      f.write('# length 720 imported\ndouble 720 fftpack 5 3 3 4 4\nfloat 720 stockham\n')
+    import_fft_tuning(filename)
+    v = numpy.random.randn(720) + 1j * numpy.random.randn(720)
+    op = FFT1D(720)
+    op.engine = 'tuned'
+    assert numpy.allclose(op(v), numpy.fft.fft(v))
+    export_fft_tuning(filename)
+    lines = [l.split() for l in open(filename) if not l.startswith('#')]
+    assert ['double', '720', 'fftpack', '5', '3', '3', '4', '4'] in lines
+    assert ['float', '720', 'stockham'] in lines
+
+    # Invalid files are rejected as a whole
+    for content in ['double 720 fftpack 5 3 3 4\n', 'double 720 kiss\n',
+        'half 720 stockham\n', 'float 720 stockham 720\n']:
+      with open(filename, 'w') as f:
+        f.write('double 64 stockham\n' + content)
+      nose.tools.assert_raises(RuntimeError, import_fft_tuning, filename)
+  finally:
+    os.unlink(filename)
+  nose.tools.assert_raises(RuntimeError, import_fft_tuning, '/nonexistent/tuning')
+
+def test_pruned_fft1d():
+  # The pruned transforms give the first values of the transforms of the
+  # zero-padded signals
+  for N, K, M in [(1, 1, 1), (16, 3, 16), (64, 64, 5), (4096, 256, 4096),
+      (4096, 100, 37), (1000, 7, 1000), (97, 10, 20), (360, 360, 360)]:
+    v = numpy.random.randn(K) + 1j * numpy.random.randn(K)
+    padded = numpy.concatenate((v, numpy.zeros(N - K)))
+    op = PrunedFFT1D(N, K, M)
+    assert (op.length, op.input_length, op.output_length) == (N, K, M)
+    assert numpy.allclose(op(v), numpy.fft.fft(padded)[:M])
+    iop = PrunedIFFT1D(N, K, M)
+    assert numpy.allclose(iop(v), numpy.fft.ifft(padded)[:M])
+    o = op(v.astype(numpy.complex64))
+    assert o.dtype == numpy.complex64
+    assert numpy.allclose(o, numpy.fft.fft(padded)[:M], rtol=1e-4, atol=1e-4 * N)
+    for engine in available_engines():
+      op.engine = engine
+      assert numpy.allclose(op(v), numpy.fft.fft(padded)[:M])
+
+  a = PrunedFFT1D(64, 8, 16)
+  b = PrunedFFT1D(a)
+  assert a == b
+  a.output_length = 64
+  assert a != b
+  assert a.output_length == 64
+  a.input_length = 16
+  assert a.input_length == 16
+  nose.tools.assert_raises(RuntimeError, setattr, a, 'input_length', 65)
+  nose.tools.assert_raises(RuntimeError, PrunedFFT1D, 64, 0, 16)
+  nose.tools.assert_raises(RuntimeError, PrunedFFT1D, 64, 8, 65)
+  nose.tools.assert_raises(RuntimeError, a, numpy.zeros(8, numpy.complex128))
+
+def test_sliding_dft():
+  # The sliding DFT follows the spectrum of the last samples of the stream,
+  # whatever the hops, for all the bins or a few of them
+  N = 64
+  full = SlidingDFT(N)
+  part = SlidingDFT(N, (0, 5, 63))
+  assert full.bins == tuple(range(N))
+  assert part.bins == (0, 5, 63)
+  stream = numpy.zeros(N, numpy.complex128)
+  for hop in [1, 1, 3, 1, 40, 2, 100, 1, 7, 1]:
+    v = numpy.random.randn(hop) + 1j * numpy.random.randn(hop)
+    stream = numpy.concatenate((stream, v))
+    ref = numpy.fft.fft(stream[-N:])
+    assert numpy.allclose(full(v), ref)
+    assert numpy.allclose(part(v), ref[[0, 5, 63]])
+  assert numpy.allclose(full.spectrum, numpy.fft.fft(stream[-N:]))
+
+  # Real samples, and a long stream of single samples
+  op = SlidingDFT(N)
+  r = numpy.random.randn(3 * N + 5)
+  for x in r:
+    o = op(numpy.array([x]))
+  assert numpy.allclose(o, numpy.fft.fft(r[-N:]))
+
+  # Copies and settings
+  c = SlidingDFT(full)
+  assert c == full
+  assert c != part
+  assert numpy.allclose(c.spectrum, full.spectrum)
+  c.bins = [5, 1]
+  assert numpy.allclose(c.spectrum, full.spectrum[[5, 1]])
+  assert full.refresh_interval == 16 * N
+  c.refresh_interval = 0
+  assert c.refresh_interval == 0
+  c.reset()
+  assert numpy.all(c.spectrum == 0)
+  c.length = 8
+  assert c.bins == tuple(range(8))
+  nose.tools.assert_raises(RuntimeError, SlidingDFT, 8, (8,))
+  nose.tools.assert_raises(RuntimeError, SlidingDFT, 0)
+
+def test_goertzel():
+  # Integer bins match the FFT, fractional ones the direct sums
+  N = 100
+  x = numpy.random.randn(N)
+  op = Goertzel(N, (0, 3, 50, 99))
+  assert op.frequencies == (0., 3., 50., 99.)
+  assert numpy.allclose(op(x), numpy.fft.fft(x)[[0, 3, 50, 99]])
+  f = numpy.array([2.5, -1.25, 130.7])
+  ref = numpy.exp(-2j * numpy.pi * numpy.outer(f, numpy.arange(N)) / N).dot(x)
+  op.frequencies = f
+  assert numpy.allclose(op(x), ref)
+  assert numpy.allclose(op.power(x), numpy.abs(ref)**2)
+
+  # Batches of signals, in single precision as well
+  b = numpy.random.randn(3, N)
+  ref = numpy.exp(-2j * numpy.pi * numpy.outer(f, numpy.arange(N)) / N).dot(b.T).T
+  assert numpy.allclose(op(b), ref)
+  o = op(b.astype('float32'))
+  assert o.dtype == numpy.complex64
+  assert numpy.allclose(o, ref, rtol=1e-4, atol=1e-3)
+  p = numpy.zeros((3, 3), 'float64')
+  op.power(b, p)
+  assert numpy.allclose(p, numpy.abs(ref)**2)
+
+  # Copies and settings
+  c = Goertzel(op)
+  assert c == op
+  c.length = 8
+  assert c != op
+  assert numpy.allclose(c(x[:8]), numpy.exp(-2j * numpy.pi *
+    numpy.outer(f, numpy.arange(8)) / 8).dot(x[:8]))
+  nose.tools.assert_raises(RuntimeError, op, x[:8])
+  nose.tools.assert_raises(RuntimeError, Goertzel, 0, (1,))
+  nose.tools.assert_raises(RuntimeError, Goertzel, 8, (float('nan'),))
+
+def test_chirpz():
+  # By default, the points are equally spaced on the unit circle: the DFT
+  N = 60
+  x = numpy.random.randn(N) + 1j * numpy.random.randn(N)
+  op = ChirpZ(N, N)
+  assert numpy.allclose(op(x), numpy.fft.fft(x))
+
+  # A narrow band of frequencies, against the direct sums
+  op.points = 100
+  op.set_frequency_range(3.5, 5.)
+  f = 3.5 + numpy.arange(100) * 1.5 / 100
+  ref = numpy.exp(-2j * numpy.pi * numpy.outer(f, numpy.arange(N)) / N).dot(x)
+  assert numpy.allclose(op(x), ref)
+
+  # Any spiral arc, against the direct sums
+  w = 0.999 * numpy.exp(-0.02j)
+  a = 1.001 * numpy.exp(0.5j)
+  op = ChirpZ(N, 30, w, a)
+  assert op.w == w and op.a == a
+  z = a * w ** -numpy.arange(30)
+  ref = (z[:, numpy.newaxis] ** -numpy.arange(N)).dot(x)
+  assert numpy.allclose(op(x), ref)
+
+  # Batches of signals, in single precision as well
+  b = numpy.random.randn(3, N) + 1j * numpy.random.randn(3, N)
+  ref = (z[:, numpy.newaxis] ** -numpy.arange(N)).dot(b.T).T
+  assert numpy.allclose(op(b), ref)
+  o = numpy.zeros((3, 30), 'complex64')
+  op(b.astype('complex64'), o)
+  assert numpy.allclose(o, ref, rtol=1e-3, atol=1e-3)
+
+  # Copies and settings
+  c = ChirpZ(op)
+  assert c == op
+  c.engine = 'stockham'
+  assert numpy.allclose(c(x), op(x))
+  c.length = 8
+  assert c != op
+  nose.tools.assert_raises(RuntimeError, op, x[:8])
+  nose.tools.assert_raises(RuntimeError, ChirpZ, 0, 1)
+  nose.tools.assert_raises(RuntimeError, ChirpZ, 8, 8, 0.)
+
+def _conv2d(a, b, size):
+  # Direct 2D convolution, cropped as numpy.convolve does in 1D
+  full = numpy.zeros((a.shape[0] + b.shape[0] - 1, a.shape[1] + b.shape[1] - 1))
+  for i in range(b.shape[0]):
+    for j in range(b.shape[1]):
+      full[i:i+a.shape[0], j:j+a.shape[1]] += b[i,j] * a
+  if size == 'full': return full
+  if size == 'same':
+    o = [(n - 1) // 2 for n in b.shape]
+    return full[o[0]:o[0]+a.shape[0], o[1]:o[1]+a.shape[1]]
+  return full[b.shape[0]-1:a.shape[0], b.shape[1]-1:a.shape[1]]
+
+def test_fftconv():
+  # Against numpy.convolve, for kernels of odd and even lengths (the 'same'
+  # part starts (N-1)//2 values into the full product)
+  a = numpy.random.randn(37)
+  for n in (1, 4, 5, 16, 37):
+    b = numpy.random.randn(n)
+    for size in ('full', 'same', 'valid'):
+      assert numpy.allclose(fftconv(a, b, size=size), numpy.convolve(a, b, size))
+      assert numpy.allclose(fftconv(a.astype('float32'), b.astype('float32'),
+        size=size), numpy.convolve(a, b, size), rtol=1e-4, atol=1e-4)
+  assert numpy.allclose(fftconv(a, b), numpy.convolve(a, b))
+
+  # In 2D, against the direct sums
+  a = numpy.random.randn(20, 13)
+  for shape in ((3, 3), (4, 6), (1, 13)):
+    b = numpy.random.randn(*shape)
+    for size in ('full', 'same', 'valid'):
+      ref = _conv2d(a, b, size)
+      assert numpy.allclose(fftconv(a, b, size=size), ref)
+      assert numpy.allclose(fftconv(a.astype('float32'), b.astype('float32'),
+        size=size), ref, rtol=1e-4, atol=1e-4)
+
+  # An output array, and the errors
+  b = numpy.random.randn(4, 4)
+  c = numpy.zeros((17, 10))
+  fftconv(a, b, c, 'valid')
+  assert numpy.allclose(c, _conv2d(a, b, 'valid'))
+  nose.tools.assert_raises(RuntimeError, fftconv, a, b, c)
+  nose.tools.assert_raises(ValueError, fftconv, a, b, size='middle')
+  nose.tools.assert_raises(TypeError, fftconv, a, b[0])
+  nose.tools.assert_raises(TypeError, fftconv, a, b.astype('float32'))
+  nose.tools.assert_raises(RuntimeError, fftconv, b, a)
+
+def test_fftcorr():
+  # Against numpy.correlate, which does not reverse the kernel
+  a = numpy.random.randn(37)
+  for n in (1, 4, 5, 37):
+    b = numpy.random.randn(n)
+    assert numpy.allclose(fftcorr(a, b, size='valid'), numpy.correlate(a, b, 'valid'))
+    assert numpy.allclose(fftcorr(a, b), numpy.correlate(a, b, 'full'))
+    assert numpy.allclose(fftcorr(a, b, size='same'), numpy.convolve(a, b[::-1], 'same'))
+    assert numpy.allclose(fftcorr(a.astype('float32'), b.astype('float32'),
+      size='valid'), numpy.correlate(a, b, 'valid'), rtol=1e-4, atol=1e-4)
+
+  # In 2D, the convolution with the reversed kernel
+  a = numpy.random.randn(20, 13)
+  b = numpy.random.randn(4, 5)
+  for size in ('full', 'same', 'valid'):
+    assert numpy.allclose(fftcorr(a, b, size=size), _conv2d(a, b[::-1,::-1], size))
+  c = fftcorr(a, b, size='valid')
+  assert numpy.allclose(c[2,3], (a[2:6,3:8] * b).sum())
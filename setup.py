@@ -15,6 +15,19 @@ build_requires = load_requirements()
 # Define package version
 version = open("version.txt").read().rstrip()
 
+# FFTW3 (double and single precision) is an optional backend of the
+# transforms, which is compiled in if pkg-config finds it
+from bob.extension import pkgconfig
+fftw_packages = []
+fftw_macros = []
+try:
+  pkgconfig('fftw3')
+  pkgconfig('fftw3f')
+  fftw_packages = ['fftw3', 'fftw3f']
+  fftw_macros = [('BOB_SP_HAVE_FFTW3', '1')]
+except RuntimeError:
+  pass
+
 setup(
 
     name='bob.sp',
@@ -49,16 +62,40 @@ setup(
         [
           "bob/sp/cpp/DCT1DNaive.cpp",
           "bob/sp/cpp/DCT2D.cpp",
+          "bob/sp/cpp/DCTND.cpp",
           "bob/sp/cpp/DCT2DNaive.cpp",
           "bob/sp/cpp/FFT1D.cpp",
           "bob/sp/cpp/FFT2DNaive.cpp",
           "bob/sp/cpp/DCT1D.cpp",
           "bob/sp/cpp/FFT1DNaive.cpp",
           "bob/sp/cpp/FFT2D.cpp",
-          "bob/sp/cpp/fftpack.c"
+          "bob/sp/cpp/FFTND.cpp",
+          "bob/sp/cpp/RFFT1D.cpp",
+          "bob/sp/cpp/RFFT2D.cpp",
+          "bob/sp/cpp/PrunedFFT1D.cpp",
+          "bob/sp/cpp/SlidingDFT.cpp",
+          "bob/sp/cpp/Goertzel.cpp",
+          "bob/sp/cpp/ChirpZ.cpp",
+          "bob/sp/cpp/fftconv.cpp",
+          "bob/sp/cpp/FFTPlan.cpp",
+          "bob/sp/cpp/StockhamFFT.cpp",
+          "bob/sp/cpp/FFTWBackend.cpp",
+          "bob/sp/cpp/FFTTuner.cpp",
+          "bob/sp/cpp/FFTCodelets.cpp",
+          "bob/sp/cpp/FourStepFFT.cpp",
+          "bob/sp/cpp/FFTBatchPlan.cpp",
+          "bob/sp/cpp/Workspace.cpp",
+          "bob/sp/cpp/ThreadPool.cpp",
+          "bob/sp/cpp/fftpack.c",
+          "bob/sp/cpp/fftpack_simd.c",
+          "bob/sp/cpp/fftpack_float.c",
+          "bob/sp/cpp/fftpack_batch.c",
+          "bob/sp/cpp/goertzel.c"
         ],
         version = version,
         bob_packages = bob_packages,
+        packages = fftw_packages,
+        define_macros = fftw_macros,
       ),
 
       Extension("bob.sp._library",
@@ -69,11 +106,25 @@ setup(
           "bob/sp/fft2d.cpp",
           "bob/sp/ifft1d.cpp",
           "bob/sp/ifft2d.cpp",
+          "bob/sp/fftnd.cpp",
+          "bob/sp/ifftnd.cpp",
+          "bob/sp/rfft1d.cpp",
+          "bob/sp/irfft1d.cpp",
+          "bob/sp/rfft2d.cpp",
+          "bob/sp/irfft2d.cpp",
+          "bob/sp/pruned_fft1d.cpp",
+          "bob/sp/pruned_ifft1d.cpp",
+          "bob/sp/sliding_dft.cpp",
+          "bob/sp/goertzel.cpp",
+          "bob/sp/chirpz.cpp",
           "bob/sp/fft.cpp",
+          "bob/sp/fftconv.cpp",
           "bob/sp/dct1d.cpp",
           "bob/sp/dct2d.cpp",
           "bob/sp/idct1d.cpp",
           "bob/sp/idct2d.cpp",
+          "bob/sp/dctnd.cpp",
+          "bob/sp/idctnd.cpp",
           "bob/sp/dct.cpp",
           "bob/sp/main.cpp",
         ],